@@ -0,0 +1,97 @@
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<thread>
+#include	<vector>
+#include	<cstdlib>
+#include	"RBT_main.h"
+
+/*==============================================================================\
+ | Program:		rbtConcurrentTree Benchmark										|
+ | DESCRIPTION:	Measures lookup and write throughput of rbtConcurrentTree		|
+ |				for read-mostly (95/5) and mixed (50/50) workloads, from one	|
+ |				thread up to the number of hardware threads.					|
+ |				Usage: bench_concurrent [tree size] [ops per thread] [threads]	|
+ \=============================================================================*/
+
+using namespace std;
+
+/*
+ * function_identifier: A small per-thread random number generator (xorshift64)
+ * parameters: 			The generator's state
+ * return value:		The next random value
+*/
+inline uint64_t nextRandom(uint64_t &state) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+/*
+ * function_identifier: Runs one workload over a prefilled tree and reports its throughput
+ * parameters: 			The tree size, the number of threads, the operations per thread, and the percent of reads
+ * return value:		Operations per second, over all threads
+*/
+double runWorkload(int treeSize, size_t threads, size_t ops, unsigned readPercent) {
+		// Prefills the tree with every even key, so half of all lookups miss
+	int *keys = new int[treeSize], *data = new int[treeSize];
+	for(int i=0; i<treeSize; i++) {
+		keys[i] = i << 1;
+		data[i] = i;
+	}
+	rbtConcurrentTree<int, int> rbt;
+	rbt.rbt_repInsert(treeSize, keys, data);
+	delete [] keys;
+	delete [] data;
+
+		// Starts all the workers at once
+	vector<thread> workers;
+	auto start = chrono::steady_clock::now();
+	for(size_t t=0; t<threads; t++)
+		workers.emplace_back([&, t] () -> void {
+			uint64_t state = 0x9E3779B97F4A7C15ull * (t + 1);
+			int found;
+			for(size_t i=0; i<ops; i++) {
+				uint64_t roll = nextRandom(state);
+				int key = (int)(roll % (uint64_t)(treeSize << 1));
+					// Writes insert and then delete odd keys, so the tree size stays steady
+				if (roll / 7 % 100 < readPercent)
+					rbt.rbt_searchKey(key, found);
+				else if (i & 1)
+					rbt.rbt_deleteKey(key | 1);
+				else
+					rbt.rbt_insert(key | 1, 0);
+			}
+		});
+	for(auto &worker : workers)
+		worker.join();
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+	return (threads * ops) / elapsed.count();
+}
+
+int main(int argc, char **argv) {
+	int treeSize = argc > 1 ? atoi(argv[1]) : 1 << 20;
+	size_t ops = argc > 2 ? strtoull(argv[2], NULL, 10) : 200000;
+	size_t maxThreads = argc > 3 ? strtoull(argv[3], NULL, 10) : thread::hardware_concurrency();
+	if (!maxThreads)
+		maxThreads = 1;
+	unsigned mixes[2] = {95, 50};
+
+	cout << "tree size " << treeSize << ", " << ops << " operations per thread, " << "up to " << maxThreads << " threads" << endl;
+	for(unsigned readPercent : mixes) {
+		cout << endl << readPercent << "/" << 100 - readPercent << " read/write" << endl;
+		cout << setw(8) << "threads" << setw(16) << "ops/sec" << setw(10) << "scaling" << endl;
+
+		double base = 0;
+		for(size_t threads=1; threads<=maxThreads; threads<<=1) {
+			double rate = runWorkload(treeSize, threads, ops, readPercent);
+			if (threads == 1)
+				base = rate;
+			cout << setw(8) << threads << setw(16) << fixed << setprecision(0) << rate << setw(9) << setprecision(2) << rate / base << "x" << endl;
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include	<iostream>
+#include	<iomanip>
+#include	<chrono>
+#include	<thread>
+#include	<cstdlib>
+#include	"RBT_main.h"
+
+/*==============================================================================\
+ | Program:		Parallel Set Operation Benchmark								|
+ | DESCRIPTION:	Measures union, intersection, exclusive or and difference of	|
+ |				two large, half overlapping trees. Each operation runs once		|
+ |				through its operator, and then through its parallel variant,	|
+ |				from one thread up to the number of hardware threads.			|
+ |				Usage: bench_setops [tree size] [threads] [repeats]				|
+ \=============================================================================*/
+
+using namespace std;
+
+/*
+ * function_identifier: Times an in place set operation on a fresh copy of a tree, leaving the copy out of the time
+ * parameters: 			The tree, the number of repeats, and the operation
+ * return value:		The average time, in milliseconds
+*/
+template <typename F>
+double timeOperation(const rbTree<int, int> &rbt, size_t repeats, F foo) {
+	double total = 0;
+	for(size_t r=0; r<repeats; r++) {
+		rbTree<int, int> copy = rbt;
+		auto start = chrono::steady_clock::now();
+		foo(copy);
+		chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+		total += elapsed.count();
+	}
+	return total / repeats;
+}
+
+int main(int argc, char **argv) {
+	int treeSize = argc > 1 ? atoi(argv[1]) : 1 << 22;
+	size_t maxThreads = argc > 2 ? strtoull(argv[2], NULL, 10) : thread::hardware_concurrency();
+	size_t repeats = argc > 3 ? strtoull(argv[3], NULL, 10) : 3;
+	if (!maxThreads)
+		maxThreads = 1;
+	if (!repeats)
+		repeats = 1;
+
+		// Fills one tree with every even key, and the other with every third key, so a third of the keys are shared
+	int *keys = new int[treeSize], *data = new int[treeSize];
+	rbTree<int, int> rbt1, rbt2;
+	for(int i=0; i<treeSize; i++) {
+		keys[i] = i << 1;
+		data[i] = 0;
+	}
+	rbt1.rbt_repInsert(treeSize, keys, data);
+	for(int i=0; i<treeSize; i++)
+		keys[i] = i * 3;
+	rbt2.rbt_repInsert(treeSize, keys, data);
+	delete [] keys;
+	delete [] data;
+
+	const char *names[4] = {"|", "&", "^", "-"};
+	cout << "tree size " << treeSize << ", up to " << maxThreads << " threads, averaged over " << repeats << " runs" << endl;
+	for(int op=0; op<4; op++) {
+		cout << endl << "operator" << names[op] << "=" << endl;
+		cout << setw(10) << "threads" << setw(14) << "ms" << setw(10) << "speedup" << endl;
+
+			// Runs the operator, then the parallel variant
+		double base = timeOperation(rbt1, repeats, [&] (rbTree<int, int> &rbt) -> void {
+			if (op == 0) rbt |= rbt2;
+			else if (op == 1) rbt &= rbt2;
+			else if (op == 2) rbt ^= rbt2;
+			else rbt -= rbt2;
+		});
+		cout << setw(10) << "operator" << setw(14) << fixed << setprecision(1) << base << setw(9) << setprecision(2) << 1.0 << "x" << endl;
+
+		for(size_t threads=1; threads<=maxThreads; threads<<=1) {
+			double time = timeOperation(rbt1, repeats, [&] (rbTree<int, int> &rbt) -> void {
+				if (op == 0) rbt.rbt_orParallelI(rbt2, threads);
+				else if (op == 1) rbt.rbt_andParallelI(rbt2, threads);
+				else if (op == 2) rbt.rbt_xorParallelI(rbt2, threads);
+				else rbt.rbt_subParallelI(rbt2, threads);
+			});
+			cout << setw(10) << threads << setw(14) << fixed << setprecision(1) << time << setw(9) << setprecision(2) << base / time << "x" << endl;
+		}
+	}
+
+	return 0;
+}
@@ -1,5 +1,6 @@
 #ifndef _rbt_accessNode_HEADER
 #define _rbt_accessNode_HEADER
+#include	<stdexcept>
 
 #include	"../src/RBT_access.cpp"
 #endif /* _rbt_accessNode_HEADER */
\ No newline at end of file
@@ -0,0 +1,5 @@
+#ifndef _rbt_concurrent_HEADER
+#define _rbt_concurrent_HEADER
+
+#include	"../src/RBT_concurrent.cpp"
+#endif /* _rbt_concurrent_HEADER */
\ No newline at end of file
@@ -1,14 +1,46 @@
 #ifndef _rbt_macro_HEADER
 #define _rbt_macro_HEADER
 #include	<stddef.h>
+#include	<stdint.h>
 	/*	 GLOBAL VARIABLES	*/
 		/*		  CUSTOM DATA TYPES		  */
 enum rbtraversal	{TEST_ORDER, PRE_ORDER, IN_ORDER, POST_ORDER, KEY_DATA, LEVEL_ORDER, PRINT_LEVEL};
 enum rbtsort		{KEY, KEY_R, DATA, DATA_R, KEYDATA, KEYDATA_R, DATAKEY, DATAKEY_R, NONE};
 
-		/*		  OTHER DATA TYPES		  */
-namespace {
-	inline void *rbt__otherData__;
-}
+		/*		  NODE LAYOUT		  */
+	// Define RBT_COMPACT_NODES before including the library to pack each node's color into its
+	// parent link and count descendants with 32 bits. Trees are then limited to 2^32 nodes
+#ifdef RBT_COMPACT_NODES
+typedef uint32_t rbt_count_t;
+#else
+typedef size_t rbt_count_t;
+#endif
+
+		/*		  DATA BOUNDS		  */
+	// Define RBT_DATA_BOUNDS before including the library to have every node track the nodes with the
+	// smallest and largest data in its subtree. Data lookups then skip subtrees, at two pointers per node
+
+		/*		  DATA INDEX		  */
+	// Define RBT_DATA_INDEX before including the library to also link every node into a tree ordered by data
+	// and then key. Data searches, counts and small data deletions are then O(log(N)), at five fields per node
+
+		/*		  PARALLEL BUILDS		  */
+	// Node arrays of at least this many nodes are sorted, and built into trees, on several threads.
+	// Define RBT_PARALLEL_CUTOFF as SIZE_MAX before including the library to always use one thread
+#ifndef RBT_PARALLEL_CUTOFF
+#define RBT_PARALLEL_CUTOFF 65536
+#endif
+
+		/*		  BULK INSERTS		  */
+	// Batches inserted by rbt_repInsert() and its variants rebuild the tree if they hold at least 1/RBT_BULK_REBUILD as
+	// many nodes as the tree, are joined into the tree if they hold at least RBT_BULK_JOIN nodes and are clustered
+	// (no more of the tree's nodes lie between their first and last nodes than they hold), and descend once per node
+	// otherwise
+#ifndef RBT_BULK_REBUILD
+#define RBT_BULK_REBUILD 1
+#endif
+#ifndef RBT_BULK_JOIN
+#define RBT_BULK_JOIN 2048
+#endif
 
 #endif /* _rbt_macro_HEADER */
\ No newline at end of file
@@ -0,0 +1,7 @@
+#ifndef _rbt_index_HEADER
+#define _rbt_index_HEADER
+#include <stddef.h>
+#include	<cmath>
+
+#include	"../src/RBT_index.cpp"
+#endif /* _rbt_index_HEADER */
\ No newline at end of file
@@ -0,0 +1,5 @@
+#ifndef _rbt_iterator_HEADER
+#define _rbt_iterator_HEADER
+
+#include	"../src/RBT_iterator.cpp"
+#endif /* _rbt_iterator_HEADER */
\ No newline at end of file
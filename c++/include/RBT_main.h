@@ -3,24 +3,126 @@
 #include	"RBT_defs.h"
 #include	<iostream>
 #include	<string>
+#include	<sstream>
+#include	<memory>
+#include	<new>
+#include	<type_traits>
+#include	<utility>
+#include	<vector>
+#include	<mutex>
+#include	<shared_mutex>
+#include	<atomic>
+#include	<thread>
+#include	<functional>
+#include	<iterator>
+#include	<cstddef>
+#include	<algorithm>
+#include	<cmath>
 
 /*        CUSTOM DATA TYPES        */
-template <typename K = int, typename D = int>
+	// The default ordering of keys and data: operator< and operator==
+	// A custom ordering is a type with the same two static functions, each returning a negative number,
+	// 0, or a positive number (as the first value is less than, equal to, or greater than the second)
+template <typename K, typename D>
+struct rbtCompare {
+	static inline int key(const K &, const K &);
+	static inline int data(const D &, const D &);
+};
+
+	// The default per-subtree aggregate: none. Specialize rbtAggregate<K,D> with a 'type' and three static functions,
+	// identity(), lift(key, data) (a single node's value) and an associative combine(a, b), to keep the aggregate
+	// of every subtree in its root (readable with rbt_aggregate()). combine() gets its values in key order
+struct rbtNoAggregate {};
+template <typename K, typename D>
+struct rbtAggregate {
+	typedef rbtNoAggregate type;
+	static inline type identity();
+	static inline type lift(const K &, const D &);
+	static inline type combine(const type &, const type &);
+};
+
+	// A node's stored aggregate (empty, and so free, for the default)
+template <typename T>
+struct rbtAggregateSlot {
+	T aggregate;
+};
+template <>
+struct rbtAggregateSlot<rbtNoAggregate> {};
+
+template <typename K = int, typename D = int, typename C = rbtCompare<K,D>>
 class rbTree;
+template <typename K = int, typename D = int>
+class rbtNode;
+template <typename K = int, typename D = int>
+class rbtPool;
+template <typename K = int, typename D = int, bool constant = false>
+class rbtIterator;
+template <typename K = int, typename D = int, typename C = rbtCompare<K,D>>
+class rbtConcurrentTree;
+template <typename K = int, typename D = int, typename C = rbtCompare<K,D>>
+class rbtSnapshotTree;
+template <typename K, typename D, enum rbtsort sort, typename C = rbtCompare<K,D>>
+struct rbtNodeCompair;
+
+#ifdef RBT_COMPACT_NODES
+/*    Parent Link, with the Node Color in its Low Bit    */
+template <typename K, typename D>
+class rbtLink {
+	uintptr_t bits = 0;
+
+	public:
+			// Public Link Functions
+		rbtLink<K,D> &operator=(rbtNode<K,D> *);
+		rbtLink<K,D> &operator=(const rbtLink<K,D> &);
+		operator rbtNode<K,D> *() const;
+		rbtNode<K,D> *operator->() const;
+
+		bool getColor() const;
+		void setColor(bool);
+};
+#endif
 
 /*    Basic Node of Tree    */
-template <typename K = int, typename D = int>
-class rbtNode {
-	template <typename T, typename U> friend class rbTree;
+template <typename K, typename D>
+class rbtNode : rbtAggregateSlot<typename rbtAggregate<K,D>::type> {
+	template <typename T, typename U, typename V> friend class rbTree;
+	template <typename T, typename U, bool V> friend class rbtIterator;
+
+#ifdef RBT_COMPACT_NODES
+		// Node Structure
+	rbtNode<K,D> *left, *right;
+	rbtLink<K,D> parent;
 
+		// Base Variables
+	rbt_count_t descendants;
+	K key;
+	D data;
+#else
 		// Base Variables
 	bool color;
 	K key;
 	D data;
-	size_t descendants;
+	rbt_count_t descendants;
 
 		// Node Structure
 	rbtNode<K,D> *left, *right, *parent;
+#endif
+
+#ifdef RBT_DATA_BOUNDS
+		// Subtree Data Bounds
+	rbtNode<K,D> *minData, *maxData;
+#endif
+
+#ifdef RBT_DATA_INDEX
+		// Data Index Structure
+	rbtNode<K,D> *dataLeft, *dataRight, *dataParent;
+	rbt_count_t dataDescendants;
+	bool dataColor;
+#endif
+
+		// Private Node Functions
+	inline bool getColor() const;
+	inline void setColor(bool);
 
 	public:
 			// Public Node Functions
@@ -32,76 +134,207 @@ class rbtNode {
 		bool equal(const rbtNode<K,D> *);
 };
 
-/*            Tree Class           */
+/*    Slab Allocator for Nodes    */
 template <typename K, typename D>
+class rbtPool {
+	template <typename T, typename U, typename V> friend class rbTree;
+
+		// A single node-sized slot; links to the next free slot while unused
+	union rbtSlot {
+		rbtSlot *next;
+		alignas(rbtNode<K,D>) unsigned char raw[sizeof(rbtNode<K,D>)];
+	};
+
+		// Base Variables
+	rbtSlot *slabs, *freeList, *bump, *bumpEnd;
+	size_t slabLen, slabMax, live;
+
+	// Private Functions
+		// RBT_pool
+	void newSlab();
+	void *allocate();
+	void deallocate(void *);
+	void reset();
+	void absorb(rbtPool<K,D> &);
+
+	public:
+		// Constructors
+			// RBT_pool
+		rbtPool(size_t = 64, size_t = 4096);
+		rbtPool(const rbtPool<K,D> &) = delete;
+		~rbtPool();
+
+		// Public Pool Functions
+			// RBT_pool
+		void operator=(const rbtPool<K,D> &) = delete;
+
+		size_t rbt_getLive() const;
+		size_t rbt_getSlabCount() const;
+		void rbt_release();
+};
+
+/*    In-order Node Iterator    */
+template <typename K, typename D, bool constant>
+class rbtIterator {
+	template <typename T, typename U, typename V> friend class rbTree;
+	template <typename T, typename U, bool V> friend class rbtIterator;
+
+		// Base Variables (curr is NULL at the end)
+	rbtNode<K,D> *curr, *root;
+
+		// Private Constructors
+			// RBT_iterator
+	rbtIterator(rbtNode<K,D> *, rbtNode<K,D> *);
+
+	public:
+			// Iterator Traits
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef rbtNode<K,D> value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef typename std::conditional<constant, const rbtNode<K,D>, rbtNode<K,D>>::type *pointer;
+		typedef typename std::conditional<constant, const rbtNode<K,D>, rbtNode<K,D>>::type &reference;
+
+		// Constructors
+			// RBT_iterator
+		rbtIterator();
+		rbtIterator(const rbtIterator<K,D,false> &);
+
+		// Public Iterator Functions
+			// RBT_iterator
+		rbtIterator<K,D,constant> &operator=(const rbtIterator<K,D,constant> &) = default;
+		reference operator*() const;
+		pointer operator->() const;
+
+		rbtIterator<K,D,constant> &operator++();
+		rbtIterator<K,D,constant> operator++(int);
+		rbtIterator<K,D,constant> &operator--();
+		rbtIterator<K,D,constant> operator--(int);
+
+		template <bool V>
+			bool operator==(const rbtIterator<K,D,V> &) const;
+		template <bool V>
+			bool operator!=(const rbtIterator<K,D,V> &) const;
+};
+
+/*            Tree Class           */
+template <typename K, typename D, typename C>
 class rbTree {
 	// Base Variables
 	size_t size;
 	rbtNode<K,D> *root;
+	std::shared_ptr<rbtPool<K,D>> pool;
+#ifdef RBT_DATA_INDEX
+	rbtNode<K,D> *dataRoot = NULL;
+#endif
+
+		// If nodes keep anything that must be recalculated, from their children, as the tree changes
+	typedef rbtAggregate<K,D> aggregator;
+#ifdef RBT_DATA_BOUNDS
+	static constexpr bool augmented = true;
+#else
+	static constexpr bool augmented = !std::is_same<typename aggregator::type, rbtNoAggregate>::value;
+#endif
 
 	// Private Functions
 		// RBT_main
 	void dummy() {}
+	inline rbtNode<K,D> *allocNode(K, D);
+	inline rbtNode<K,D> *allocNode(const rbtNode<K,D> *);
+	inline void freeNode(rbtNode<K,D> *);
 	void leftRotate(rbtNode<K,D> *);
 	void rightRotate(rbtNode<K,D> *);
+	void insertBase(rbtNode<K,D> *, rbtNode<K,D> * = NULL);
+	void unlinkBase(rbtNode<K,D> *);
+	bool insertFixBase(rbtNode<K,D> *);
+	static inline void augmentBase(rbtNode<K,D> *);
 	void deleteBranch(rbtNode<K,D> *);
 	void copyTree(rbtNode<K,D> *, rbtNode<K,D> **);
+	inline void swapTree(rbTree<K,D,C> &);
 	void rbt_free();
 
 		// RBT_traversal
 	template <typename F>
-		inline size_t nodesSpecifiedLevelBase(size_t, rbtNode<K,D>, F) const;
-
-	void nodesPre(rbtNode<K,D> *) const;
-	void nodesPreWithKey(rbtNode<K,D> *, K) const;
-	void nodesPreWithData(rbtNode<K,D> *, D) const;
-	void nodesPreWithDataKey(rbtNode<K,D> *, D, K) const;
-	void nodesIn(rbtNode<K,D> *) const;
-	void nodesInWithKey(rbtNode<K,D> *, K) const;
-	void nodesInWithData(rbtNode<K,D> *, D) const;
-	void nodesInWithDataKey(rbtNode<K,D> *, D, K) const;
-	void nodesPost(rbtNode<K,D> *) const;
-	void nodesPostWithKey(rbtNode<K,D> *, K) const;
-	void nodesPostWithData(rbtNode<K,D> *, D) const;
-	void nodesPostWithDataKey(rbtNode<K,D> *, D, K) const;
-	void nodesLevel() const;
-	void nodesLevelWithKey(K) const;
-	void nodesLevelWithData(D) const;
-	void nodesLevelWithDataKey(D, K) const;
-	size_t nodesSpecifiedLevel(size_t) const;
-	size_t nodesSpecifiedLevelWithKey(size_t, K) const;
-	size_t nodesSpecifiedLevelWithData(size_t, D) const;
-	size_t nodesSpecifiedLevelWithDataKey(size_t, D, K) const;
-	void getAllKeys(rbtNode<K,D> *) const;
-	void getAllData(rbtNode<K,D> *) const;
-	void countKey(rbtNode<K,D> *, K) const;
-	void countData(rbtNode<K,D> *, D) const;
-	void countKeyData(rbtNode<K,D> *, K, D) const;
+		inline size_t nodesSpecifiedLevelBase(rbtNode<K,D> **, size_t, rbtNode<K,D>, F) const;
+
+	void nodesPre(rbtNode<K,D> *, rbtNode<K,D> **&) const;
+	void nodesPreWithKey(rbtNode<K,D> *, K, rbtNode<K,D> **&) const;
+	void nodesPreWithData(rbtNode<K,D> *, D, rbtNode<K,D> **&) const;
+	void nodesPreWithDataKey(rbtNode<K,D> *, D, K, rbtNode<K,D> **&) const;
+	void nodesIn(rbtNode<K,D> *, rbtNode<K,D> **&) const;
+	void nodesInWithKey(rbtNode<K,D> *, K, rbtNode<K,D> **&) const;
+	void nodesInWithData(rbtNode<K,D> *, D, rbtNode<K,D> **&) const;
+	void nodesInWithDataKey(rbtNode<K,D> *, D, K, rbtNode<K,D> **&) const;
+	void nodesPost(rbtNode<K,D> *, rbtNode<K,D> **&) const;
+	void nodesPostWithKey(rbtNode<K,D> *, K, rbtNode<K,D> **&) const;
+	void nodesPostWithData(rbtNode<K,D> *, D, rbtNode<K,D> **&) const;
+	void nodesPostWithDataKey(rbtNode<K,D> *, D, K, rbtNode<K,D> **&) const;
+	void nodesLevel(rbtNode<K,D> **&) const;
+	void nodesLevelWithKey(K, rbtNode<K,D> **&) const;
+	void nodesLevelWithData(D, rbtNode<K,D> **&) const;
+	void nodesLevelWithDataKey(D, K, rbtNode<K,D> **&) const;
+	size_t nodesSpecifiedLevel(rbtNode<K,D> **, size_t) const;
+	size_t nodesSpecifiedLevelWithKey(rbtNode<K,D> **, size_t, K) const;
+	size_t nodesSpecifiedLevelWithData(rbtNode<K,D> **, size_t, D) const;
+	size_t nodesSpecifiedLevelWithDataKey(rbtNode<K,D> **, size_t, D, K) const;
+	void getAllKeys(rbtNode<K,D> *, K *&) const;
+	void getAllData(rbtNode<K,D> *, D *&) const;
+	void countData(rbtNode<K,D> *, D, size_t &) const;
+	inline size_t boundIdxBase(rbtIterator<K,D>) const;
 
 		// RBT_access
 	inline size_t findIdxBase(rbtNode<K,D> *) const;
+	template <typename F>
+		inline rbtNode<K,D> *dataScanBase(F) const;
+	template <typename F>
+		inline rbtNode<K,D> *dataEdgeBase(F, bool) const;
+	template <typename F>
+		inline rbtNode<K,D> *boundBase(F) const;
+	inline size_t quantileIdx(double) const;
+	void quantilesBase(rbtNode<K,D> *, size_t, const size_t *, const size_t *, rbtNode<K,D> **) const;
+	typename aggregator::type aggregateBase(rbtNode<K,D> *, const K &, const K &, bool, bool) const;
 	rbtNode<K,D> *key_maxData(rbtNode<K,D> *, K) const;
 	rbtNode<K,D> *key_minData(rbtNode<K,D> *, K) const;
 
 	size_t getHeight(rbtNode<K,D> *) const;
-	void getWidth(rbtNode<K,D> *, size_t) const;
+	void getWidth(rbtNode<K,D> *, size_t, size_t *) const;
 	size_t getLeafNodes(rbtNode<K,D> *) const;
 	rbtNode<K,D> *searchData(rbtNode<K,D> *, D ) const;
-	rbtNode<K,D> *dataMax(rbtNode<K,D> *) const;
-	rbtNode<K,D> *dataMin(rbtNode<K,D> *) const;
 	rbtNode<K,D> *search(rbtNode<K,D> *, K, D) const;
 
+		// RBT_index
+	void dataInsertBase(rbtNode<K,D> *);
+	void dataEraseBase(rbtNode<K,D> *);
+	template <typename F>
+		void dataIndexBase(size_t, F);
+	inline void dataIndexBase();
+#ifdef RBT_DATA_INDEX
+	static inline size_t dataCountBase(const rbtNode<K,D> *);
+	inline void dataSpliceBase(rbtNode<K,D> *, rbtNode<K,D> *);
+	void dataLeftRotate(rbtNode<K,D> *);
+	void dataRightRotate(rbtNode<K,D> *);
+	static void dataLinkBase(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **, rbtNode<K,D> *, size_t, size_t);
+	size_t dataRankBase(const D &, bool, rbtNode<K,D> **) const;
+	rbtNode<K,D> *dataEndBase(bool) const;
+	inline bool dataFewBase(size_t) const;
+	void dataTrimBase(size_t, size_t);
+#endif
+
 		// RBT_sort
 	size_t treeify(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **);
 	size_t treeifyShallow(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **);
-	template <K, D>
-		inline friend void mergeSortBase(rbtNode<K,D> **, size_t, size_t, size_t);
-	template <K, D>
-		inline friend void mergeSortCallerBase(rbtNode<K,D> **, size_t, size_t);
+	static void treeifyLevels(size_t, size_t &, size_t &);
+	static void treeifyBase(size_t, size_t, rbtNode<K,D> **, void **, rbtNode<K,D> **, size_t, size_t, size_t);
+	template <enum rbtsort sort>
+		using compair = rbtNodeCompair<K,D,sort,C>;
+	template <typename T, typename U, typename F>
+		inline friend void mergeSortBase(rbtNode<T,U> **, size_t, size_t, size_t, F);
+	template <typename T, typename U, typename F>
+		inline friend void mergeSortCallerBase(rbtNode<T,U> **, size_t, size_t, F);
 
 		// RBT_indel
+	rbtNode<K,D> *repInsertJoinBase(rbtNode<K,D> *, size_t, rbtNode<K,D> **, rbtNode<K,D> **, size_t &);
 	template <typename F>
-		void rbt_repInsertBase(size_t, F, bool);
+		void rbt_repInsertBase(size_t, F);
 	template <typename F>
 		inline void repDeleteBase(size_t, rbtNode<K,D> **, F, bool);
 	template <typename F, typename T>
@@ -114,87 +347,125 @@ class rbTree {
 		inline void removeBase(T, F);
 	template <typename F>
 		inline void removeDuplicatesBase(F);
+	template <typename T>
+		inline static bool valueOrder(const T &, const T &, bool);
 
 		// RBT_ops
-	inline rbTree<K,D> subBase(const rbTree<K,D> &, void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&)) const;
-	inline rbTree<K,D> *divideBase(
+	inline rbTree<K,D,C> subBase(const rbTree<K,D,C> &, void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&)) const;
+	inline rbTree<K,D,C> *divideBase(
 		size_t div,
 		enum rbtraversal traversal,
-		rbTree<K,D> *(rbTree<K, D>::*foo)(),
-		void (rbTree<K,D>::*bar)(size_t, rbtNode<K,D> **, rbTree<K,D> *, enum rbtraversal, size_t (rbTree<K, D>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **)),
-		size_t (rbTree<K,D>::*nar)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **));
-	inline rbTree<K,D> *deepDivideHelper();
-	inline rbTree<K,D> *shallowDivideHelper();
+		rbTree<K,D,C> *(rbTree<K,D,C>::*foo)(),
+		void (rbTree<K,D,C>::*bar)(size_t, rbtNode<K,D> **, rbTree<K,D,C> *, enum rbtraversal, size_t (rbTree<K,D,C>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **)),
+		size_t (rbTree<K,D,C>::*nar)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **));
+	inline rbTree<K,D,C> *deepDivideHelper();
+	inline rbTree<K,D,C> *shallowDivideHelper();
 	inline void distributeDivideHelper(
 		size_t,
 		rbtNode<K,D> **,
-		rbTree<K,D> *,
+		rbTree<K,D,C> *,
 		enum rbtraversal,
-		size_t (rbTree<K, D>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **));
+		size_t (rbTree<K,D,C>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **));
 	inline void scatterDivideHelper(
 		size_t,
 		rbtNode<K,D> **,
-		rbTree<K,D> *,
+		rbTree<K,D,C> *,
 		enum rbtraversal,
-		size_t (rbTree<K, D>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **));
+		size_t (rbTree<K,D,C>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **));
+	static size_t blackHeightBase(rbtNode<K,D> *);
+	rbtNode<K,D> *joinBase(rbtNode<K,D> *, size_t, rbtNode<K,D> *, rbtNode<K,D> *, size_t, size_t &);
+	template <typename F>
+		void splitBase(rbtNode<K,D> *, size_t, F, size_t, rbtNode<K,D> *&, size_t &, rbtNode<K,D> *&, size_t &);
+	rbtNode<K,D> *concatBase(rbtNode<K,D> *, size_t, rbtNode<K,D> *, size_t, size_t &);
+	void dropBase(rbtNode<K,D> *);
+	rbtNode<K,D> *keepRunBase(rbtNode<K,D> *, size_t, size_t, bool, size_t &);
+	rbtNode<K,D> *copyRunBase(rbtNode<K,D> *const *, rbtNode<K,D> *const *, size_t &);
+	template <typename F>
+		rbtNode<K,D> *mergeRunsBase(rbtNode<K,D> *, size_t, rbtNode<K,D> *const *, rbtNode<K,D> *const *, bool, F &, size_t &);
+	template <typename F>
+		rbtNode<K,D> *mergeRunsParallelBase(rbtNode<K,D> *const *, size_t, bool, F &, size_t, size_t &);
+	rbtNode<K,D> **matchedRunsBase(const rbTree<K,D,C> &, size_t &) const;
+	template <typename F>
+		void mergeRunsI(const rbTree<K,D,C> &, bool, bool, F, size_t = 1);
+	static rbtNode<K,D> *subRunBase(rbTree<K,D,C> &, rbtNode<K,D> *, size_t, size_t, rbtNode<K,D> *const *, rbtNode<K,D> *const *, size_t &);
+	void joinTreeBase(rbTree<K,D,C> &, K, D, rbTree<K,D,C> &);
 
 		// RBT_setops
 	template <typename F>
-		inline rbTree<K,D> orBase(
-								 const rbTree<K,D> &,
+		inline rbTree<K,D,C> orBase(
+								 const rbTree<K,D,C> &,
 								 void (*)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
 								 F,
 								 bool = false,
 								 bool = false
 								 ) const;
-	template <typename F>
-		inline rbTree<K,D> orBaseI(
-								  const rbTree<K,D> &,
-								  void (*)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
-								  F,
+	template <typename F1, typename F2>
+		inline rbTree<K,D,C> &orBaseI(
+								  const rbTree<K,D,C> &,
+								  F1,
+								  F2,
 								  bool = false,
 								  bool = false
 								  );
 	template <typename F>
-		inline rbTree<K,D> andBase(
-								  const rbTree<K,D> &,
+		inline rbTree<K,D,C> andBase(
+								  const rbTree<K,D,C> &,
 								  void (*)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
 								  F,
 								  bool = false
 								  ) const;
-	template <typename F>
-		inline rbTree<K,D> andBaseI(
-								   const rbTree<K,D> &,
-								   void (*)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
-								   F,
+	template <typename F1, typename F2>
+		inline rbTree<K,D,C> &andBaseI(
+								   const rbTree<K,D,C> &,
+								   F1,
+								   F2,
 								   bool = false
 								   );
+	static rbtNode<K,D> *orRunBase(rbTree<K,D,C> &, rbtNode<K,D> *, size_t, size_t, rbtNode<K,D> *const *, rbtNode<K,D> *const *, size_t &);
+	static rbtNode<K,D> *orMostRunBase(rbTree<K,D,C> &, rbtNode<K,D> *, size_t, size_t, rbtNode<K,D> *const *, rbtNode<K,D> *const *, size_t &);
+	static rbtNode<K,D> *xorRunBase(rbTree<K,D,C> &, rbtNode<K,D> *, size_t, size_t, rbtNode<K,D> *const *, rbtNode<K,D> *const *, size_t &);
+	static rbtNode<K,D> *andRunBase(rbTree<K,D,C> &, rbtNode<K,D> *, size_t, size_t, rbtNode<K,D> *const *, rbtNode<K,D> *const *, size_t &);
 
 		// RBT_limit
 	template <typename F>
 		void rbt_clampBase(F);
+	template <typename F1, typename F2>
+		void limitBase(size_t, F1, F2, bool);
 
 		// RBT_value
-	void nodeReposition(rbtNode<K,D> **, rbtNode<K,D> **, rbtNode<K,D> **, rbtNode<K,D> *);
 	template <typename F>
 		inline void rbt_setBase(rbtNode<K,D> *, F);
+	static void augmentAllBase(rbtNode<K,D> *);
 	template <typename F>
-		inline void rbt_funcAllBase(F);
+		inline void rbt_funcAllBase(F, bool);
 
 		// RBT_string
-	void testOrder(rbtNode<K,D> *) const;
-	void preOrder(rbtNode<K,D> *) const;
-	void inOrder(rbtNode<K,D> *) const;
-	void postOrder(rbtNode<K,D> *) const;
-	void keyAndData(rbtNode<K,D> *) const;
-	void printLevel(rbtNode<K,D> *, size_t) const;
-	void levelOrder() const;
+	void testOrder(rbtNode<K,D> *, std::ostringstream &) const;
+	void preOrder(rbtNode<K,D> *, std::ostringstream &) const;
+	void inOrder(rbtNode<K,D> *, std::ostringstream &) const;
+	void postOrder(rbtNode<K,D> *, std::ostringstream &) const;
+	void keyAndData(rbtNode<K,D> *, std::ostringstream &) const;
+	void printLevel(rbtNode<K,D> *, size_t, std::ostringstream &) const;
+	void levelOrder(std::ostringstream &) const;
 
 	public:
+		// Iterators
+			// RBT_iterator
+		typedef rbtIterator<K,D,false> iterator;
+		typedef rbtIterator<K,D,true> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+		// Aggregates
+			// RBT_access
+		typedef typename rbtAggregate<K,D>::type aggregate_type;
+
 		// Constructors
 			// RBT_main
 		rbTree();
-		rbTree(const rbTree<K,D> &);
+		rbTree(const rbTree<K,D,C> &);
+		rbTree(rbTree<K,D,C> &&) noexcept;
+		rbTree(std::shared_ptr<rbtPool<K,D>>);
 		~rbTree();
 			// RBT_sort
 		rbTree(size_t, rbtNode<K,D> **&);
@@ -205,16 +476,33 @@ class rbTree {
 		bool rbt_isEmpty() const;
 		size_t rbt_getSize() const;
 		rbtNode<K,D> *rbt_getRoot() const;
+		std::shared_ptr<rbtPool<K,D>> rbt_getPool() const;
 
 		void rbt_insert(K, D);
+		rbtNode<K,D> *rbt_insert(rbtNode<K,D> *, K, D);
 		D rbt_delete(rbtNode<K,D> *);
 		D rbt_pop();
 
-		rbTree<K,D> rbt_copy() const;
-		void operator=(const rbTree<K,D> &);
+		rbTree<K,D,C> rbt_copy() const;
+		rbTree<K,D,C> &operator=(const rbTree<K,D,C> &);
+		rbTree<K,D,C> &operator=(rbTree<K,D,C> &&);
 
 		void rbt_clear();
 
+			// RBT_iterator
+		iterator begin();
+		const_iterator begin() const;
+		const_iterator cbegin() const;
+		iterator end();
+		const_iterator end() const;
+		const_iterator cend() const;
+		reverse_iterator rbegin();
+		const_reverse_iterator rbegin() const;
+		const_reverse_iterator crbegin() const;
+		reverse_iterator rend();
+		const_reverse_iterator rend() const;
+		const_reverse_iterator crend() const;
+
 			// RBT_traversal
 		rbtNode<K,D> **resize_helper(rbtNode<K,D> **, size_t) const;
 
@@ -243,6 +531,10 @@ class rbTree {
 		size_t rbt_countKey(K) const;
 		size_t rbt_countData(D) const;
 		size_t rbt_countKeyData(K, D) const;
+		size_t rbt_countRange(K, K) const;
+		size_t rbt_countRange(K, D, K, D) const;
+		aggregate_type rbt_aggregate() const;
+		aggregate_type rbt_aggregate(K, K) const;
 
 			// RBT_access
 		size_t rbt_getHeightExact() const;
@@ -284,6 +576,19 @@ class rbTree {
 		rbtNode<K,D> *rbt_maxData_minKey() const;
 		rbtNode<K,D> *rbt_minData_minKey() const;
 
+		iterator rbt_lowerBound(K) const;
+		iterator rbt_lowerBound(K, D) const;
+		iterator rbt_upperBound(K) const;
+		iterator rbt_upperBound(K, D) const;
+		std::pair<iterator, iterator> rbt_equalRange(K) const;
+		std::pair<iterator, iterator> rbt_equalRange(K, D) const;
+
+		size_t rbt_rank(K) const;
+		size_t rbt_rank(K, D) const;
+		rbtNode<K,D> *rbt_quantile(double) const;
+		rbtNode<K,D> *rbt_median() const;
+		void rbt_quantiles(size_t, const double *, rbtNode<K,D> **) const;
+
 			// RBT_sort
 		inline static bool keyCompair(rbtNode<K,D> *, rbtNode<K,D> *);
 		inline static bool keyCompairR(rbtNode<K,D> *, rbtNode<K,D> *);
@@ -293,12 +598,13 @@ class rbTree {
 		inline static bool keyDataCompairR(rbtNode<K,D> *, rbtNode<K,D> *);
 		inline static bool dataKeyCompair(rbtNode<K,D> *, rbtNode<K,D> *);
 		inline static bool dataKeyCompairR(rbtNode<K,D> *, rbtNode<K,D> *);
+		inline static bool keyDataEqual(rbtNode<K,D> *, rbtNode<K,D> *);
 
 		void rbt_treeify(size_t, rbtNode<K,D> **);
-		template <K, D>
-			friend void rbt_nodeSort(rbtNode<K,D> **, size_t, size_t, enum rbtsort);
-		template <K, D>
-			friend void rbt_nodeSortCustom(rbtNode<K,D> **, void (*foo)(rbtNode<K,D> *, rbtNode<K,D> *), size_t, size_t);
+		template <typename T, typename U>
+			friend void rbt_nodeSort(rbtNode<T,U> **, size_t, size_t, enum rbtsort);
+		template <typename T, typename U, typename F>
+			friend void rbt_nodeSortCustom(rbtNode<T,U> **, F, size_t, size_t);
 
 			// RBT_indel
 		void rbt_repInsert(size_t, K * = NULL, D * = NULL);
@@ -345,102 +651,130 @@ class rbTree {
 
 			// RBT_operation
 				// TREE UNION AND INTERSECTION
-		rbTree<K,D> operator|(const rbTree<K,D> &) const;
-		rbTree<K,D> operator|=(const rbTree<K,D> &);
-		rbTree<K,D> rbt_or(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_orLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orLeastI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_orMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orMostI(const rbTree<K,D> &);
-
-		rbTree<K,D> rbt_orKey(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orKeyI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_orKeyLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orKeyLeastI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_orKeyMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orKeyMostI(const rbTree<K,D> &);
-
-		rbTree<K,D> rbt_orData(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orDataI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_orDataLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orDataLeastI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_orDataMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_orDataMostI(const rbTree<K,D> &);
-
-		rbTree<K,D> operator^(const rbTree<K,D> &) const;
-		rbTree<K,D> operator^=(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xor(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xorLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorLeastI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xorMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorMostI(const rbTree<K,D> &);
-
-		rbTree<K,D> rbt_xorKey(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorKeyI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xorKeyLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorKeyLeastI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xorKeyMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorKeyMostI(const rbTree<K,D> &);
-
-		rbTree<K,D> rbt_xorData(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorDataI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xorDataLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorDataLeastI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_xorDataMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_xorDataMostI(const rbTree<K,D> &);
-
-		rbTree<K,D> operator&(const rbTree<K,D> &) const;
-		rbTree<K,D> operator&=(const rbTree<K,D> &);
-		rbTree<K,D> rbt_and(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_andMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andMostI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_andLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andLeastI(const rbTree<K,D> &);
-
-		rbTree<K,D> rbt_andKey(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andKeyI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_andKeyMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andKeyMostI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_andKeyLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andKeyLeastI(const rbTree<K,D> &);
-
-		rbTree<K,D> rbt_andData(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andDataI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_andDataMost(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andDataMostI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_andDataLeast(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_andDataLeastI(const rbTree<K,D> &);
+		rbTree<K,D,C> operator|(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &operator|=(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_or(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> operator|(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &operator|=(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_or(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &rbt_orI(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_orLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orLeastI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_orMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orMostI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_orKey(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orKeyI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_orKeyLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orKeyLeastI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_orKeyMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orKeyMostI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_orData(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orDataI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_orDataLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orDataLeastI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_orDataMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_orDataMostI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> operator^(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &operator^=(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_xor(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> operator^(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &operator^=(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_xor(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &rbt_xorI(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_xorLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorLeastI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_xorMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorMostI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_xorKey(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorKeyI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_xorKeyLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorKeyLeastI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_xorKeyMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorKeyMostI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_xorData(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorDataI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_xorDataLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorDataLeastI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_xorDataMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_xorDataMostI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> operator&(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &operator&=(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_and(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> operator&(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &operator&=(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_and(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &rbt_andI(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_andMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andMostI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_andLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andLeastI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_andKey(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andKeyI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_andKeyMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andKeyMostI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_andKeyLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andKeyLeastI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_andData(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andDataI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_andDataMost(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andDataMostI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_andDataLeast(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_andDataLeastI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> rbt_orParallel(const rbTree<K,D,C> &, size_t = 0) const;
+		rbTree<K,D,C> &rbt_orParallelI(const rbTree<K,D,C> &, size_t = 0);
+		rbTree<K,D,C> rbt_xorParallel(const rbTree<K,D,C> &, size_t = 0) const;
+		rbTree<K,D,C> &rbt_xorParallelI(const rbTree<K,D,C> &, size_t = 0);
+		rbTree<K,D,C> rbt_andParallel(const rbTree<K,D,C> &, size_t = 0) const;
+		rbTree<K,D,C> &rbt_andParallelI(const rbTree<K,D,C> &, size_t = 0);
 
 				// TREE BASIC OPERATIONS
-		rbTree<K,D> operator+(const rbTree<K,D> &) const;
-		rbTree<K,D> operator+=(const rbTree<K,D> &);
-		rbTree<K,D> rbt_add(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_addI(const rbTree<K,D> &);
-
-		rbTree<K,D> operator-(const rbTree<K,D> &) const;
-		rbTree<K,D> operator-=(const rbTree<K,D> &);
-		rbTree<K,D> rbt_sub(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_subI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_subKeys(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_subKeysI(const rbTree<K,D> &);
-		rbTree<K,D> rbt_subData(const rbTree<K,D> &) const;
-		rbTree<K,D> rbt_subDataI(const rbTree<K,D> &);
-
-		rbTree<K,D> operator*(const size_t &val) const;
-		rbTree<K,D> operator*=(const size_t &val);
-		rbTree<K,D> rbt_mul(const size_t &val) const;
-		rbTree<K,D> rbt_mulI(const size_t &val);
+		rbTree<K,D,C> operator+(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &operator+=(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_add(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_addI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> operator+(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &operator+=(rbTree<K,D,C> &&);
+		rbTree<K,D,C> rbt_add(rbTree<K,D,C> &&) const;
+		rbTree<K,D,C> &rbt_addI(rbTree<K,D,C> &&);
+
+		rbTree<K,D,C> operator-(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &operator-=(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_sub(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_subI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_subParallel(const rbTree<K,D,C> &, size_t = 0) const;
+		rbTree<K,D,C> &rbt_subParallelI(const rbTree<K,D,C> &, size_t = 0);
+		rbTree<K,D,C> rbt_subKeys(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_subKeysI(const rbTree<K,D,C> &);
+		rbTree<K,D,C> rbt_subData(const rbTree<K,D,C> &) const;
+		rbTree<K,D,C> &rbt_subDataI(const rbTree<K,D,C> &);
+
+		rbTree<K,D,C> operator*(const size_t &val) const;
+		rbTree<K,D,C> &operator*=(const size_t &val);
+		rbTree<K,D,C> rbt_mul(const size_t &val) const;
+		rbTree<K,D,C> &rbt_mulI(const size_t &val);
 
 				// TREE ADVANCED OPERATIONS 
-		rbTree<K,D> rbt_invert();
-		rbTree<K,D> rbt_invertI();
-		rbTree<K,D> *rbt_distribute(size_t, enum rbtraversal = LEVEL_ORDER);
-		rbTree<K,D> *rbt_distribute_shallow(size_t, enum rbtraversal = LEVEL_ORDER);
-		rbTree<K,D> *rbt_scatter(size_t, enum rbtraversal = LEVEL_ORDER);
-		rbTree<K,D> *rbt_scatter_shallow(size_t, enum rbtraversal = LEVEL_ORDER);
+		rbTree<K,D,C> rbt_invert();
+		rbTree<K,D,C> &rbt_invertI();
+		rbTree<K,D,C> *rbt_distribute(size_t, enum rbtraversal = LEVEL_ORDER);
+		rbTree<K,D,C> *rbt_distribute_shallow(size_t, enum rbtraversal = LEVEL_ORDER);
+		rbTree<K,D,C> *rbt_scatter(size_t, enum rbtraversal = LEVEL_ORDER);
+		rbTree<K,D,C> *rbt_scatter_shallow(size_t, enum rbtraversal = LEVEL_ORDER);
+		std::pair<rbTree<K,D,C>, rbTree<K,D,C>> rbt_split(K);
+		static rbTree<K,D,C> rbt_join(rbTree<K,D,C> &&, K, D, rbTree<K,D,C> &&);
+		static rbTree<K,D,C> rbt_concat(rbTree<K,D,C> &&, rbTree<K,D,C> &&);
 
 			// RBT_limit
 		void rbt_clamp(K, K, D, D);
@@ -503,21 +837,189 @@ class rbTree {
 
 			// RBT_string
 		std::string rbt_string(enum rbtraversal = IN_ORDER, size_t = 0) const;
-		template <K, D>
-			friend std::ostream& operator<<(std::ostream &, rbTree<K,D> &);
+		template <typename T, typename U, typename V>
+			friend std::ostream& operator<<(std::ostream &, rbTree<T,U,V> &);
+};
+
+
+/*     Node Comparison, Chosen at Compile Time     */
+template <typename K, typename D, enum rbtsort sort, typename C>
+struct rbtNodeCompair {
+	inline bool operator()(rbtNode<K,D> *, rbtNode<K,D> *) const;
+};
+
+/*     Concurrent Tree Wrapper     */
+template <typename K, typename D, typename C>
+class rbtConcurrentTree {
+		// A single queued write, waiting to be applied to the tree
+	struct rbtWrite {
+		K key;
+		D data;
+		enum {INSERT, DELETE, DELETE_KEY} type;
+	};
+
+		// Base Variables
+	rbTree<K,D,C> tree;
+	mutable std::shared_mutex treeLock;
+	std::mutex queueLock;
+	std::vector<rbtWrite> pending;
+
+	// Private Functions
+		// RBT_concurrent
+	void enqueue(const rbtWrite *, const rbtWrite *);
+	void flush();
+	inline bool batchable(size_t) const;
+	void applyInserts(rbtWrite *, rbtWrite *);
+	void applyDeletes(rbtWrite *, rbtWrite *);
+	void applyDeleteKeys(rbtWrite *, rbtWrite *);
+
+	public:
+		// Constructors
+			// RBT_concurrent
+		rbtConcurrentTree();
+		rbtConcurrentTree(const rbTree<K,D,C> &);
+		rbtConcurrentTree(rbTree<K,D,C> &&);
+		rbtConcurrentTree(const rbtConcurrentTree<K,D,C> &) = delete;
+
+		// Public Concurrent Functions
+			// RBT_concurrent
+		void operator=(const rbtConcurrentTree<K,D,C> &) = delete;
+
+				// Shared (reader) operations
+		size_t rbt_getSize() const;
+		bool rbt_searchKey(K, D &) const;
+		bool rbt_search(K, D) const;
+		bool rbt_nodeAt(size_t, K &, D &) const;
+		size_t rbt_findIdxKey(K) const;
+		size_t rbt_countKey(K) const;
+		size_t rbt_countRange(K, K) const;
+		typename rbtAggregate<K,D>::type rbt_aggregate(K, K) const;
+		rbTree<K,D,C> rbt_snapshot() const;
+		template <typename F>
+			auto rbt_read(F) const;
+
+				// Exclusive (writer) operations
+		void rbt_insert(K, D);
+		void rbt_delete(K, D);
+		void rbt_deleteKey(K);
+		void rbt_repInsert(size_t, K *, D *);
+		void rbt_repDelete(size_t, K *, D *);
+		template <typename F>
+			auto rbt_write(F);
+};
+
+
+/*     Snapshot (Epoch-Reclaimed) Tree     */
+template <typename K, typename D, typename C>
+class rbtSnapshotTree {
+		// An immutable, path-copied node. Published nodes are never written again
+	struct rbtSnapNode {
+		rbtSnapNode *left, *right;
+		K key;
+		D data;
+		size_t descendants;
+		bool color;
+	};
+
+		// A reader's announced epoch, on its own cache line (0 when the slot is free)
+	struct alignas(64) rbtEpochSlot {
+		std::atomic<uint64_t> epoch;
+	};
+
+		// Holds a reader slot for as long as it is in scope
+	class rbtEpochGuard {
+		const rbtSnapshotTree<K,D,C> *owner;
+		size_t slot;
+
+		public:
+			rbtEpochGuard(const rbtSnapshotTree<K,D,C> *);
+			~rbtEpochGuard();
+	};
+
+		// Base Variables
+	std::atomic<rbtSnapNode *> root;
+	std::atomic<uint64_t> epoch;
+	std::unique_ptr<rbtEpochSlot[]> slots;
+	size_t slotCount;
+
+		// Writer Variables (guarded by writeLock)
+	std::mutex writeLock;
+	std::vector<rbtSnapNode *> garbage;
+	std::vector<std::pair<uint64_t, rbtSnapNode *>> retired;
+
+	// Private Functions
+		// RBT_snapshot
+	size_t enter() const;
+	void leave(size_t) const;
+
+	static inline size_t count(const rbtSnapNode *);
+	static inline bool isRed(const rbtSnapNode *);
+	static inline bool isBlack(const rbtSnapNode *);
+	inline rbtSnapNode *make(bool, rbtSnapNode *, const K &, const D &, rbtSnapNode *);
+	inline void retire(rbtSnapNode *);
+	void publish(rbtSnapNode *);
+	void reclaim();
+	static void destroy(rbtSnapNode *);
+
+	rbtSnapNode *balance(rbtSnapNode *, const K &, const D &, rbtSnapNode *);
+	rbtSnapNode *balanceLeft(rbtSnapNode *, const K &, const D &, rbtSnapNode *);
+	rbtSnapNode *balanceRight(rbtSnapNode *, const K &, const D &, rbtSnapNode *);
+	rbtSnapNode *redden(rbtSnapNode *);
+	rbtSnapNode *blacken(rbtSnapNode *);
+	rbtSnapNode *append(rbtSnapNode *, rbtSnapNode *);
+	rbtSnapNode *insertBase(rbtSnapNode *, const K &, const D &);
+	template <typename F>
+		rbtSnapNode *deleteBase(rbtSnapNode *, F);
+
+	template <typename F>
+		static const rbtSnapNode *find(const rbtSnapNode *, F);
+	template <typename F>
+		static void rangeBase(const rbtSnapNode *, const K &, const K &, F &);
+
+	public:
+		// Constructors
+			// RBT_snapshot
+		rbtSnapshotTree(size_t = 64);
+		rbtSnapshotTree(const rbtSnapshotTree<K,D,C> &) = delete;
+		~rbtSnapshotTree();
+
+		// Public Snapshot Functions
+			// RBT_snapshot
+		void operator=(const rbtSnapshotTree<K,D,C> &) = delete;
+
+				// Lock-free (reader) operations
+		size_t rbt_getSize() const;
+		bool rbt_searchKey(K, D &) const;
+		bool rbt_search(K, D) const;
+		bool rbt_nodeAt(size_t, K &, D &) const;
+		template <typename F>
+			void rbt_forRange(K, K, F) const;
+		rbTree<K,D,C> rbt_snapshot() const;
+
+				// Serialized (writer) operations
+		void rbt_insert(K, D);
+		bool rbt_delete(K, D);
+		bool rbt_deleteKey(K);
+		void rbt_clear();
+		size_t rbt_getRetired();
 };
 
 
 /*			Modules			*/
+#include	"RBT_pool.h"
+#include	"RBT_iterator.h"
 #include	"RBT_traversal.h"
 #include	"RBT_access.h"
 #include	"RBT_string.h"
 #include	"RBT_sort.h"
+#include	"RBT_index.h"
 #include	"RBT_indel.h"
 #include	"RBT_ops.h"
 #include	"RBT_setops.h"
 #include	"RBT_limit.h"
 #include	"RBT_value.h"
+#include	"RBT_concurrent.h"
+#include	"RBT_snapshot.h"
 
 #include	"../src/RBT_main.cpp"
 #endif /* _rbt_main_HEADER */
\ No newline at end of file
@@ -0,0 +1,5 @@
+#ifndef _rbt_pool_HEADER
+#define _rbt_pool_HEADER
+
+#include	"../src/RBT_pool.cpp"
+#endif /* _rbt_pool_HEADER */
\ No newline at end of file
@@ -0,0 +1,5 @@
+#ifndef _rbt_snapshot_HEADER
+#define _rbt_snapshot_HEADER
+
+#include	"../src/RBT_snapshot.cpp"
+#endif /* _rbt_snapshot_HEADER */
\ No newline at end of file
@@ -16,15 +16,6 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-	inline size_t *widths;
-
-		// External From 'RBT_sort.cpp'
-	template <typename K, typename D>
-	extern inline bool(*fooPtr)(rbtNode<K,D> *, rbtNode<K,D> *);
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                     	       TREE STATS                                   | */
@@ -36,8 +27,8 @@ namespace {
  * parameters: 			A node pointer to recursively count from
  * return value:		The red-black tree's height
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::getHeight(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::getHeight(rbtNode<K,D> *curr) const {
 		// Checks if current node has left branch
 	if(curr->left) {
 			// If so, checks if current node has right branch
@@ -70,8 +61,8 @@ size_t rbTree<K,D>::getHeight(rbtNode<K,D> *curr) const {
  * parameters: 			N/A
  * return value:		The red-black tree's height
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getHeightExact() const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getHeightExact() const {
 	return root ? getHeight(root) : 0;
 }
 
@@ -80,8 +71,8 @@ size_t rbTree<K,D>::rbt_getHeightExact() const {
  * parameters: 			N/A
  * return value:		The red-black tree's maximum height
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getHeight() const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getHeight() const {
 		// Initializes values
 	size_t check = size, height = 0;
 
@@ -100,14 +91,14 @@ size_t rbTree<K,D>::rbt_getHeight() const {
  * parameters: 			Variable to return the length of the outputted array in
  * return value:		An array of size_t widths, for each level on the red-black tree
 */
-template <typename K, typename D>
-size_t *rbTree<K,D>::rbt_getWidths(size_t &len) const {
+template <typename K, typename D, typename C>
+size_t *rbTree<K,D,C>::rbt_getWidths(size_t &len) const {
 		// Checks if the root exists
 	if (root) {
 			// If so, get the widths on all levels
 		len = rbt_getHeightExact();
-		widths = new size_t[len]();
-		getWidth(root, 0);
+		size_t *widths = new size_t[len]();
+		getWidth(root, 0, widths);
 
 			// Returns the array of widths
 		return widths;
@@ -118,17 +109,17 @@ size_t *rbTree<K,D>::rbt_getWidths(size_t &len) const {
 
 /*
  * function_identifier: Returns the width of the current red-black tree (used by rbt_getWidthExact())
- * parameters: 			A node pointer to recursively count from and the current level
+ * parameters: 			A node pointer to recursively count from, the current level, and the array of widths to count into
  * return value:		The red-black tree's width
 */
-template <typename K, typename D>
-void rbTree<K,D>::getWidth(rbtNode<K,D> *curr, size_t level) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::getWidth(rbtNode<K,D> *curr, size_t level, size_t *widths) const {
 		// Recursively calls the function again on the left child, if it exists
-	if(curr->left) getWidth(curr->left, level + 1);
-		// Increases the recorded width, of this level, in the global variable
+	if(curr->left) getWidth(curr->left, level + 1, widths);
+		// Increases the recorded width, of this level, in the widths array
 	widths[level]++;
 		// Recursively calls the function again on the right child, if it exists
-	if(curr->right) getWidth(curr->right, level + 1);
+	if(curr->right) getWidth(curr->right, level + 1, widths);
 }
 
 /*
@@ -136,11 +127,11 @@ void rbTree<K,D>::getWidth(rbtNode<K,D> *curr, size_t level) const {
  * parameters: 			N/A
  * return value:		The red-black tree's maximum width
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getWidthExact() const {
-	size_t len;
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getWidthExact() const {
+	size_t len, *widths;
 		// Gets an array of size_t widths, for each level on the red-black tree
-	if (!rbt_getWidths(len))
+	if (!(widths = rbt_getWidths(len)))
 		// returns 0 if no array was possible to recreate
 		return 0;
 
@@ -162,8 +153,8 @@ size_t rbTree<K,D>::rbt_getWidthExact() const {
  * parameters: 			N/A
  * return value:		The red-black tree's maximum width
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getWidth() const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getWidth() const {
 	return (size >> 1) + 1;
 }
 
@@ -173,8 +164,8 @@ size_t rbTree<K,D>::rbt_getWidth() const {
  * parameters: 			A node pointer to recursively count from
  * return value:		The leaf node count from the provided curr node pointer
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::getLeafNodes(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::getLeafNodes(rbtNode<K,D> *curr) const {
 		// Checks if current node has left branch
 	if(curr->left) {
 			// If so, checks if current node has right branch
@@ -197,8 +188,8 @@ size_t rbTree<K,D>::getLeafNodes(rbtNode<K,D> *curr) const {
  * parameters: 			N/A
  * return value:		The red-black tree's leaf node count
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getLeafNodes() const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getLeafNodes() const {
 	return root ? getLeafNodes(root) : 0;
 }
 
@@ -207,8 +198,8 @@ size_t rbTree<K,D>::rbt_getLeafNodes() const {
  * parameters: 			N/A
  * return value:		The red-black tree's inner node count
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getInnerNodes() const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getInnerNodes() const {
 	return root ? size - getLeafNodes(root) : 0;
 }
 
@@ -223,8 +214,8 @@ size_t rbTree<K,D>::rbt_getInnerNodes() const {
  * parameters: 			A node pointer
  * return value:		The idex of the node
 */
-template <typename K, typename D>
-inline size_t rbTree<K,D>::findIdxBase(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::findIdxBase(rbtNode<K,D> *curr) const {
 		// If the node doesn't exist, give an error
 	if (!curr)
 		throw std::out_of_range("node with given key and data is not within Red-Black Tree'");
@@ -250,8 +241,8 @@ inline size_t rbTree<K,D>::findIdxBase(rbtNode<K,D> *curr) const {
  * parameters: 			Key and data values
  * return value:		The index value of a node in the red-black tree
 */
-template <typename K, typename D>
-inline size_t rbTree<K,D>::rbt_findIdx(K key, D data) const {
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::rbt_findIdx(K key, D data) const {
 	return findIdxBase(rbt_search(key, data));
 }
 
@@ -260,8 +251,8 @@ inline size_t rbTree<K,D>::rbt_findIdx(K key, D data) const {
  * parameters: 			A node
  * return value:		The index value of a node in the red-black tree
 */
-template <typename K, typename D>
-inline size_t rbTree<K,D>::rbt_findIdx(rbtNode<K,D> *target) const {
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::rbt_findIdx(rbtNode<K,D> *target) const {
 	return findIdxBase(rbt_search(target->key, target->data));
 }
 
@@ -270,8 +261,8 @@ inline size_t rbTree<K,D>::rbt_findIdx(rbtNode<K,D> *target) const {
  * parameters: 			Key value
  * return value:		The index value of a node in the red-black tree
 */
-template <typename K, typename D>
-inline size_t rbTree<K,D>::rbt_findIdxKey(K key) const {
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::rbt_findIdxKey(K key) const {
 	return findIdxBase(rbt_searchKey(key));
 }
 
@@ -280,8 +271,8 @@ inline size_t rbTree<K,D>::rbt_findIdxKey(K key) const {
  * parameters: 			Data value
  * return value:		The index value of a node in the red-black tree
 */
-template <typename K, typename D>
-inline size_t rbTree<K,D>::rbt_findIdxData(D data) const {
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::rbt_findIdxData(D data) const {
 	return findIdxBase(rbt_searchData(data));
 }
 
@@ -290,8 +281,8 @@ inline size_t rbTree<K,D>::rbt_findIdxData(D data) const {
  * parameters: 			The index of the node to locate
  * return value:		The node at the given index in the red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_nodeAt(size_t indx) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_nodeAt(size_t indx) const {
 		// If given an invaild index, throw error
 	if (indx >= size)
 		throw std::out_of_range("node index value '" + std::to_string(indx) + "' is not vaild in Red-Black Tree of size '" + std::to_string(size) + "'");
@@ -333,14 +324,15 @@ rbtNode<K,D> *rbTree<K,D>::rbt_nodeAt(size_t indx) const {
  * parameters: 			The requested key
  * return value:		A pointer to the node, with the given key value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_searchKey(K key) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_searchKey(K key) const {
 	rbtNode<K,D> *curr = root;
+	int cmp;
 	while(1) {
 			// Return curr if either key found or no node with key is in red-black tree
-		if (!curr || curr->key == key) return curr;
+		if (!curr || !(cmp = C::key(key, curr->key))) return curr;
 			// If key is less than current node's key, consider the current node's left child's key
-		if (key < curr->key) {
+		if (cmp < 0) {
 			curr = curr->left;
 			continue;
 		}
@@ -354,8 +346,8 @@ rbtNode<K,D> *rbTree<K,D>::rbt_searchKey(K key) const {
  * parameters: 			The node with a key value
  * return value:		A pointer to the node, with the given key value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_searchKey(rbtNode<K,D> *target) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_searchKey(rbtNode<K,D> *target) const {
 	return rbt_searchKey(target->key);
 }
 
@@ -364,8 +356,8 @@ rbtNode<K,D> *rbTree<K,D>::rbt_searchKey(rbtNode<K,D> *target) const {
  * parameters: 			N/A
  * return value:		A pointer to the node, with the largest key value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_maxKey() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_maxKey() const {
 		// If root doesn't exit, return NULL
 	if (!root)
 		return NULL;
@@ -385,8 +377,8 @@ rbtNode<K,D> *rbTree<K,D>::rbt_maxKey() const {
  * parameters: 			N/A
  * return value:		A pointer to the node, with the smallest key value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_minKey() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_minKey() const {
 		// If root doesn't exit, return NULL
 	if (!root)
 		return NULL;
@@ -408,10 +400,16 @@ rbtNode<K,D> *rbTree<K,D>::rbt_minKey() const {
  * parameters: 			The currently considered node and the requested data
  * return value:		A pointer to the node, with the given data value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::searchData(rbtNode<K,D> *curr, D data) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::searchData(rbtNode<K,D> *curr, D data) const {
+#ifdef RBT_DATA_BOUNDS
+		// Skips the branch if the data is outside of its bounds
+	if (C::data(data, curr->minData->data) < 0 || C::data(data, curr->maxData->data) > 0)
+		return NULL;
+#endif
+
 		// Returns curr node if data is found
-	if (curr->data == data)
+	if (C::data(curr->data, data) == 0)
 		return curr;
 
 		// Initializes needed variables
@@ -437,10 +435,17 @@ rbtNode<K,D> *rbTree<K,D>::searchData(rbtNode<K,D> *curr, D data) const {
  * parameters: 			The requested data
  * return value:		A pointer to the node, with the given data value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_searchData(D data) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_searchData(D data) const {
+#ifdef RBT_DATA_INDEX
+		// Finds the first node, in the data index, that doesn't have a smaller data
+	rbtNode<K,D> *node;
+	dataRankBase(data, false, &node);
+	return node && C::data(node->data, data) == 0 ? node : NULL;
+#else
 		// Return search result for the data, or NULL if the red-black tree is empty
 	return root ? searchData(root, data) : NULL;
+#endif
 }
 
 /*
@@ -448,88 +453,20 @@ rbtNode<K,D> *rbTree<K,D>::rbt_searchData(D data) const {
  * parameters: 			A node with data 
  * return value:		A pointer to the node, with the given data value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_searchData(rbtNode<K,D> *target) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_searchData(rbtNode<K,D> *target) const {
 	return rbt_searchData(target->data);
 }
 
-/*
- * function_identifier: Finds the node, in a given red-black tree, with the largest data value (used by rbt_maxData())
- * parameters: 			The currently considered node
- * return value:		A pointer to the node, with the largest data value, in the given red-black tree
-*/
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::dataMax(rbtNode<K,D> *curr) const {
-		// Initializes needed variables
-	rbtNode<K,D> *maxNode = curr;
-
-		// Checks if left branch exists
-	if (curr->left) {
-			// If so, compair the largest data value, on the left branch, with the current node's data value
-		maxNode = dataMax(curr->left);
-		if (maxNode->data < curr->data)
-				// If maxNode < curr, set the maxNode to be curr
-			maxNode = curr;
-		else
-				// Else, set curr for next check
-			curr = maxNode;
-	}
-		// Checks if right branch exists
-	if (curr->right) {
-			// If so, compair the largest data value, on the left branch, with the current node's data value
-		maxNode = dataMax(curr->right);
-		if (maxNode->data < curr->data)
-				// If maxNode < curr, set the maxNode to be curr
-			maxNode = curr;
-	}
-
-		// Finally, return the maximum
-	return maxNode;
-}
-
 /*
  * function_identifier: Finds the node, in a given red-black tree, with the largest data value
  * parameters: 			N/A
  * return value:		A pointer to the node, with the largest data value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_maxData() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_maxData() const {
 		// Return max-data node, or NULL if the red-black tree is empty
-	return root ? dataMax(root) : NULL;
-}
-
-/*
- * function_identifier: Finds the node, in a given red-black tree, with the smallest data value (used by rbt_minData())
- * parameters: 			The currently considered node
- * return value:		A pointer to the node, with the smallest data value, in the given red-black tree
-*/
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::dataMin(rbtNode<K,D> *curr) const {
-		// Initializes needed variables
-	rbtNode<K,D> *minNode = curr;
-
-		// Checks if left branch exists
-	if (curr->left) {
-			// If so, compair the smallest data value, on the left branch, with the current node's data value
-		minNode = dataMin(curr->left);
-		if (minNode->data > curr->data)
-				// If minNode > curr, set the minNode to be curr
-			minNode = curr;
-		else
-				// Else, set curr for next checking
-			curr = minNode;
-	}
-		// Checks if right branch exists
-	if (curr->right) {
-			// If so, compair the smallest data value, on the left branch, with the current node's data value
-		minNode = dataMin(curr->right);
-		if (minNode->data > curr->data)
-				// If minNode > curr, set the minNode to be curr
-			minNode = curr;
-	}
-
-		// Finally, return the minimum
-	return minNode;
+	return rbt_maxData_maxKey();
 }
 
 /*
@@ -537,10 +474,10 @@ rbtNode<K,D> *rbTree<K,D>::dataMin(rbtNode<K,D> *curr) const {
  * parameters: 			N/A
  * return value:		A pointer to the node, with the smallest data value, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_minData() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_minData() const {
 		// Return min-data node, or NULL if the red-black tree is empty
-	return root ? dataMin(root) : NULL;
+	return rbt_minData_minKey();
 }
 
 	/*		DATA KEYS	  */
@@ -550,10 +487,10 @@ rbtNode<K,D> *rbTree<K,D>::rbt_minData() const {
  * parameters: 			The currently considered node as well as the data and key values to search for
  * return value:		A pointer to the node, with the given key and data values, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::search(rbtNode<K,D> *curr, K key, D data) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::search(rbtNode<K,D> *curr, K key, D data) const {
 		// If this node has the data criteria, then return this node
-	if (curr->data == data)
+	if (C::data(curr->data, data) == 0)
 		return curr;
 
 		// Else, initialize a temp variable
@@ -561,12 +498,12 @@ rbtNode<K,D> *rbTree<K,D>::search(rbtNode<K,D> *curr, K key, D data) const {
 
 		// Checks if the left branch both exists and has the correct key
 			// If so, search that branch for the data
-	if (curr->left && curr->left->key == key)
+	if (curr->left && C::key(curr->left->key, key) == 0)
 		curr2 = search(curr->left, key, data);
 
 		// If no node not yet found, then check if the right branch both exists and has the correct key
 			// If so, search that branch for the data
-	else if (curr->right && curr->right->key == key)
+	else if (curr->right && C::key(curr->right->key, key) == 0)
 		curr2 = search(curr->right, key, data);
 		// Return whatever is found
 	return curr2;
@@ -577,8 +514,8 @@ rbtNode<K,D> *rbTree<K,D>::search(rbtNode<K,D> *curr, K key, D data) const {
  * parameters: 			The data and key values to search for
  * return value:		A pointer to the node, with the given key and data values, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_search(K key, D data) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_search(K key, D data) const {
 		// Initializes needed variable
 	rbtNode<K,D> *curr;
 
@@ -595,8 +532,8 @@ rbtNode<K,D> *rbTree<K,D>::rbt_search(K key, D data) const {
  * parameters: 			A node with data and key values to search for
  * return value:		A pointer to the node, with the given key and data values, in the given red-black tree
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_search(rbtNode<K,D> *target) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_search(rbtNode<K,D> *target) const {
 	return rbt_search(target->key, target->data);
 }
 
@@ -606,8 +543,8 @@ rbtNode<K,D> *rbTree<K,D>::rbt_search(rbtNode<K,D> *target) const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_maxKey_maxData() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_maxKey_maxData() const {
 	return rbt_maxKey();
 }
 
@@ -617,18 +554,18 @@ rbtNode<K,D> *rbTree<K,D>::rbt_maxKey_maxData() const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::key_minData(rbtNode<K,D> *curr, K key) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::key_minData(rbtNode<K,D> *curr, K key) const {
 	rbtNode<K,D> *curr2 = curr, *temp;
 
 	if (curr->left){
 		temp = key_minData(curr->left, key);
-		if (temp->key == key && curr2->data > temp->data)
+		if (C::key(temp->key, key) == 0 && C::data(curr2->data, temp->data) > 0)
 			curr2 = temp;
 	}
 	if (curr->right) {
 		temp = key_minData(curr->right, key);
-		if (temp->key == key && curr2->data > temp->data)
+		if (C::key(temp->key, key) == 0 && C::data(curr2->data, temp->data) > 0)
 			curr2 = temp;
 	}
 
@@ -641,13 +578,13 @@ rbtNode<K,D> *rbTree<K,D>::key_minData(rbtNode<K,D> *curr, K key) const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_maxKey_minData() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_maxKey_minData() const {
 	rbtNode<K,D> *curr = root;
 
 	while(curr->right)
 		curr = curr->right;
-	while(curr->parent && curr->parent->key == curr->key)
+	while(curr->parent && C::key(curr->parent->key, curr->key) == 0)
 		curr = curr->parent;
 	return key_minData(curr, curr->key);
 }
@@ -658,18 +595,18 @@ rbtNode<K,D> *rbTree<K,D>::rbt_maxKey_minData() const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::key_maxData(rbtNode<K,D> *curr, K key) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::key_maxData(rbtNode<K,D> *curr, K key) const {
 	rbtNode<K,D> *curr2 = curr, *temp;
 
 	if (curr->left){
 		temp = key_maxData(curr->left, key);
-		if (temp->key == key && curr2->data < temp->data)
+		if (C::key(temp->key, key) == 0 && C::data(curr2->data, temp->data) < 0)
 			curr2 = temp;
 	}
 	if (curr->right) {
 		temp = key_maxData(curr->right, key);
-		if (temp->key == key && curr2->data < temp->data)
+		if (C::key(temp->key, key) == 0 && C::data(curr2->data, temp->data) < 0)
 			curr2 = temp;
 	}
 
@@ -682,13 +619,13 @@ rbtNode<K,D> *rbTree<K,D>::key_maxData(rbtNode<K,D> *curr, K key) const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_minKey_maxData() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_minKey_maxData() const {
 	rbtNode<K,D> *curr = root;
 
 	while(curr->left)
 		curr = curr->left;
-	while(curr->parent && curr->parent->key == curr->key)
+	while(curr->parent && C::key(curr->parent->key, curr->key) == 0)
 		curr = curr->parent;
 	return key_maxData(curr, curr->key);
 }
@@ -699,28 +636,75 @@ rbtNode<K,D> *rbTree<K,D>::rbt_minKey_maxData() const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_minKey_minData() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_minKey_minData() const {
 	return rbt_minKey();
 }
 
+/*
+ * function_identifier: Walks the red-black tree in order, keeping the node preferred by the data comparison (used by
+ *						the 'rbt_*Data_*Key' functions). Keys only rise along the walk, so later nodes win key ties
+ * parameters: 			A function that, given how a node's data compares to the kept node's data, returns if the node is preferred
+ * return value:		An rbtNode pointer (NULL if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+inline rbtNode<K,D> *rbTree<K,D,C>::dataScanBase(F foo) const {
+		// If root doesn't exit, return NULL
+	if (!root)
+		return NULL;
+
+		// Steps through the nodes with an iterator, so no node array is needed
+	iterator it(rbt_minKey(), root), ed(NULL, root);
+	rbtNode<K,D> *curr = &*it;
+	while(++it != ed)
+		if (foo(C::data(it->data, curr->data)))
+			curr = &*it;
+
+	return curr;
+}
+
+/*
+ * function_identifier: Finds the first or last node, in order, holding the tree's smallest or largest data, by only
+ *						entering branches whose data bounds reach it (used by the 'rbt_*Data_*Key' functions)
+ * parameters: 			A function that returns a branch's bound node (its min or max data node), and if the last
+ *						node should be found, rather than the first
+ * return value:		An rbtNode pointer (NULL if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+inline rbtNode<K,D> *rbTree<K,D,C>::dataEdgeBase(F bound, bool last) const {
+		// If root doesn't exist, return NULL
+	if (!root)
+		return NULL;
+
+		// Descends towards the wanted end, only leaving it when the branch there can't hold the data
+	rbtNode<K,D> *curr = root, *branch;
+	const D &data = bound(root)->data;
+	while(true) {
+		branch = last ? curr->right : curr->left;
+		if (branch && C::data(bound(branch)->data, data) == 0)
+			curr = branch;
+		else if (C::data(curr->data, data) == 0)
+			return curr;
+		else
+			curr = last ? curr->left : curr->right;
+	}
+}
+
 /*
  * function_identifier: Finds all nodes with the max data and then returns the node, among those, with
  *						the max key
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_maxData_maxKey() const {
-	rbtNode<K,D> *curr, **rbtNodes = rbt_getAllNodes();
-	
-	fooPtr<K,D> = dataKeyCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
-	curr = rbtNodes[size - 1];
-
-	delete [] rbtNodes;
-
-	return curr;
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_maxData_maxKey() const {
+#ifdef RBT_DATA_BOUNDS
+	return root ? root->maxData : NULL;
+#else
+	return dataScanBase([] (int cmp) -> bool {return cmp >= 0;});
+#endif
 }
 
 /*
@@ -729,25 +713,13 @@ rbtNode<K,D> *rbTree<K,D>::rbt_maxData_maxKey() const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_minData_maxKey() const {
-	rbtNode<K,D> *curr, **rbtNodes = rbt_getAllNodes();
-	
-	fooPtr<K,D> = dataKeyCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
-
-	curr = rbtNodes[0];
-	for(size_t idx = 0; idx <= size; idx++)
-		if (idx == size)
-			curr = rbtNodes[idx];
-		else if (curr->key != rbtNodes[idx]->key) {
-			curr = rbtNodes[idx];
-			break;
-		}
-
-	delete [] rbtNodes;
-
-	return curr;
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_minData_maxKey() const {
+#ifdef RBT_DATA_BOUNDS
+	return dataEdgeBase([] (rbtNode<K,D> *curr) -> rbtNode<K,D> * {return curr->minData;}, true);
+#else
+	return dataScanBase([] (int cmp) -> bool {return cmp <= 0;});
+#endif
 }
 
 /*
@@ -756,25 +728,13 @@ rbtNode<K,D> *rbTree<K,D>::rbt_minData_maxKey() const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_maxData_minKey() const {
-	rbtNode<K,D> *curr, **rbtNodes = rbt_getAllNodes();
-	
-	fooPtr<K,D> = dataKeyCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
-
-	curr = rbtNodes[size - 1];
-	for(size_t idx = size - 1; idx != (size_t)-1; idx--)
-		if (idx == (size_t)-1)
-			curr = rbtNodes[idx];
-		else if (curr->key != rbtNodes[idx]->key) {
-			curr = rbtNodes[idx];
-			break;
-		}
-
-	delete [] rbtNodes;
-
-	return curr;
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_maxData_minKey() const {
+#ifdef RBT_DATA_BOUNDS
+	return dataEdgeBase([] (rbtNode<K,D> *curr) -> rbtNode<K,D> * {return curr->maxData;}, false);
+#else
+	return dataScanBase([] (int cmp) -> bool {return cmp > 0;});
+#endif
 }
 
 /*
@@ -783,17 +743,285 @@ rbtNode<K,D> *rbTree<K,D>::rbt_maxData_minKey() const {
  * parameters: 			N/A
  * return value:		An rbtNode pointer
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_minData_minKey() const {
-	rbtNode<K,D> *curr, **rbtNodes = rbt_getAllNodes();
-	
-	fooPtr<K,D> = dataKeyCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
-	curr = rbtNodes[0];
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_minData_minKey() const {
+#ifdef RBT_DATA_BOUNDS
+	return root ? root->minData : NULL;
+#else
+	return dataScanBase([] (int cmp) -> bool {return cmp < 0;});
+#endif
+}
 
-	delete [] rbtNodes;
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                     	          BOUNDS                                    | */
+/* |                                                                            | */
+/*	============================================================================  */
 
-	return curr;
+/*
+ * function_identifier: Finds the first node, in order, that is at or past a bound (used by the bound functions)
+ *						Takes one path down the red-black tree, so O(log(N))
+ * parameters: 			A function that checks if a node is at or past the bound
+ * return value:		A pointer to the node (NULL if no node is at or past the bound)
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+inline rbtNode<K,D> *rbTree<K,D,C>::boundBase(F foo) const {
+	rbtNode<K,D> *curr = root, *bound = NULL;
+	while(curr)
+			// If curr is at or past the bound, it is the best so far, and an earlier one can only be on the left
+		if (foo(curr)) {
+			bound = curr;
+			curr = curr->left;
+		}
+		else
+			curr = curr->right;
+	return bound;
+}
+
+/*
+ * function_identifier: Finds the first node, in order, with a key not less than the given key
+ * parameters: 			A key
+ * return value:		An iterator at the node (the end iterator if there is no such node)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::iterator rbTree<K,D,C>::rbt_lowerBound(K key) const {
+	return iterator(boundBase([&key] (rbtNode<K,D> *curr) -> bool {
+		return C::key(curr->key, key) >= 0;
+	}), root);
+}
+
+/*
+ * function_identifier: Finds the first node, in order, with a key and data not less than the given key and data
+ * parameters: 			A key and a data value
+ * return value:		An iterator at the node (the end iterator if there is no such node)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::iterator rbTree<K,D,C>::rbt_lowerBound(K key, D data) const {
+	return iterator(boundBase([&key, &data] (rbtNode<K,D> *curr) -> bool {
+		int cmp = C::key(curr->key, key);
+		return (cmp > 0 || (!cmp && C::data(curr->data, data) >= 0));
+	}), root);
+}
+
+/*
+ * function_identifier: Finds the first node, in order, with a key greater than the given key
+ * parameters: 			A key
+ * return value:		An iterator at the node (the end iterator if there is no such node)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::iterator rbTree<K,D,C>::rbt_upperBound(K key) const {
+	return iterator(boundBase([&key] (rbtNode<K,D> *curr) -> bool {
+		return C::key(curr->key, key) > 0;
+	}), root);
+}
+
+/*
+ * function_identifier: Finds the first node, in order, with a key and data greater than the given key and data
+ * parameters: 			A key and a data value
+ * return value:		An iterator at the node (the end iterator if there is no such node)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::iterator rbTree<K,D,C>::rbt_upperBound(K key, D data) const {
+	return iterator(boundBase([&key, &data] (rbtNode<K,D> *curr) -> bool {
+		int cmp = C::key(curr->key, key);
+		return (cmp > 0 || (!cmp && C::data(curr->data, data) > 0));
+	}), root);
+}
+
+/*
+ * function_identifier: Finds all nodes with the given key, as the range [first, second)
+ * parameters: 			A key
+ * return value:		A pair of iterators (the lower and upper bounds of the key)
+*/
+template <typename K, typename D, typename C>
+std::pair<typename rbTree<K,D,C>::iterator, typename rbTree<K,D,C>::iterator> rbTree<K,D,C>::rbt_equalRange(K key) const {
+	return std::make_pair(rbt_lowerBound(key), rbt_upperBound(key));
+}
+
+/*
+ * function_identifier: Finds all nodes with the given key and data, as the range [first, second)
+ * parameters: 			A key and a data value
+ * return value:		A pair of iterators (the lower and upper bounds of the key and data)
+*/
+template <typename K, typename D, typename C>
+std::pair<typename rbTree<K,D,C>::iterator, typename rbTree<K,D,C>::iterator> rbTree<K,D,C>::rbt_equalRange(K key, D data) const {
+	return std::make_pair(rbt_lowerBound(key, data), rbt_upperBound(key, data));
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                     	     ORDER STATISTICS                               | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Finds the index of a quantile, by the nearest-rank method (the smallest index with at least
+ *						that fraction of the nodes at or before it)
+ * parameters: 			A quantile, between 0 and 1
+ * return value:		The index of the quantile
+*/
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::quantileIdx(double quantile) const {
+		// If given an invaild quantile or an empty tree, throw error
+	if (!(quantile >= 0 && quantile <= 1) || !size)
+		throw std::out_of_range("quantile '" + std::to_string(quantile) + "' is not vaild in Red-Black Tree of size '" + std::to_string(size) + "'");
+
+	size_t idx = (size_t)std::ceil(quantile * size);
+	return idx ? std::min(idx, size) - 1 : 0;
+}
+
+/*
+ * function_identifier: Finds the nodes at a sorted list of indexes, in one shared descent (used by rbt_quantiles())
+ *						Each node on the way splits the indexes between its left branch, itself, and its right branch
+ * parameters: 			The root of a subtree, the index of the subtree's first node, the start and end of
+ *						the indexes that fall inside the subtree, and where to write their nodes
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::quantilesBase(rbtNode<K,D> *curr, size_t base, const size_t *idxS, const size_t *idxE, rbtNode<K,D> **nodePtr) const {
+	while(idxS != idxE) {
+			// Finds the current node's index, and which requested indexes are before, at, and after it
+		size_t at = base + (curr->left ? curr->left->descendants + 1 : 0);
+		const size_t *idxM = std::lower_bound(idxS, idxE, at), *idxA = std::upper_bound(idxM, idxE, at);
+
+			// Searches the left branch for the indexes before the current node
+		if (idxS != idxM)
+			quantilesBase(curr->left, base, idxS, idxM, nodePtr);
+		nodePtr += idxM - idxS;
+
+			// Answers the indexes at the current node
+		for(; idxM != idxA; idxM++)
+			*nodePtr++ = curr;
+
+			// Moves on to the right branch for the indexes after the current node
+		idxS = idxA;
+		base = at + 1;
+		curr = curr->right;
+	}
+}
+
+/*
+ * function_identifier: Finds the number of nodes with a key less than the given key
+ * parameters: 			A key
+ * return value:		The rank of the key (the index its first node has, or would have)
+*/
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_rank(K key) const {
+	return boundIdxBase(rbt_lowerBound(key));
+}
+
+/*
+ * function_identifier: Finds the number of nodes that are less than the given key and data
+ * parameters: 			A key and a data value
+ * return value:		The rank of the key and data (the index its first node has, or would have)
+*/
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_rank(K key, D data) const {
+	return boundIdxBase(rbt_lowerBound(key, data));
+}
+
+/*
+ * function_identifier: Finds the node at a quantile of the red-black tree, by the nearest-rank method
+ * parameters: 			A quantile, between 0 and 1 (0.99 is the 99th percentile)
+ * return value:		The node at the quantile
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_quantile(double quantile) const {
+	return rbt_nodeAt(quantileIdx(quantile));
+}
+
+/*
+ * function_identifier: Finds the median node of the red-black tree (the lower one, for an even size)
+ * parameters: 			N/A
+ * return value:		The median node
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_median() const {
+	return rbt_quantile(0.5);
+}
+
+/*
+ * function_identifier: Finds the nodes at many quantiles of the red-black tree, in one shared descent
+ *						Cheaper than calling rbt_quantile() for each one, since the paths down the tree are shared
+ * parameters: 			The number of quantiles, the quantiles (sorted, ascending), and an array to write the nodes to
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_quantiles(size_t arrayLength, const double *quantiles, rbtNode<K,D> **nodes) const {
+		// Ignores the trival case
+	if (!arrayLength)
+		return;
+
+		// Turns the quantiles into indexes, which must be sorted to share the descent
+	std::vector<size_t> idxs(arrayLength);
+	for(size_t i = 0; i < arrayLength; i++) {
+		if (i && quantiles[i] < quantiles[i - 1])
+			throw std::invalid_argument("quantiles must be sorted in ascending order");
+		idxs[i] = quantileIdx(quantiles[i]);
+	}
+
+	quantilesBase(root, 0, idxs.data(), idxs.data() + arrayLength, nodes);
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                     	        AGGREGATES                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Joins the aggregates of the nodes, in a subtree, with keys in a range (used by rbt_aggregate())
+ *						Once the range splits, each side follows one path, taking whole branches from the nodes
+ * parameters: 			The subtree's root, the start and end keys of the range, and if the subtree is known to
+ *						be past the start and before the end
+ * return value:		The aggregate
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::aggregator::type rbTree<K,D,C>::aggregateBase(rbtNode<K,D> *curr, const K &st, const K &ed, bool pastSt, bool beforeEd) const {
+		// Ignores the trival case
+	if (!curr)
+		return aggregator::identity();
+
+		// A subtree within the range is taken whole
+	if (pastSt && beforeEd)
+		return curr->aggregate;
+
+		// Skips the nodes before or after the range
+	if (!pastSt && C::key(curr->key, st) < 0)
+		return aggregateBase(curr->right, st, ed, pastSt, beforeEd);
+	if (!beforeEd && C::key(curr->key, ed) > 0)
+		return aggregateBase(curr->left, st, ed, pastSt, beforeEd);
+
+		// Else, the node is in the range. Joins the left branch, the node, and the right branch, in that order
+	return aggregator::combine(aggregator::combine(
+		aggregateBase(curr->left, st, ed, pastSt, true),
+		aggregator::lift(curr->key, curr->data)),
+		aggregateBase(curr->right, st, ed, true, beforeEd));
+}
+
+/*
+ * function_identifier: Gets the aggregate of the whole red-black tree, kept at the root
+ *						Needs rbtAggregate<K,D> to be specialized
+ * parameters: 			N/A
+ * return value:		The aggregate (the identity if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::aggregate_type rbTree<K,D,C>::rbt_aggregate() const {
+	static_assert(!std::is_same<aggregate_type, rbtNoAggregate>::value, "rbt_aggregate() needs a specialized rbtAggregate<K,D>");
+	return root ? root->aggregate : aggregator::identity();
+}
+
+/*
+ * function_identifier: Gets the aggregate of the nodes with a key between the two keys provided (inclusive), in O(log(N))
+ *						Needs rbtAggregate<K,D> to be specialized
+ * parameters: 			The start and end keys of a range
+ * return value:		The aggregate (the identity if no node is in the range)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::aggregate_type rbTree<K,D,C>::rbt_aggregate(K st, K ed) const {
+	static_assert(!std::is_same<aggregate_type, rbtNoAggregate>::value, "rbt_aggregate() needs a specialized rbtAggregate<K,D>");
+	return aggregateBase(root, st, ed, false, false);
 }
 
 #endif /* _rbt_ACCESS */
\ No newline at end of file
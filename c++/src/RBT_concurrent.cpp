@@ -0,0 +1,432 @@
+#ifndef _rbt_CONCURRENT
+#define _rbt_CONCURRENT
+#include	"RBT_main.h"
+#include	"RBT_concurrent.h"
+
+/*==============================================================================\
+ | Program:		Key-Data Red-Black Tree Implementation							|
+ | AUTHOR:		Xavier Alvarez 													|
+ | CREATE DATE:	15-January-2023 												|
+ | COPYRIGHT:	apache-2.0														|
+ | VERSION:		1.0																|
+ | DESCRIPTION:	A red-black semi-balanced binary search tree. Provides a		|
+ |				multitude of useful functions, including O(log(N)) lookup,		|
+ |				insert and delete operations.									|
+ \=============================================================================*/
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              CONSTRUCTORS                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Constructs an empty concurrent red-black tree
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtConcurrentTree<K,D,C>::rbtConcurrentTree() : tree() {}
+
+/*
+ * function_identifier: Constructs a concurrent red-black tree from a deep copy of the given tree
+ * parameters: 			The red-black tree to copy
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtConcurrentTree<K,D,C>::rbtConcurrentTree(const rbTree<K,D,C> &rbt) : tree(rbt) {}
+
+/*
+ * function_identifier: Constructs a concurrent red-black tree that takes over the given tree
+ * parameters: 			The red-black tree to take over
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtConcurrentTree<K,D,C>::rbtConcurrentTree(rbTree<K,D,C> &&rbt) : tree(std::move(rbt)) {}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              WRITE QUEUE                                   | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Queues writes, then applies every queued write under the exclusive lock
+ *						Writers that arrive while another writer holds the lock are applied by that writer,
+ *						so a burst of writers is coalesced into as few batches as possible
+ *						Returns only once the given writes are visible to readers
+ * parameters: 			The start and end of an array of writes
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::enqueue(const rbtWrite *writeS, const rbtWrite *writeE) {
+	{
+			// Queues the writes, in order
+		std::lock_guard<std::mutex> queued(queueLock);
+		pending.insert(pending.end(), writeS, writeE);
+	}
+
+		// Applies everything queued so far (may already have been done by another writer)
+	std::unique_lock<std::shared_mutex> exclusive(treeLock);
+	flush();
+}
+
+/*
+ * function_identifier: Applies all queued writes to the tree, grouping consecutive writes of the same type
+ *						Must be called while holding the exclusive lock
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::flush() {
+		// Takes all currently queued writes
+	std::vector<rbtWrite> writes;
+	{
+		std::lock_guard<std::mutex> queued(queueLock);
+		writes.swap(pending);
+	}
+
+		// Initializes the needed indexes
+	rbtWrite *writeS = writes.data(), *writeE = writeS + writes.size(), *writeM;
+
+		// Cycles through the queue, one run of same-typed writes at a time
+	while(writeS != writeE) {
+			// Finds the end of the current run
+		for(writeM = writeS + 1; writeM != writeE && writeM->type == writeS->type; writeM++);
+
+			// Applies the run
+		switch(writeS->type) {
+			case rbtWrite::INSERT:		applyInserts(writeS, writeM); break;
+			case rbtWrite::DELETE:		applyDeletes(writeS, writeM); break;
+			case rbtWrite::DELETE_KEY:	applyDeleteKeys(writeS, writeM); break;
+		}
+
+			// Moves forward to the next run
+		writeS = writeM;
+	}
+}
+
+/*
+ * function_identifier: Decides if a run of writes is worth a batch rebuild of the tree
+ *						A batch rebuild costs O(N) while single writes cost O(log(N)) each
+ * parameters: 			The number of writes in the run
+ * return value:		True if the run should be applied as one batch
+*/
+template <typename K, typename D, typename C>
+inline bool rbtConcurrentTree<K,D,C>::batchable(size_t len) const {
+		// Estimates the cost of applying each write by itself
+	size_t size = tree.rbt_getSize(), height = 1;
+	for(size_t i = size; i; i >>= 1)
+		height++;
+
+		// Batches when the single writes would touch about as many nodes as a rebuild
+	return len > 1 && len * height >= size;
+}
+
+/*
+ * function_identifier: Applies a run of queued inserts
+ * parameters: 			The start and end of the run
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::applyInserts(rbtWrite *writeS, rbtWrite *writeE) {
+	size_t len = writeE - writeS;
+
+		// Inserts small runs one by one
+	if (!batchable(len)) {
+		for(; writeS != writeE; writeS++)
+			tree.rbt_insert(writeS->key, writeS->data);
+		return;
+	}
+
+		// Otherwise, inserts the whole run with a single rebuild
+	K *keys = new K[len];
+	D *data = new D[len];
+	for(size_t i = 0; i < len; i++, writeS++) {
+		keys[i] = writeS->key;
+		data[i] = writeS->data;
+	}
+	tree.rbt_repInsert(len, keys, data);
+
+		// Clears the value arrays
+	delete [] keys;
+	delete [] data;
+}
+
+/*
+ * function_identifier: Applies a run of queued key and data deletes
+ * parameters: 			The start and end of the run
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::applyDeletes(rbtWrite *writeS, rbtWrite *writeE) {
+	size_t len = writeE - writeS;
+
+		// Deletes small runs one by one
+	if (!batchable(len)) {
+		for(; writeS != writeE; writeS++)
+			tree.rbt_delete(writeS->key, writeS->data);
+		return;
+	}
+
+		// Otherwise, deletes the whole run with a single rebuild
+	K *keys = new K[len];
+	D *data = new D[len];
+	for(size_t i = 0; i < len; i++, writeS++) {
+		keys[i] = writeS->key;
+		data[i] = writeS->data;
+	}
+	tree.rbt_repDelete(len, keys, data);
+
+		// Clears the value arrays
+	delete [] keys;
+	delete [] data;
+}
+
+/*
+ * function_identifier: Applies a run of queued key deletes
+ * parameters: 			The start and end of the run
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::applyDeleteKeys(rbtWrite *writeS, rbtWrite *writeE) {
+	size_t len = writeE - writeS;
+
+		// Deletes small runs one by one
+	if (!batchable(len)) {
+		for(; writeS != writeE; writeS++)
+			tree.rbt_deleteKey(writeS->key);
+		return;
+	}
+
+		// Otherwise, deletes the whole run with a single rebuild
+	K *keys = new K[len];
+	for(size_t i = 0; i < len; i++, writeS++)
+		keys[i] = writeS->key;
+	tree.rbt_repDeleteKey(len, keys);
+
+		// Clears the key array
+	delete [] keys;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                           SHARED OPERATIONS                                | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Returns the number of nodes in the red-black tree
+ * parameters: 			N/A
+ * return value:		The size of the red-black tree
+*/
+template <typename K, typename D, typename C>
+size_t rbtConcurrentTree<K,D,C>::rbt_getSize() const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return tree.rbt_getSize();
+}
+
+/*
+ * function_identifier: Finds a node with the given key and copies out its data
+ * parameters: 			The key to search for and a data value to write the result into (return by reference)
+ * return value:		True if a node with the given key was found
+*/
+template <typename K, typename D, typename C>
+bool rbtConcurrentTree<K,D,C>::rbt_searchKey(K key, D &data) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+
+		// Looks for the key
+	rbtNode<K,D> *curr = tree.rbt_searchKey(key);
+	if (!curr)
+		return false;
+
+		// Copies out the data while still under the lock
+	data = curr->rbt_getData();
+	return true;
+}
+
+/*
+ * function_identifier: Checks if a node with the given key and data exists
+ * parameters: 			The key and data values to search for
+ * return value:		True if such a node was found
+*/
+template <typename K, typename D, typename C>
+bool rbtConcurrentTree<K,D,C>::rbt_search(K key, D data) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return tree.rbt_search(key, data) != NULL;
+}
+
+/*
+ * function_identifier: Copies out the key and data of the node at the given index
+ * parameters: 			The index to look up and a key and data value to write the result into (return by reference)
+ * return value:		True if the index was in the red-black tree
+*/
+template <typename K, typename D, typename C>
+bool rbtConcurrentTree<K,D,C>::rbt_nodeAt(size_t idx, K &key, D &data) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+
+		// Checks the index while still under the lock
+	if (idx >= tree.rbt_getSize())
+		return false;
+
+		// Copies out the values
+	rbtNode<K,D> *curr = tree.rbt_nodeAt(idx);
+	key = curr->rbt_getKey();
+	data = curr->rbt_getData();
+	return true;
+}
+
+/*
+ * function_identifier: Finds the index of a node with the given key
+ *						Throws std::out_of_range if the key is not in the red-black tree
+ * parameters: 			Key value
+ * return value:		The index value of a node in the red-black tree
+*/
+template <typename K, typename D, typename C>
+size_t rbtConcurrentTree<K,D,C>::rbt_findIdxKey(K key) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return tree.rbt_findIdxKey(key);
+}
+
+/*
+ * function_identifier: Counts all the nodes, in the red-black tree, that have the given key
+ * parameters: 			The given key to check for
+ * return value:		The count of all nodes that have the given key
+*/
+template <typename K, typename D, typename C>
+size_t rbtConcurrentTree<K,D,C>::rbt_countKey(K key) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return tree.rbt_countKey(key);
+}
+
+/*
+ * function_identifier: Counts all the nodes, in the red-black tree, with a key between the two keys provided (inclusive)
+ * parameters: 			The start and end keys of a range
+ * return value:		The count of all nodes in the range
+*/
+template <typename K, typename D, typename C>
+size_t rbtConcurrentTree<K,D,C>::rbt_countRange(K st, K ed) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return tree.rbt_countRange(st, ed);
+}
+
+/*
+ * function_identifier: Gets the aggregate of the nodes with a key between the two keys provided (inclusive)
+ *						Needs rbtAggregate<K,D> to be specialized
+ * parameters: 			The start and end keys of a range
+ * return value:		The aggregate
+*/
+template <typename K, typename D, typename C>
+typename rbtAggregate<K,D>::type rbtConcurrentTree<K,D,C>::rbt_aggregate(K st, K ed) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return tree.rbt_aggregate(st, ed);
+}
+
+/*
+ * function_identifier: Returns a deep copy of the current red-black tree
+ * parameters: 			N/A
+ * return value:		A copy of the red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbtConcurrentTree<K,D,C>::rbt_snapshot() const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return rbTree<K,D,C>(tree);
+}
+
+/*
+ * function_identifier: Runs a function over the red-black tree under the shared lock (for range scans and
+ *						other multi-step reads). Node pointers must not escape the function
+ * parameters: 			A function that takes a const red-black tree
+ * return value:		Whatever the given function returns
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+auto rbtConcurrentTree<K,D,C>::rbt_read(F foo) const {
+	std::shared_lock<std::shared_mutex> shared(treeLock);
+	return foo(static_cast<const rbTree<K,D,C> &>(tree));
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                          EXCLUSIVE OPERATIONS                              | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Inserts a node into the red-black tree
+ * parameters: 			The key and data values of the new node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::rbt_insert(K key, D data) {
+	rbtWrite write = {key, data, rbtWrite::INSERT};
+	enqueue(&write, &write + 1);
+}
+
+/*
+ * function_identifier: Deletes a node, with the given key and data, from the red-black tree
+ * parameters: 			The key and data values to delete
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::rbt_delete(K key, D data) {
+	rbtWrite write = {key, data, rbtWrite::DELETE};
+	enqueue(&write, &write + 1);
+}
+
+/*
+ * function_identifier: Deletes a node, with the given key, from the red-black tree
+ * parameters: 			The key to delete
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::rbt_deleteKey(K key) {
+	rbtWrite write = {key, D(), rbtWrite::DELETE_KEY};
+	enqueue(&write, &write + 1);
+}
+
+/*
+ * function_identifier: Inserts multiple nodes into the red-black tree, according to the provided arrays
+ * parameters: 			The length of the arrays, an array of keys, and an array of data values
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::rbt_repInsert(size_t arrayLength, K *keys, D *data) {
+		// Builds the writes outside of any lock
+	std::vector<rbtWrite> writes(arrayLength);
+	for(size_t i = 0; i < arrayLength; i++)
+		writes[i] = {keys[i], data[i], rbtWrite::INSERT};
+
+	enqueue(writes.data(), writes.data() + arrayLength);
+}
+
+/*
+ * function_identifier: Deletes multiple nodes from the red-black tree, according to the provided arrays
+ * parameters: 			The length of the arrays, an array of keys, and an array of data values
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtConcurrentTree<K,D,C>::rbt_repDelete(size_t arrayLength, K *keys, D *data) {
+		// Builds the writes outside of any lock
+	std::vector<rbtWrite> writes(arrayLength);
+	for(size_t i = 0; i < arrayLength; i++)
+		writes[i] = {keys[i], data[i], rbtWrite::DELETE};
+
+	enqueue(writes.data(), writes.data() + arrayLength);
+}
+
+/*
+ * function_identifier: Runs a function over the red-black tree under the exclusive lock, after all queued writes
+ *						Node pointers must not escape the function
+ * parameters: 			A function that takes the red-black tree
+ * return value:		Whatever the given function returns
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+auto rbtConcurrentTree<K,D,C>::rbt_write(F foo) {
+	std::unique_lock<std::shared_mutex> exclusive(treeLock);
+	flush();
+	return foo(tree);
+}
+
+#endif /* _rbt_CONCURRENT */
\ No newline at end of file
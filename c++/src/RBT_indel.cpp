@@ -18,16 +18,9 @@
 
 	/*	 GLOBAL VARIABLES	*/
 namespace {
-		// External From 'RBT_sort.cpp'
-	template <typename K, typename D>
-	extern inline bool(*fooPtr)(rbtNode<K,D> *, rbtNode<K,D> *);
-
-		// External From 'def.h'
-	extern inline void *rbt__otherData__;
-
 		// Base type for zipping
 	template <typename K, typename D>
-	struct rbt__pair__ {K key; D data; bool operator<=(const rbt__pair__ &info) {return (key < info.key || (key == info.key && data <= info.data));};};
+	struct rbt__pair__ {K key; D data;};
 
 	/*
 	 * function_identifier: Zips two arrays (a key array and a data array) into a single usable array
@@ -79,48 +72,110 @@ namespace {
 /*	============================================================================  */
 
 /*
- * function_identifier: 
- * parameters: 			
+ * function_identifier: Links a sorted array of new nodes into a detached branch, after any equal nodes. The array's
+ *						middle node splits the branch, both halves take in the array's halves, and they are joined
+ *						back around the middle node. O(M*log(N/M + 1)), for M new nodes and N branch nodes
+ * parameters: 			The branch and its black height, the start and end of the array, and where to store the
+ *						result's height
+ * return value:		The branch's new root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::repInsertJoinBase(rbtNode<K,D> *curr, size_t height, rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE, size_t &joinedHeight) {
+		// Ignores the trival case
+	if (IdxS == IdxE) {
+		joinedHeight = height;
+		return curr;
+	}
+
+		// Splits the branch after the nodes equal to the middle node
+	rbtNode<K,D> **IdxM = IdxS + (IdxE - IdxS) / 2, *mid = *IdxM, *lo, *hi;
+	size_t loHeight, hiHeight;
+	splitBase(curr, height, [mid] (rbtNode<K,D> *node, size_t) -> bool {return !keyDataCompair(mid, node);}, 0, lo, loHeight, hi, hiHeight);
+
+		// Links each half of the array into its piece, and joins the pieces around the middle node
+	lo = repInsertJoinBase(lo, loHeight, IdxS, IdxM, loHeight);
+	hi = repInsertJoinBase(hi, hiHeight, IdxM + 1, IdxE, hiHeight);
+	return joinBase(lo, loHeight, mid, hi, hiHeight, joinedHeight);
+}
+
+/*
+ * function_identifier: The base for inserting many nodes at once. Picks how to link them in by the batch: a rebuild
+ *						of the whole tree for batches comparable to the tree, joins for large clustered batches, and
+ *						one descent per node otherwise
+ * parameters: 			The number of nodes, and a function that fills an array with the new nodes
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-void rbTree<K,D>::rbt_repInsertBase(size_t arrayLength, F foo, bool sortHow) {
+void rbTree<K,D,C>::rbt_repInsertBase(size_t arrayLength, F foo) {
 		// Ignores the trival case
 	if (!arrayLength)
 		return;
 
 		// Checks for node overflow
-	if (size > (size + arrayLength))
+	if (size > (size + arrayLength) || size + arrayLength - 1 > (rbt_count_t)-1)
 		throw std::overflow_error("overflow - red black tree(s) to large to perform opperation");
 
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS;
+		// Rebuilds the whole tree, out of the tree's nodes merged with the new ones
+	if (arrayLength >= size / RBT_BULK_REBUILD) {
+		rbtNode<K,D> **rbtNodes = new rbtNode<K,D> *[size + arrayLength], **IdxS = rbtNodes + size;
+		rbt_getAllNodes(rbtNodes);
+		foo(IdxS, IdxS + arrayLength);
 
-		// Gets the needed nodes and indexes
-	rbtNodes = new rbtNode<K,D> *[size + arrayLength];
-	rbt_getAllNodes(rbtNodes);
-	IdxS = rbtNodes + size;
+			// Sorts the new nodes (unless they already are), and merges them after the tree's equal nodes
+		if (!std::is_sorted(IdxS, IdxS + arrayLength, compair<KEYDATA>()))
+			mergeSortCallerBase(rbtNodes, size, size + arrayLength - 1, compair<KEYDATA>());
+		mergeSortBase(rbtNodes, 0, size - 1, size + arrayLength, compair<KEYDATA>());
+
+			// Uses the nodes to reconstruct the tree
+		size += arrayLength;
+		treeifyShallow(0, size - 1, rbtNodes, &root);
+		root->parent = NULL;
 
-	foo(IdxS, IdxS + arrayLength);
+			// Deletes the remaining array
+		delete [] rbtNodes;
+		return;
+	}
 
-	fooPtr<K,D> = keyDataCompair;
-	if (sortHow) {
-				// Sorts the inserted nodes
-		mergeSortCallerBase(rbtNodes, size, size + arrayLength - 1);
-			// Merges the nodes with the other nodes in the red-black tree
-				// The merged result will be sorted in ascending order of keys and data (primarily sorted by keys)
-		mergeSortBase(rbtNodes, 0, size - 1, size + arrayLength);
+		// Gets the new nodes, in order
+	rbtNode<K,D> **rbtNodes = new rbtNode<K,D> *[arrayLength], **IdxS = rbtNodes, **IdxE = rbtNodes + arrayLength;
+	foo(IdxS, IdxE);
+	if (!std::is_sorted(IdxS, IdxE, compair<KEYDATA>()))
+		mergeSortCallerBase(rbtNodes, 0, arrayLength - 1, compair<KEYDATA>());
+
+		// Checks if the batch is clustered (at most as many of the tree's nodes fall inside its range as it has nodes)
+		// Only then do joins beat descents, which share most of their paths when the batch is spread out and sorted
+	bool clustered = false;
+	if (arrayLength >= RBT_BULK_JOIN) {
+		rbtNode<K,D> *back = IdxE[-1];
+		iterator it(boundBase([IdxS] (rbtNode<K,D> *curr) -> bool {return keyDataCompair(*IdxS, curr);}), root);
+		size_t inside = 0;
+		while(it != end() && !keyDataCompair(back, &*it) && inside <= arrayLength) {
+			inside++;
+			++it;
+		}
+		clustered = inside <= arrayLength;
 	}
-	else
-		mergeSortBase(rbtNodes, 0, size, size + arrayLength);
 
-		// Uses the nodes to reconstruct the tree
-	size += arrayLength;
-	treeifyShallow(0, size - 1, rbtNodes, &root);
-	root->parent = NULL;
+		// Descends once per node, for small or spread out batches
+	if (!clustered)
+		while(IdxS != IdxE) {
+			size++;
+			insertBase(*IdxS++);
+		}
+		// Else, splits the tree around the new nodes and joins it back
+	else {
+		size_t height;
+		while(IdxS != IdxE) {
+			size++;
+			dataInsertBase(*IdxS++);
+		}
+		root = repInsertJoinBase(root, blackHeightBase(root), rbtNodes, IdxE, height);
+		root->parent = NULL;
+		root->setColor(false);
+	}
 
-		// Deletes the remaining array
+		// Deletes the node array
 	delete [] rbtNodes;
 }
 
@@ -129,43 +184,34 @@ void rbTree<K,D>::rbt_repInsertBase(size_t arrayLength, F foo, bool sortHow) {
  * parameters: 			The length of the arrays, an array of keys, and an array of data values
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repInsert(size_t arrayLength, K *keys, D *data) {
-	rbt__otherData__ = new std::byte *[2];
-	((K **)rbt__otherData__)[0] = keys;
-	((D **)rbt__otherData__)[1] = data;
-
-	rbt_repInsertBase(arrayLength, [] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) -> void {
-		K *keys = ((K **)rbt__otherData__)[0];
-		D *data = ((D **)rbt__otherData__)[1];
-
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repInsert(size_t arrayLength, K *keys, D *data) {
+	rbt_repInsertBase(arrayLength, [this, keys, data] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) mutable -> void {
 		// Checks if given a data array to work with
 		if (data == NULL) {
 				// Checks if given a key array to work with
 			if (keys == NULL) {
 					// If not, then just use the default constructors for the key and data types
 				while(IdxS != IdxE)
-					*IdxS++ = new rbtNode<K,D>(K(), D());
+					*IdxS++ = allocNode(K(), D());
 			} else {
 					// If so, then use the default constructor for the data type and the key array for the key values
 				while(IdxS != IdxE)
-					*IdxS++ = new rbtNode<K,D>(*keys++, D());
+					*IdxS++ = allocNode(*keys++, D());
 			}
 		} else {
 				// Checks if given a key array to work with
 			if (keys == NULL) {
 					// If not, then use the default constructor for the key type and the data array for the data values
 				while(IdxS != IdxE)
-					*IdxS++ = new rbtNode<K,D>(K(), *data++);
+					*IdxS++ = allocNode(K(), *data++);
 			} else {
 					// If so, use the provided arrays for the key and data values
 				while(IdxS != IdxE)
-					*IdxS++ = new rbtNode<K,D>(*keys++, *data++);
+					*IdxS++ = allocNode(*keys++, *data++);
 			}
 		}
-	}, true);
-
-	delete [] (std::byte **)rbt__otherData__;
+	});
 }
 
 /*
@@ -173,17 +219,13 @@ void rbTree<K,D>::rbt_repInsert(size_t arrayLength, K *keys, D *data) {
  * parameters: 			The length of the array and an array of nodes
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repInsert(size_t arrayLength, rbtNode<K,D> **inS) {
-	rbt__otherData__ = (std::byte**)inS;
-
-	rbt_repInsertBase(arrayLength, [] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) -> void {
-		rbtNode<K,D> **rbtNodes = (rbtNode<K,D> **)rbt__otherData__;
-
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repInsert(size_t arrayLength, rbtNode<K,D> **inS) {
+	rbt_repInsertBase(arrayLength, [this, rbtNodes = inS] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) mutable -> void {
 			// Deep copies the given nodes
 		while(IdxS != IdxE)
-			*IdxS++ = new rbtNode<K,D>(*rbtNodes++);
-	}, true);
+			*IdxS++ = allocNode(*rbtNodes++);
+	});
 }
 
 /*
@@ -192,37 +234,24 @@ void rbTree<K,D>::rbt_repInsert(size_t arrayLength, rbtNode<K,D> **inS) {
  * parameters: 			The length of the array, the starting key, the step function for the key, and an array of data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repInsertFunc(size_t arrayLength, K st, K (*step)(K, D), D *data) {
-	typedef K (*stepType)(K, D);
-
-	rbt__otherData__ = new std::byte *[3];
-	((K **)rbt__otherData__)[0] = &st;
-	((D **)rbt__otherData__)[1] = data;
-	((stepType **)rbt__otherData__)[2] = &step;
-
-	rbt_repInsertBase(arrayLength, [] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) -> void {
-		K st = *((K **)rbt__otherData__)[0];
-		D *data = ((D **)rbt__otherData__)[1];
-		stepType step = *((stepType **)rbt__otherData__)[2];
-
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repInsertFunc(size_t arrayLength, K st, K (*step)(K, D), D *data) {
+	rbt_repInsertBase(arrayLength, [this, st, step, data] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) mutable -> void {
 			// Checks if given a data array to work with
 		if (data == NULL) {
 				// If not, then just use the default constructor for the data type
 			while(IdxS != IdxE) {
-				*IdxS++ = new rbtNode<K,D>(st, D());
+				*IdxS++ = allocNode(st, D());
 				st = step(st, D()); // Increases the key step
 			}
 		} else {
 				// If so, use the provided array data values
 			while(IdxS != IdxE) {
-				*IdxS++ = new rbtNode<K,D>(st, *data);
+				*IdxS++ = allocNode(st, *data);
 				st = step(st, *data++); // Increases the key step
 			}
 		}
-	}, false);
-
-	delete [] (std::byte **)rbt__otherData__;
+	});
 }
 
 /*
@@ -230,35 +259,24 @@ void rbTree<K,D>::rbt_repInsertFunc(size_t arrayLength, K st, K (*step)(K, D), D
  * parameters: 			The length of the array, the starting key, the step key value, and an array of data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repInsertInc(size_t arrayLength, K st, K step, D *data) {
-	rbt__otherData__ = new std::byte *[3];
-	((K **)rbt__otherData__)[0] = &st;
-	((D **)rbt__otherData__)[1] = data;
-	((K **)rbt__otherData__)[2] = &step;
-
-	rbt_repInsertBase(arrayLength, [] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) -> void {
-		K st = *((K **)rbt__otherData__)[0];
-		D *data = ((D **)rbt__otherData__)[1];
-		K step = *((K **)rbt__otherData__)[2];
-
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repInsertInc(size_t arrayLength, K st, K step, D *data) {
+	rbt_repInsertBase(arrayLength, [this, st, step, data] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) mutable -> void {
 			// Checks if given a data array to work with
 		if (data == NULL) {
 				// If not, then just use the default constructor for the data type
 			while(IdxS != IdxE) {
-				*IdxS++ = new rbtNode<K,D>(st, D());
+				*IdxS++ = allocNode(st, D());
 				st += step; // Increases the key step
 			}
 		} else {
 				// If so, use the provided array data values
 			while(IdxS != IdxE) {
-				*IdxS++ = new rbtNode<K,D>(st, *data++);
+				*IdxS++ = allocNode(st, *data++);
 				st += step; // Increases the key step
 			}
 		}
-	}, false);
-
-	delete [] (std::byte *)rbt__otherData__;
+	});
 }
 
 /*
@@ -266,35 +284,24 @@ void rbTree<K,D>::rbt_repInsertInc(size_t arrayLength, K st, K step, D *data) {
  * parameters: 			The length of the array, the starting key, the step key value, and an array of data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repInsertDec(size_t arrayLength, K st, K step, D *data) {
-	rbt__otherData__ = new std::byte *[3];
-	((K **)rbt__otherData__)[0] = &st;
-	((D **)rbt__otherData__)[1] = data;
-	((K **)rbt__otherData__)[2] = &step;
-
-	rbt_repInsertBase(arrayLength, [] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) -> void {
-		K st = *((K **)rbt__otherData__)[0];
-		D *data = ((D **)rbt__otherData__)[1];
-		K step = *((K **)rbt__otherData__)[2];
-
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repInsertDec(size_t arrayLength, K st, K step, D *data) {
+	rbt_repInsertBase(arrayLength, [this, st, step, data] (rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE) mutable -> void {
 			// Checks if given a data array to work with
 		if (data == NULL) {
 				// If not, then just use the default constructor for the data type
 			while(IdxS != IdxE) {
-				*IdxS++ = new rbtNode<K,D>(st, D());
+				*IdxS++ = allocNode(st, D());
 				st -= step; // Increases the key step
 			}
 		} else {
 				// If so, use the provided array data values
 			while(IdxS != IdxE) {
-				*IdxS++ = new rbtNode<K,D>(st, *data++);
+				*IdxS++ = allocNode(st, *data++);
 				st -= step; // Increases the key step
 			}
 		}
-	}, false);
-
-	delete [] (std::byte *)rbt__otherData__;
+	});
 }
 
 /*
@@ -304,8 +311,8 @@ void rbTree<K,D>::rbt_repInsertDec(size_t arrayLength, K st, K step, D *data) {
 						a step function that returns a key and data by reference and return void
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repInsertFor(void (*initialize)(K &, D &), bool (*condition)(K &, D &), void (*step)(K &, D &)) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repInsertFor(void (*initialize)(K &, D &), bool (*condition)(K &, D &), void (*step)(K &, D &)) {
 		// Initializes base key and data by calling the given 'initialize' function
 	K key; D data;
 	initialize(key, data);
@@ -325,7 +332,7 @@ void rbTree<K,D>::rbt_repInsertFor(void (*initialize)(K &, D &), bool (*conditio
 		}
 
 			// Then creates a new node in the node array with the given values
-		*rbtNodes++ = new rbtNode<K,D>(key, data); idx++;
+		*rbtNodes++ = allocNode(key, data); idx++;
 
 			// Checks for node overflow
 		if (idx == (size_t)-1)
@@ -338,9 +345,8 @@ void rbTree<K,D>::rbt_repInsertFor(void (*initialize)(K &, D &), bool (*conditio
 	rbtNodes -= idx;
 
 		// Merges and sorts all the nodes in the node array
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(rbtNodes, size, idx - 1);
-	mergeSortBase(rbtNodes, 0, size - 1, idx);
+	mergeSortCallerBase(rbtNodes, size, idx - 1, compair<KEYDATA>());
+	mergeSortBase(rbtNodes, 0, size - 1, idx, compair<KEYDATA>());
 
 		// Uses the sorted node array to reconstruct the tree
 	size = idx;
@@ -359,15 +365,34 @@ void rbTree<K,D>::rbt_repInsertFor(void (*initialize)(K &, D &), bool (*conditio
 
 /*		   BASE			*/
 
+/*
+ * function_identifier: Checks if a value can go before another in a sorted value array (keys, data, or zipped pairs)
+ * parameters: 			Two values, and a boolean to check if the values are data (only needed when keys and data share a type)
+ * return value:		A boolean (True only if the first value is less than or equal to the second value)
+*/
+template <typename K, typename D, typename C>
+template <typename T>
+inline bool rbTree<K,D,C>::valueOrder(const T &value1, const T &value2, bool data) {
+	if constexpr (std::is_same<T, rbt__pair__<K,D>>::value) {
+		int cmp = C::key(value1.key, value2.key);
+		return (cmp < 0 || (!cmp && C::data(value1.data, value2.data) <= 0));
+	} else if constexpr (std::is_same<K, D>::value)
+		return ((data ? C::data(value1, value2) : C::key(value1, value2)) <= 0);
+	else if constexpr (std::is_same<T, D>::value)
+		return (C::data(value1, value2) <= 0);
+	else
+		return (C::key(value1, value2) <= 0);
+}
+
 /*
  * function_identifier: The base template for repDelete functions (node array)
  * parameters: 			An the array length, an array of nodes, a function to select which nodes to delete,
  *						and a boolean to check if this call is in data context
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, rbtNode<K,D> **delS, F foo, bool data) {
+inline void rbTree<K,D,C>::repDeleteBase(size_t arrayLength, rbtNode<K,D> **delS, F foo, bool data) {
 		// Ignores the trival case
 	if (!arrayLength || !size)
 		return;
@@ -384,11 +409,10 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, rbtNode<K,D> **delS,
 		// Sorts the nodes
 	if (data) {
 			// If data, sort by data
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(rbtNodes, 0, size - 1);
+		mergeSortCallerBase(rbtNodes, 0, size - 1, compair<DATA>());
+		mergeSortCallerBase(delS, 0, arrayLength - 1, compair<DATA>());
 	} else
-		fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(delS, 0, arrayLength - 1);
+		mergeSortCallerBase(delS, 0, arrayLength - 1, compair<KEYDATA>());
 
 		// Cycles through the entire node array
 	foo(IdxS, IdxM, IdxE, delS, delE, remS);
@@ -396,16 +420,15 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, rbtNode<K,D> **delS,
 		// Frees nodes issued to be deleted
 	delE = delNodes;
 	if (delNodes != remS) do {
-		delete *delNodes++;
+		freeNode(*delNodes++);
 	} while(delNodes != remS);
 
 		// Clears delete node array
 	delete [] delE;
 
-		// Places remaining, non-deleted, nodes into the array
-	if (IdxS != IdxM) do {
+		// Places remaining, non-deleted, nodes into the array (in place, if none were deleted before them)
+	while(IdxS != IdxE)
 		*IdxM++ = *IdxS++;
-	} while(IdxS != IdxE);
 
 		// Calculates the size of the array of non-deleted nodes
 	size = IdxM - rbtNodes;
@@ -415,8 +438,7 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, rbtNode<K,D> **delS,
 			// If there are remaining nodes, sort them (if needed) and create a tree from the result
 		if (data) {
 				// If data, sort them back in order
-			fooPtr<K,D> = keyDataCompair;
-			mergeSortCallerBase(rbtNodes, 0, size - 1);
+			mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 		}
 		treeifyShallow(0, size - 1, rbtNodes, &root);
 		root->parent = NULL;
@@ -434,9 +456,9 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, rbtNode<K,D> **delS,
  *						delete, and a boolean to check if this call is in data context
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F, typename T>
-inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, T *valueS, F foo, bool data) {
+inline void rbTree<K,D,C>::repDeleteBase(size_t arrayLength, T *valueS, F foo, bool data) {
 		// Ignores the trival case
 	if (!arrayLength || !size)
 		return;
@@ -452,18 +474,17 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, T *valueS, F foo, boo
 
 		// Sorts the values and nodes
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(rbtNodes, 0, size - 1);
-	} else
-		fooPtr<K,D> = keyDataCompair;
-	quickSort(valueS, valueE - 1);
+		mergeSortCallerBase(rbtNodes, 0, size - 1, compair<DATA>());
+	}
+	quickSort(valueS, valueE - 1, [data] (const T &value1, const T &value2) -> bool {
+		return valueOrder(value1, value2, data);
+	});
 
 	foo(IdxS, IdxM, IdxE, valueS, valueE);
 
-		// Places remaining, non-deleted, nodes into the array
-	if (IdxS != IdxM) do {
+		// Places remaining, non-deleted, nodes into the array (in place, if none were deleted before them)
+	while(IdxS != IdxE)
 		*IdxM++ = *IdxS++;
-	} while(IdxS != IdxE);
 
 		// Calculates the size of the array of non-deleted nodes
 	size = IdxM - rbtNodes;
@@ -472,8 +493,7 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, T *valueS, F foo, boo
 	if (size) {
 			// If there are remaining nodes, sort them (if needed) and create a tree from the result
 		if (data) {
-			fooPtr<K,D> = keyDataCompair;
-			mergeSortCallerBase(rbtNodes, 0, size - 1);
+			mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 		}
 		treeifyShallow(0, size - 1, rbtNodes, &root);
 		root->parent = NULL;
@@ -492,22 +512,22 @@ inline void rbTree<K,D>::repDeleteBase(size_t arrayLength, T *valueS, F foo, boo
  * parameters: 			The length of the array and an array of nodes
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repDelete(size_t arrayLength, rbtNode<K,D> **delS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repDelete(size_t arrayLength, rbtNode<K,D> **delS) {
 	repDeleteBase(arrayLength, delS, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbtNode<K,D> **delS, rbtNode<K,D> **delE, rbtNode<K,D> **&remS) -> void {
 			// Cycles through the entire array of accessed nodes
 		while(IdxS != IdxE && delS != delE)
 				// Checks if both considered nodes have equal keys and data
 				// If so, delete it and move forward
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == (*delS)->key) {
-				if ((*IdxS)->data == (*delS)->data) {
+			if (C::key((*IdxS)->key, (*delS)->key) == 0) {
+				if (C::data((*IdxS)->data, (*delS)->data) == 0) {
 					*remS++ = *IdxS++; delS++;
-				} else if ((*IdxS)->data < (*delS)->data)
+				} else if (C::data((*IdxS)->data, (*delS)->data) < 0)
 					*IdxM++ = *IdxS++;
 				else
 					delS++;
-			} else if ((*IdxS)->key < (*delS)->key)
+			} else if (C::key((*IdxS)->key, (*delS)->key) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				delS++;
@@ -519,8 +539,8 @@ void rbTree<K,D>::rbt_repDelete(size_t arrayLength, rbtNode<K,D> **delS) {
  * parameters: 			The length of the arrays, an array of keys, and an array of data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repDelete(size_t arrayLength, K *keysS, D *dataS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repDelete(size_t arrayLength, K *keysS, D *dataS) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -529,20 +549,20 @@ void rbTree<K,D>::rbt_repDelete(size_t arrayLength, K *keysS, D *dataS) {
 	rbt__pair__<K,D> *infoS = rbt__zip__(arrayLength, keysS, dataS);
 
 		// Calls the main base function
-	repDeleteBase(arrayLength, infoS, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> *infoS, rbt__pair__<K,D> *infoE) -> void {
+	repDeleteBase(arrayLength, infoS, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> *infoS, rbt__pair__<K,D> *infoE) -> void {
 			// Cycles through the entire array of accessed nodes
 		while(IdxS != IdxE && infoS != infoE)
 				// Checks if the node considered has the requested keys and data pairs
 				// If so, delete it and move forward
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == (*infoS).key) {
-				if ((*IdxS)->data == (*infoS).data) {
-					delete *IdxS++; infoS++;
-				} else if ((*IdxS)->data < (*infoS).data)
+			if (C::key((*IdxS)->key, (*infoS).key) == 0) {
+				if (C::data((*IdxS)->data, (*infoS).data) == 0) {
+					freeNode(*IdxS++); infoS++;
+				} else if (C::data((*IdxS)->data, (*infoS).data) < 0)
 					*IdxM++ = *IdxS++;
 				else
 					infoS++;
-			} else if ((*IdxS)->key < (*infoS).key)
+			} else if (C::key((*IdxS)->key, (*infoS).key) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				infoS++;
@@ -559,17 +579,17 @@ void rbTree<K,D>::rbt_repDelete(size_t arrayLength, K *keysS, D *dataS) {
  * parameters: 			The length of the arrays and an array of nodes with keys
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repDeleteKey(size_t arrayLength, rbtNode<K,D> **delS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repDeleteKey(size_t arrayLength, rbtNode<K,D> **delS) {
 	repDeleteBase(arrayLength, delS, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbtNode<K,D> **delS, rbtNode<K,D> **delE, rbtNode<K,D> **&remS) -> void {
 			// Cycles through the entire array of accessed nodes
 		while(IdxS != IdxE && delS != delE)
 				// Checks if both considered nodes have equal keys and data
 				// If so, delete it and move forward
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == (*delS)->key) {
+			if (C::key((*IdxS)->key, (*delS)->key) == 0) {
 				*remS++ = *IdxS++; delS++;
-			} else if ((*IdxS)->key < (*delS)->key)
+			} else if (C::key((*IdxS)->key, (*delS)->key) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				delS++;
@@ -581,17 +601,17 @@ void rbTree<K,D>::rbt_repDeleteKey(size_t arrayLength, rbtNode<K,D> **delS) {
  * parameters: 			The length of the arrays and an array of keys
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repDeleteKey(size_t arrayLength, K *keysS) {
-	repDeleteBase(arrayLength, keysS, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K *keysS, K *keysE) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repDeleteKey(size_t arrayLength, K *keysS) {
+	repDeleteBase(arrayLength, keysS, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K *keysS, K *keysE) -> void {
 			// Cycles through the entire array of accessed nodes and keys
 		while(IdxS != IdxE && keysS != keysE) {
 				// Checks if the node considered has the requested keys
 				// If so, delete it and move forward
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == *keysS) {
-				delete *IdxS++; keysS++;
-			} else if ((*IdxS)->key < *keysS)
+			if (C::key((*IdxS)->key, *keysS) == 0) {
+				freeNode(*IdxS++); keysS++;
+			} else if (C::key((*IdxS)->key, *keysS) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				keysS++;
@@ -606,17 +626,17 @@ void rbTree<K,D>::rbt_repDeleteKey(size_t arrayLength, K *keysS) {
  * parameters: 			The length of the arrays and an array of nodes with data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repDeleteData(size_t arrayLength, rbtNode<K,D> **delS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repDeleteData(size_t arrayLength, rbtNode<K,D> **delS) {
 	repDeleteBase(arrayLength, delS, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbtNode<K,D> **delS, rbtNode<K,D> **delE, rbtNode<K,D> **&remS) -> void {
 			// Cycles through the entire array of accessed nodes
 		while(IdxS != IdxE && delS != delE)
 				// Checks if both considered nodes have equal keys and data
 				// If so, delete it and move forward
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->data == (*delS)->data) {
+			if (C::data((*IdxS)->data, (*delS)->data) == 0) {
 				*remS++ = *IdxS++; delS++;
-			} else if ((*IdxS)->data < (*delS)->data)
+			} else if (C::data((*IdxS)->data, (*delS)->data) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				delS++;
@@ -628,17 +648,17 @@ void rbTree<K,D>::rbt_repDeleteData(size_t arrayLength, rbtNode<K,D> **delS) {
  * parameters: 			The length of the arrays and an array of data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_repDeleteData(size_t arrayLength, D *dataS) {
-	repDeleteBase(arrayLength, dataS, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D *dataS, D *dataE) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_repDeleteData(size_t arrayLength, D *dataS) {
+	repDeleteBase(arrayLength, dataS, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D *dataS, D *dataE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && dataS != dataE) {
 				// Checks if the node considered has the requested data
 				// If so, delete it and move forward
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->data == *dataS) {
-				delete *IdxS++; dataS++;
-			} else if ((*IdxS)->data < *dataS)
+			if (C::data((*IdxS)->data, *dataS) == 0) {
+				freeNode(*IdxS++); dataS++;
+			} else if (C::data((*IdxS)->data, *dataS) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				dataS++;
@@ -661,9 +681,9 @@ void rbTree<K,D>::rbt_repDeleteData(size_t arrayLength, D *dataS) {
  *						a boolean to check if this call is in data context
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F1, typename F2, typename T>
-inline void rbTree<K,D>::removeBase(size_t arrayLength, rbtNode<K,D> **delS, T *valueS, F1 foo, F2 bar, bool data) {
+inline void rbTree<K,D,C>::removeBase(size_t arrayLength, rbtNode<K,D> **delS, T *valueS, F1 foo, F2 bar, bool data) {
 		// Ignores the trival case
 	if (!size) {
 		delete [] valueS;
@@ -681,11 +701,10 @@ inline void rbTree<K,D>::removeBase(size_t arrayLength, rbtNode<K,D> **delS, T *
 
 		// Sorts the provided and accessed nodes
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(rbtNodes, 0, size - 1);
+		mergeSortCallerBase(rbtNodes, 0, size - 1, compair<DATA>());
+		mergeSortCallerBase(delS, 0, arrayLength - 1, compair<DATA>());
 	} else
-		fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(delS, 0, arrayLength - 1);
+		mergeSortCallerBase(delS, 0, arrayLength - 1, compair<KEYDATA>());
 
 		// Extracts all key and data values into a new array
 	valueE = valueS + arrayLength;
@@ -714,8 +733,7 @@ inline void rbTree<K,D>::removeBase(size_t arrayLength, rbtNode<K,D> **delS, T *
 	if (size) {
 			// If there are remaining nodes, sort them (if needed) and create a tree from the result
 		if (data) {
-			fooPtr<K,D> = keyDataCompair;
-			mergeSortCallerBase(rbtNodes, 0, size - 1);
+			mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 		}
 		treeifyShallow(0, size - 1, rbtNodes, &root);
 		root->parent = NULL;
@@ -733,9 +751,9 @@ inline void rbTree<K,D>::removeBase(size_t arrayLength, rbtNode<K,D> **delS, T *
  *						to delete, and a boolean to check if this call is in data context
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F, typename T>
-inline void rbTree<K,D>::removeRawBase(size_t arrayLength, T *valuesS, F foo, bool data) {
+inline void rbTree<K,D,C>::removeRawBase(size_t arrayLength, T *valuesS, F foo, bool data) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -751,11 +769,11 @@ inline void rbTree<K,D>::removeRawBase(size_t arrayLength, T *valuesS, F foo, bo
 
 		// Sorts the accessed nodes and values
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(rbtNodes, 0, size - 1);
-	} else
-		fooPtr<K,D> = keyDataCompair;
-	quickSort(valuesS, valuesE - 1);
+		mergeSortCallerBase(rbtNodes, 0, size - 1, compair<DATA>());
+	}
+	quickSort(valuesS, valuesE - 1, [data] (const T &value1, const T &value2) -> bool {
+		return valueOrder(value1, value2, data);
+	});
 
 	foo(IdxS, IdxM, IdxE, valuesS, valuesE);
 
@@ -776,8 +794,7 @@ inline void rbTree<K,D>::removeRawBase(size_t arrayLength, T *valuesS, F foo, bo
 	if (size) {
 			// If there are remaining nodes, sort them (if needed) and create a tree from the result
 		if (data) {
-			fooPtr<K,D> = keyDataCompair;
-			mergeSortCallerBase(rbtNodes, 0, size - 1);
+			mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 		}
 		treeifyShallow(0, size - 1, rbtNodes, &root);
 		root->parent = NULL;
@@ -794,9 +811,9 @@ inline void rbTree<K,D>::removeRawBase(size_t arrayLength, T *valuesS, F foo, bo
  * parameters: 			A value, a function to delete and reorder the nodes
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F, typename T>
-inline void rbTree<K,D>::removeBase(T value, F foo) {
+inline void rbTree<K,D,C>::removeBase(T value, F foo) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -833,8 +850,8 @@ inline void rbTree<K,D>::removeBase(T value, F foo) {
  * parameters: 			A node
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_remove(rbtNode<K,D> *delNode) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_remove(rbtNode<K,D> *delNode) {
 	rbt_remove(delNode->key, delNode->data);
 }
 
@@ -843,8 +860,8 @@ void rbTree<K,D>::rbt_remove(rbtNode<K,D> *delNode) {
  * parameters: 			The array length and an array of nodes
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_remove(size_t arrayLength, rbtNode<K,D> **delS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_remove(size_t arrayLength, rbtNode<K,D> **delS) {
 	removeBase(arrayLength, delS, new rbt__pair__<K,D>[arrayLength],
 	[] (rbtNode<K,D> **delS, rbtNode<K,D> **delE, rbt__pair__<K,D> *infoS) -> void {
 			// Saves the key and data values from the provided arrays
@@ -854,20 +871,20 @@ void rbTree<K,D>::rbt_remove(size_t arrayLength, rbtNode<K,D> **delS) {
 			(*infoS++).data = (*delS++)->data;
 		}
 	},
-	[] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> *infoS, rbt__pair__<K,D> *infoE) -> void {
+	[this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> *infoS, rbt__pair__<K,D> *infoE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && infoS != infoE)
 				// Checks if both considered nodes have equal keys and data
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == (*infoS).key) {
-				if ((*IdxS)->data == (*infoS).data)
-					delete *IdxS++;
-				else if ((*IdxS)->data < (*infoS).data)
+			if (C::key((*IdxS)->key, (*infoS).key) == 0) {
+				if (C::data((*IdxS)->data, (*infoS).data) == 0)
+					freeNode(*IdxS++);
+				else if (C::data((*IdxS)->data, (*infoS).data) < 0)
 					*IdxM++ = *IdxS++;
 				else
 					infoS++;
-			} else if ((*IdxS)->key < (*infoS).key)
+			} else if (C::key((*IdxS)->key, (*infoS).key) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				infoS++;
@@ -879,19 +896,19 @@ void rbTree<K,D>::rbt_remove(size_t arrayLength, rbtNode<K,D> **delS) {
  * parameters: 			A key and data value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_remove(K key, D data) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_remove(K key, D data) {
 	rbt__pair__<K,D> info;
 	info.key = key; info.data = data;
 
-	removeBase(info, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> info) -> void {
+	removeBase(info, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> info) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE)
 				// Checks if the considered node has the requested key and data pair
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if (((*IdxS)->key == info.key) && ((*IdxS)->data == info.data))
-				delete *IdxS++;
+			if ((C::key((*IdxS)->key, info.key) == 0) && (C::data((*IdxS)->data, info.data) == 0))
+				freeNode(*IdxS++);
 			else
 				*IdxM++ = *IdxS++;
 	});
@@ -902,8 +919,8 @@ void rbTree<K,D>::rbt_remove(K key, D data) {
  * parameters: 			The array length, an array of keys, and an array of data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_remove(size_t arrayLength, K *keysS, D *dataS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_remove(size_t arrayLength, K *keysS, D *dataS) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -913,20 +930,20 @@ void rbTree<K,D>::rbt_remove(size_t arrayLength, K *keysS, D *dataS) {
 
 		// Calls the main base function
 	removeRawBase(arrayLength, infoS,
-	[] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> *infoS, rbt__pair__<K,D> *infoE) -> void {
+	[this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, rbt__pair__<K,D> *infoS, rbt__pair__<K,D> *infoE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && infoS != infoE)
 				// Checks if the node considered has a requested key and data pair
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == (*infoS).key) {
-				if ((*IdxS)->data == (*infoS).data)
-					delete *IdxS++;
-				else if ((*IdxS)->data < (*infoS).data)
+			if (C::key((*IdxS)->key, (*infoS).key) == 0) {
+				if (C::data((*IdxS)->data, (*infoS).data) == 0)
+					freeNode(*IdxS++);
+				else if (C::data((*IdxS)->data, (*infoS).data) < 0)
 					*IdxM++ = *IdxS++;
-				else if ((*IdxS)->data > (*infoS).data)
+				else if (C::data((*IdxS)->data, (*infoS).data) > 0)
 					infoS++;
-			} else if ((*IdxS)->key < (*infoS).key)
+			} else if (C::key((*IdxS)->key, (*infoS).key) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				infoS++;
@@ -943,8 +960,8 @@ void rbTree<K,D>::rbt_remove(size_t arrayLength, K *keysS, D *dataS) {
  * parameters: 			A node
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeKey(rbtNode<K,D> *remNode) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeKey(rbtNode<K,D> *remNode) {
 	rbt_removeKey(remNode->key);
 }
 
@@ -953,8 +970,8 @@ void rbTree<K,D>::rbt_removeKey(rbtNode<K,D> *remNode) {
  * parameters: 			An array length and an array of nodes
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeKey(size_t arrayLength, rbtNode<K,D> **delS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeKey(size_t arrayLength, rbtNode<K,D> **delS) {
 	removeBase(arrayLength, delS, new K[arrayLength],
 	[] (rbtNode<K,D> **delS, rbtNode<K,D> **delE, K *keyS) -> void {
 			// Saves the key values from the provided arrays
@@ -962,15 +979,15 @@ void rbTree<K,D>::rbt_removeKey(size_t arrayLength, rbtNode<K,D> **delS) {
 		while(delE != delS)
 			*keyS++ = (*delS++)->key;
 	},
-	[] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K *keyS, K *keyE) -> void {
+	[this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K *keyS, K *keyE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && keyS != keyE)
 				// Checks if both considered nodes have equal keys
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == *keyS)
-				delete *IdxS++;
-			else if ((*IdxS)->key < *keyS)
+			if (C::key((*IdxS)->key, *keyS) == 0)
+				freeNode(*IdxS++);
+			else if (C::key((*IdxS)->key, *keyS) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				keyS++;
@@ -982,16 +999,16 @@ void rbTree<K,D>::rbt_removeKey(size_t arrayLength, rbtNode<K,D> **delS) {
  * parameters: 			A key
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeKey(K key) {
-	removeBase(key, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K key) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeKey(K key) {
+	removeBase(key, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K key) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE)
 				// Checks if the node considered had the requested key
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == key)
-				delete *IdxS++;
+			if (C::key((*IdxS)->key, key) == 0)
+				freeNode(*IdxS++);
 			else
 				*IdxM++ = *IdxS++;
 	});
@@ -1002,18 +1019,18 @@ void rbTree<K,D>::rbt_removeKey(K key) {
  * parameters: 			An array length and an array of keys
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeKey(size_t arrayLength, K *keysS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeKey(size_t arrayLength, K *keysS) {
 	removeRawBase(arrayLength, keysS,
-	[] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K *keysS, K *keysE) -> void {
+	[this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, K *keysS, K *keysE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && keysS != keysE)
 				// Checks if the node considered had the requested keys
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->key == *keysS)
-				delete *IdxS++;
-			else if ((*IdxS)->key < *keysS)
+			if (C::key((*IdxS)->key, *keysS) == 0)
+				freeNode(*IdxS++);
+			else if (C::key((*IdxS)->key, *keysS) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				keysS++;
@@ -1027,8 +1044,8 @@ void rbTree<K,D>::rbt_removeKey(size_t arrayLength, K *keysS) {
  * parameters: 			A node
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeData(rbtNode<K,D> *remNode) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeData(rbtNode<K,D> *remNode) {
 	rbt_removeData(remNode->data);
 }
 
@@ -1037,23 +1054,23 @@ void rbTree<K,D>::rbt_removeData(rbtNode<K,D> *remNode) {
  * parameters: 			The array length and an array of nodes
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeData(size_t arrayLength, rbtNode<K,D> **delS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeData(size_t arrayLength, rbtNode<K,D> **delS) {
 	removeBase(arrayLength, delS, new D[arrayLength],
 	[] (rbtNode<K,D> **delS, rbtNode<K,D> **delE, D *dataS) -> void {
 			// Saves the data values from the provided arrays
 			// This ensures we don't access deleted memory by accident
 		while(delE != delS)
 			*dataS++ = (*delS++)->data;
-	}, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D *dataS, D *dataE) -> void {
+	}, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D *dataS, D *dataE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && dataS != dataE)
 				// Checks if both considered nodes have equal data
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->data == *dataS)
-				delete *IdxS++;
-			else if ((*IdxS)->data < *dataS)
+			if (C::data((*IdxS)->data, *dataS) == 0)
+				freeNode(*IdxS++);
+			else if (C::data((*IdxS)->data, *dataS) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				dataS++;
@@ -1065,16 +1082,29 @@ void rbTree<K,D>::rbt_removeData(size_t arrayLength, rbtNode<K,D> **delS) {
  * parameters: 			A data value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeData(D data) {
-	removeBase(data, [] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D data) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeData(D data) {
+#ifdef RBT_DATA_INDEX
+		// If few nodes have the data, deletes them one at a time through the data index
+	rbtNode<K,D> *node;
+	size_t count = dataRankBase(data, true, &node) - dataRankBase(data, false, &node);
+	if (dataFewBase(count)) {
+		while(count--) {
+			dataRankBase(data, false, &node);
+			rbt_delete(node);
+		}
+		return;
+	}
+#endif
+
+	removeBase(data, [this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D data) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE)
 				// Checks if the node considered had the requested data
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->data == data)
-				delete *IdxS++;
+			if (C::data((*IdxS)->data, data) == 0)
+				freeNode(*IdxS++);
 			else
 				*IdxM++ = *IdxS++;
 	});
@@ -1085,18 +1115,18 @@ void rbTree<K,D>::rbt_removeData(D data) {
  * parameters: 			The array length and an array of data values
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeData(size_t arrayLength, D *dataS) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeData(size_t arrayLength, D *dataS) {
 	removeRawBase(arrayLength, dataS,
-	[] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D *dataS, D *dataE) -> void {
+	[this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxM, rbtNode<K,D> **IdxE, D *dataS, D *dataE) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS != IdxE && dataS != dataE)
 				// Checks if the node considered had the requested data values
 				// If so, delete it and all similar nodes
 				// If not, skip/save it, then move forward in one of the arrays
-			if ((*IdxS)->data == *dataS)
-				delete *IdxS++;
-			else if ((*IdxS)->data < *dataS)
+			if (C::data((*IdxS)->data, *dataS) == 0)
+				freeNode(*IdxS++);
+			else if (C::data((*IdxS)->data, *dataS) < 0)
 				*IdxM++ = *IdxS++;
 			else
 				dataS++;
@@ -1105,12 +1135,12 @@ void rbTree<K,D>::rbt_removeData(size_t arrayLength, D *dataS) {
 
 /*
  * function_identifier: The base template for removeDuplicates functions 
- * parameters: 			A function to delete and reorder the nodes
+ * parameters: 			A function to delete and reorder the nodes (returns true if the nodes were reordered)
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-inline void rbTree<K,D>::removeDuplicatesBase(F foo) {
+inline void rbTree<K,D,C>::removeDuplicatesBase(F foo) {
 		// Ignores the trival case
 	if (size <= 1)
 		return;
@@ -1122,17 +1152,16 @@ inline void rbTree<K,D>::removeDuplicatesBase(F foo) {
 	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
 	IdxE = rbtNodes + size;
 
-	foo(IdxS, IdxE, IdxM);
+		// Removes the duplicates, noting if the nodes were reordered
+	bool resort = foo(IdxS, IdxE, IdxM);
 
 		// Calculates the size of the array of non-deleted nodes
 	size = IdxM - rbtNodes + 1;
 
 	if (size) {
 			// Sort the nodes, if needed
-		if (fooPtr<K,D> != keyDataCompair) {
-			fooPtr<K,D> = keyDataCompair;
-			mergeSortCallerBase(rbtNodes, 0, size - 1);
-		}
+		if (resort)
+			mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 
 			// If there are remaining nodes, create a tree from them
 		treeifyShallow(0, size - 1, rbtNodes, &root);
@@ -1151,20 +1180,20 @@ inline void rbTree<K,D>::removeDuplicatesBase(F foo) {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeDuplicates() {
-	removeDuplicatesBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxE, rbtNode<K,D> **&IdxM) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeDuplicates() {
+	removeDuplicatesBase([this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxE, rbtNode<K,D> **&IdxM) -> bool {
 			// Cycles through the entire array of accessed nodes
 		while (++IdxS != IdxE) {
 				// Checks if current node has equal data and key to the previously accepted node
 				// If so, delete it and all similar nodes after
 				// If not, accept it, then move forward in the array
-			if ((*IdxS)->equal(*IdxM))
-				delete *IdxS;
+			if (keyDataEqual(*IdxS, *IdxM))
+				freeNode(*IdxS);
 			else
 				*++IdxM = *IdxS;
 		}
-		fooPtr<K,D> = keyDataCompair;
+		return false;
 	});
 }
 
@@ -1174,20 +1203,20 @@ void rbTree<K,D>::rbt_removeDuplicates() {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeDuplicateKeys() {
-	removeDuplicatesBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxE, rbtNode<K,D> **&IdxM) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeDuplicateKeys() {
+	removeDuplicatesBase([this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxE, rbtNode<K,D> **&IdxM) -> bool {
 			// Cycles through the entire array of accessed nodes
 		while (++IdxS != IdxE) {
 				// Checks if current node has equal key to the previously accepted node
 				// If so, delete it and all similar nodes after
 				// If not, accept it, then move forward in the array
-			if ((*IdxS)->key == (*IdxM)->key)
-				delete *IdxS;
+			if (C::key((*IdxS)->key, (*IdxM)->key) == 0)
+				freeNode(*IdxS);
 			else
 				*++IdxM = *IdxS;
 		}
-		fooPtr<K,D> = keyDataCompair;
+		return false;
 	});
 }
 
@@ -1197,23 +1226,24 @@ void rbTree<K,D>::rbt_removeDuplicateKeys() {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeDuplicateData() {
-	removeDuplicatesBase([this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxE, rbtNode<K,D> **&IdxM) -> void {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeDuplicateData() {
+	removeDuplicatesBase([this] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **&IdxE, rbtNode<K,D> **&IdxM) -> bool {
 			// Sorts the nodes by data
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(IdxS, 0, size - 1);
+		mergeSortCallerBase(IdxS, 0, size - 1, compair<DATA>());
 
 			// Cycles through the entire array of accessed nodes
 		while (++IdxS != IdxE) {
 				// Checks if current node has equal data to the previously accepted node
 				// If so, delete it and all similar nodes after
 				// If not, accept it, then move forward in the array
-			if ((*IdxS)->data == (*IdxM)->data)
-				delete *IdxS;
+			if (C::data((*IdxS)->data, (*IdxM)->data) == 0)
+				freeNode(*IdxS);
 			else
 				*++IdxM = *IdxS;
 		}
+			// Nodes are now ordered by data, so they need to be resorted
+		return true;
 	});
 }
 
@@ -1228,8 +1258,8 @@ void rbTree<K,D>::rbt_removeDuplicateData() {
  * parameters: 			A key and data
  * return value:		N/A
 */
-template <typename K, typename D>
-D rbTree<K,D>::rbt_delete(K key, D data) {
+template <typename K, typename D, typename C>
+D rbTree<K,D,C>::rbt_delete(K key, D data) {
 	return rbt_delete(rbt_search(key, data));
 }
 
@@ -1238,8 +1268,8 @@ D rbTree<K,D>::rbt_delete(K key, D data) {
  * parameters: 			A key and data
  * return value:		N/A
 */
-template <typename K, typename D>
-D rbTree<K,D>::rbt_deleteKey(K key) {
+template <typename K, typename D, typename C>
+D rbTree<K,D,C>::rbt_deleteKey(K key) {
 	return rbt_delete(rbt_searchKey(key));
 }
 
@@ -1248,8 +1278,8 @@ D rbTree<K,D>::rbt_deleteKey(K key) {
  * parameters: 			A key and data
  * return value:		N/A
 */
-template <typename K, typename D>
-D rbTree<K,D>::rbt_deleteData(D data) {
+template <typename K, typename D, typename C>
+D rbTree<K,D,C>::rbt_deleteData(D data) {
 	return rbt_delete(rbt_searchData(data));
 }
 
@@ -0,0 +1,444 @@
+#ifndef _rbt_INDEX
+#define _rbt_INDEX
+#include	"RBT_main.h"
+#include	"RBT_index.h"
+
+/*==============================================================================\
+ | Program:		Key-Data Red-Black Tree Implementation							|
+ | AUTHOR:		Xavier Alvarez 													|
+ | CREATE DATE:	15-January-2023 												|
+ | COPYRIGHT:	apache-2.0														|
+ | VERSION:		1.0																|
+ | DESCRIPTION:	A red-black semi-balanced binary search tree. Provides a		|
+ |				multitude of useful functions, including O(log(N)) lookup,		|
+ |				insert and delete operations.									|
+ \=============================================================================*/
+
+	// With RBT_DATA_INDEX defined, every node is also linked into a second red-black tree, ordered by data and
+	// then by key. Both trees share their nodes, so the index only costs the extra links in each node.
+	// Without RBT_DATA_INDEX, the upkeep functions below do nothing
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                                  UPKEEP                                    | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Links a new node into the data index. The node must already be counted in the tree's size
+ * parameters: 			The new node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dataInsertBase(rbtNode<K,D> *node) {
+#ifdef RBT_DATA_INDEX
+		// Sets up the node as a red leaf
+	node->dataLeft = node->dataRight = NULL;
+	node->dataDescendants = 0;
+	node->dataColor = true;
+
+		// If the node is the only one, it is the black root of the index
+	if (size == 1) {
+		node->dataParent = NULL;
+		node->dataColor = false;
+		dataRoot = node;
+		return;
+	}
+
+		// Finds an empty position, ordered by data and then key, counting the node on the way down
+	rbtNode<K,D> *curr = dataRoot, *parent;
+	bool left;
+	do {
+		curr->dataDescendants++;
+		parent = curr;
+		left = dataKeyCompair(node, curr);
+		curr = left ? curr->dataLeft : curr->dataRight;
+	} while(curr);
+
+	node->dataParent = parent;
+	if (left) parent->dataLeft = node;
+	else parent->dataRight = node;
+
+		// Rebalances, while the node and its parent are both red
+	while((parent = node->dataParent) && parent->dataColor) {
+		rbtNode<K,D> *grand = parent->dataParent, *uncle;
+
+		if (parent == grand->dataLeft) {
+			uncle = grand->dataRight;
+				// A red uncle moves the problem up to the grandparent
+			if (uncle && uncle->dataColor) {
+				parent->dataColor = uncle->dataColor = false;
+				grand->dataColor = true;
+				node = grand;
+				continue;
+			}
+				// Else, turns the LR case into the LL case, and rotates the grandparent
+			if (node == parent->dataRight) {
+				dataLeftRotate(parent);
+				parent = node;
+			}
+			parent->dataColor = false;
+			grand->dataColor = true;
+			dataRightRotate(grand);
+		} else {
+			uncle = grand->dataLeft;
+				// A red uncle moves the problem up to the grandparent
+			if (uncle && uncle->dataColor) {
+				parent->dataColor = uncle->dataColor = false;
+				grand->dataColor = true;
+				node = grand;
+				continue;
+			}
+				// Else, turns the RL case into the RR case, and rotates the grandparent
+			if (node == parent->dataLeft) {
+				dataRightRotate(parent);
+				parent = node;
+			}
+			parent->dataColor = false;
+			grand->dataColor = true;
+			dataLeftRotate(grand);
+		}
+		break;
+	}
+
+		// Ensures that the root of the index is black
+	dataRoot->dataColor = false;
+#else
+	(void)node;
+#endif
+}
+
+/*
+ * function_identifier: Unlinks a node from the data index. Other nodes keep their place, so the node's key and
+ *						data are never moved
+ * parameters: 			A node in the index
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dataEraseBase(rbtNode<K,D> *node) {
+#ifdef RBT_DATA_INDEX
+		// Finds the node that leaves its position (the node itself, or its successor if it has two children)
+	rbtNode<K,D> *moved = node, *child, *parent;
+	if (node->dataLeft && node->dataRight)
+		for(moved = node->dataRight; moved->dataLeft; moved = moved->dataLeft);
+	bool color = moved->dataColor;
+
+		// Uncounts the node from every ancestor of the position that is left
+	for(parent = moved->dataParent; parent; parent = parent->dataParent)
+		parent->dataDescendants--;
+
+	if (moved == node) {
+			// A node with at most one child is replaced by that child
+		child = node->dataLeft ? node->dataLeft : node->dataRight;
+		parent = node->dataParent;
+		dataSpliceBase(node, child);
+	} else {
+			// Else, the successor is taken out of its position and put in place of the node
+		child = moved->dataRight;
+		if (moved->dataParent == node)
+			parent = moved;
+		else {
+			parent = moved->dataParent;
+			dataSpliceBase(moved, child);
+			moved->dataRight = node->dataRight;
+			moved->dataRight->dataParent = moved;
+		}
+		dataSpliceBase(node, moved);
+		moved->dataLeft = node->dataLeft;
+		moved->dataLeft->dataParent = moved;
+		moved->dataColor = node->dataColor;
+		moved->dataDescendants = node->dataDescendants;
+	}
+
+		// If a black node left its position, the child there is now double black. Promotes it
+	if (color)
+		return;
+
+	rbtNode<K,D> *sibling;
+	while(child != dataRoot && (!child || !child->dataColor)) {
+		if (child == parent->dataLeft) {
+			sibling = parent->dataRight;
+				// A red sibling is rotated up, so the new sibling is black
+			if (sibling->dataColor) {
+				sibling->dataColor = false;
+				parent->dataColor = true;
+				dataLeftRotate(parent);
+				sibling = parent->dataRight;
+			}
+				// A sibling with two black children is colored red, moving the problem up
+			if ((!sibling->dataLeft || !sibling->dataLeft->dataColor) && (!sibling->dataRight || !sibling->dataRight->dataColor)) {
+				sibling->dataColor = true;
+				child = parent;
+				parent = child->dataParent;
+			} else {
+					// Else, ensures the sibling's far child is red, and rotates the parent to finish
+				if (!sibling->dataRight || !sibling->dataRight->dataColor) {
+					sibling->dataLeft->dataColor = false;
+					sibling->dataColor = true;
+					dataRightRotate(sibling);
+					sibling = parent->dataRight;
+				}
+				sibling->dataColor = parent->dataColor;
+				parent->dataColor = false;
+				sibling->dataRight->dataColor = false;
+				dataLeftRotate(parent);
+				child = dataRoot;
+			}
+		} else {
+			sibling = parent->dataLeft;
+				// A red sibling is rotated up, so the new sibling is black
+			if (sibling->dataColor) {
+				sibling->dataColor = false;
+				parent->dataColor = true;
+				dataRightRotate(parent);
+				sibling = parent->dataLeft;
+			}
+				// A sibling with two black children is colored red, moving the problem up
+			if ((!sibling->dataLeft || !sibling->dataLeft->dataColor) && (!sibling->dataRight || !sibling->dataRight->dataColor)) {
+				sibling->dataColor = true;
+				child = parent;
+				parent = child->dataParent;
+			} else {
+					// Else, ensures the sibling's far child is red, and rotates the parent to finish
+				if (!sibling->dataLeft || !sibling->dataLeft->dataColor) {
+					sibling->dataRight->dataColor = false;
+					sibling->dataColor = true;
+					dataLeftRotate(sibling);
+					sibling = parent->dataLeft;
+				}
+				sibling->dataColor = parent->dataColor;
+				parent->dataColor = false;
+				sibling->dataLeft->dataColor = false;
+				dataRightRotate(parent);
+				child = dataRoot;
+			}
+		}
+	}
+	if (child)
+		child->dataColor = false;
+#else
+	(void)node;
+#endif
+}
+
+/*
+ * function_identifier: Rebuilds the data index out of all of the tree's nodes (used after a tree is rebuilt)
+ * parameters: 			The number of nodes and a function that returns each node, given its position
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+void rbTree<K,D,C>::dataIndexBase(size_t len, F foo) {
+#ifdef RBT_DATA_INDEX
+		// Ignores the trival case
+	if (!len)
+		return;
+
+		// Orders the nodes by data and then key
+	rbtNode<K,D> **rbtNodes = new rbtNode<K,D> *[len];
+	for(size_t i = 0; i < len; i++)
+		rbtNodes[i] = foo(i);
+	mergeSortCallerBase(rbtNodes, 0, len - 1, compair<DATAKEY>());
+
+		// Links them the same way treeify links a tree
+	size_t redLevel, forks;
+	treeifyLevels(len, redLevel, forks);
+	dataLinkBase(0, len - 1, rbtNodes, &dataRoot, NULL, 0, redLevel);
+	dataRoot->dataColor = false;
+
+		// Clears the node array
+	delete [] rbtNodes;
+#else
+	(void)len; (void)foo;
+#endif
+}
+
+/*
+ * function_identifier: Rebuilds the data index out of all of the tree's nodes, in order
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::dataIndexBase() {
+	iterator it = begin();
+	dataIndexBase(size, [&it] (size_t) -> rbtNode<K,D> * {return &*it++;});
+}
+
+#ifdef RBT_DATA_INDEX
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                                  LINKS                                     | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Counts the nodes in a branch of the data index
+ * parameters: 			The branch's root (or NULL)
+ * return value:		The number of nodes
+*/
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::dataCountBase(const rbtNode<K,D> *node) {
+	return node ? node->dataDescendants + 1 : 0;
+}
+
+/*
+ * function_identifier: Puts a branch in a node's place in the data index (the node's own links are left as is)
+ * parameters: 			The node, and the branch to take its place (or NULL)
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::dataSpliceBase(rbtNode<K,D> *node, rbtNode<K,D> *branch) {
+	if (!node->dataParent) dataRoot = branch;
+	else if (node == node->dataParent->dataLeft) node->dataParent->dataLeft = branch;
+	else node->dataParent->dataRight = branch;
+	if (branch) branch->dataParent = node->dataParent;
+}
+
+/*
+ * function_identifier: Performs a left rotation in the data index
+ * parameters: 			The pivot node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dataLeftRotate(rbtNode<K,D> *pivot) {
+		// Moves the right child's left branch under pivot, and puts the right child in pivot's place
+	rbtNode<K,D> *detach = pivot->dataRight;
+	pivot->dataRight = detach->dataLeft;
+	if (detach->dataLeft) detach->dataLeft->dataParent = pivot;
+	dataSpliceBase(pivot, detach);
+
+		// Assigns pivot as a child of detach
+	detach->dataLeft = pivot;
+	pivot->dataParent = detach;
+
+		// Corrects the descendants of each node
+	detach->dataDescendants = pivot->dataDescendants;
+	pivot->dataDescendants = dataCountBase(pivot->dataLeft) + dataCountBase(pivot->dataRight);
+}
+
+/*
+ * function_identifier: Performs a right rotation in the data index
+ * parameters: 			The pivot node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dataRightRotate(rbtNode<K,D> *pivot) {
+		// Moves the left child's right branch under pivot, and puts the left child in pivot's place
+	rbtNode<K,D> *detach = pivot->dataLeft;
+	pivot->dataLeft = detach->dataRight;
+	if (detach->dataRight) detach->dataRight->dataParent = pivot;
+	dataSpliceBase(pivot, detach);
+
+		// Assigns pivot as a child of detach
+	detach->dataRight = pivot;
+	pivot->dataParent = detach;
+
+		// Corrects the descendants of each node
+	detach->dataDescendants = pivot->dataDescendants;
+	pivot->dataDescendants = dataCountBase(pivot->dataLeft) + dataCountBase(pivot->dataRight);
+}
+
+/*
+ * function_identifier: Links an array of nodes, sorted by data and then key, into a balanced data index
+ * parameters: 			The start and end indexes to consider, an array of nodes, the link to fill, the parent of
+ *						the current node, the current level, and the level to color red
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dataLinkBase(size_t st, size_t ed, rbtNode<K,D> **rbtNodes, rbtNode<K,D> **curr, rbtNode<K,D> *parent, size_t level, size_t redLevel) {
+		// Calculates the average of midpoint, without overflow
+	size_t mid = st + ((ed - st + 1) >> 1);
+
+		// Sets up the current node, whose descendants and color follow from its range alone
+	rbtNode<K,D> *node = *curr = rbtNodes[mid];
+	node->dataParent = parent;
+	node->dataLeft = node->dataRight = NULL;
+	node->dataDescendants = ed - st;
+	node->dataColor = level == redLevel;
+
+		// Links both branches
+	if (st < mid)
+		dataLinkBase(st, mid - 1, rbtNodes, &node->dataLeft, node, level + 1, redLevel);
+	if (mid < ed)
+		dataLinkBase(mid + 1, ed, rbtNodes, &node->dataRight, node, level + 1, redLevel);
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                                 LOOKUPS                                    | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Finds where a data value would start (or end) in the data index
+ * parameters: 			A data value, if the position should be after the nodes with equal data, rather than
+ *						before them, and a pointer to store the first node past that position (NULL if there is none)
+ * return value:		The number of nodes before the position
+*/
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::dataRankBase(const D &data, bool upper, rbtNode<K,D> **node) const {
+	size_t rank = 0;
+	*node = NULL;
+
+		// Ignores the trival case
+	if (!root)
+		return 0;
+
+		// Goes left past the position, and right (counting the skipped nodes) before it
+	for(rbtNode<K,D> *curr = dataRoot; curr; ) {
+		int cmp = C::data(curr->data, data);
+		if (cmp > 0 || (!upper && !cmp)) {
+			*node = curr;
+			curr = curr->dataLeft;
+		} else {
+			rank += dataCountBase(curr->dataLeft) + 1;
+			curr = curr->dataRight;
+		}
+	}
+
+	return rank;
+}
+
+/*
+ * function_identifier: Finds the first or last node of the data index
+ * parameters: 			If the last node should be found, rather than the first
+ * return value:		An rbtNode pointer (NULL if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::dataEndBase(bool last) const {
+		// Ignores the trival case
+	if (!root)
+		return NULL;
+
+	rbtNode<K,D> *curr = dataRoot;
+	while(last ? curr->dataRight : curr->dataLeft)
+		curr = last ? curr->dataRight : curr->dataLeft;
+	return curr;
+}
+
+/*
+ * function_identifier: Checks if deleting some nodes one at a time (O(log(N)) each) beats rebuilding the tree (O(N))
+ * parameters: 			The number of nodes to delete
+ * return value:		True if the nodes should be deleted one at a time
+*/
+template <typename K, typename D, typename C>
+inline bool rbTree<K,D,C>::dataFewBase(size_t count) const {
+	return count * (size_t)std::log2(size + 1) < size;
+}
+
+/*
+ * function_identifier: Deletes nodes from the start and the end of the data index, one at a time
+ * parameters: 			The number of nodes, with the smallest data, and the number of nodes, with the largest
+ *						data, to delete
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dataTrimBase(size_t low, size_t high) {
+	while(low--)
+		rbt_delete(dataEndBase(false));
+	while(high--)
+		rbt_delete(dataEndBase(true));
+}
+#endif
+
+#endif /* _rbt_INDEX */
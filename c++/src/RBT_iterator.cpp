@@ -0,0 +1,313 @@
+#ifndef _rbt_ITERATOR
+#define _rbt_ITERATOR
+#include	"RBT_main.h"
+#include	"RBT_iterator.h"
+
+/*==============================================================================\
+ | Program:		Key-Data Red-Black Tree Implementation							|
+ | AUTHOR:		Xavier Alvarez 													|
+ | CREATE DATE:	15-January-2023 												|
+ | COPYRIGHT:	apache-2.0														|
+ | VERSION:		1.0																|
+ | DESCRIPTION:	A red-black semi-balanced binary search tree. Provides a		|
+ |				multitude of useful functions, including O(log(N)) lookup,		|
+ |				insert and delete operations.									|
+ \=============================================================================*/
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              CONSTRUCTORS                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Constructs an iterator at a given node of a red-black tree
+ * parameters: 			The node (NULL for the end of the tree) and the tree's root
+ * return value:		N/A
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant>::rbtIterator(rbtNode<K,D> *curr, rbtNode<K,D> *root) : curr(curr), root(root) {}
+
+/*
+ * function_identifier: Constructs an iterator that belongs to no tree
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant>::rbtIterator() : curr(NULL), root(NULL) {}
+
+/*
+ * function_identifier: Copies an iterator (also turns a mutable iterator into a const one)
+ * parameters: 			A mutable iterator
+ * return value:		N/A
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant>::rbtIterator(const rbtIterator<K,D,false> &it) : curr(it.curr), root(it.root) {}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                               NODE ACCESS                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Gets the node the iterator is at
+ * parameters: 			N/A
+ * return value:		A reference to the node
+*/
+template <typename K, typename D, bool constant>
+typename rbtIterator<K,D,constant>::reference rbtIterator<K,D,constant>::operator*() const {
+	return *curr;
+}
+
+/*
+ * function_identifier: Gets the node the iterator is at
+ * parameters: 			N/A
+ * return value:		A pointer to the node
+*/
+template <typename K, typename D, bool constant>
+typename rbtIterator<K,D,constant>::pointer rbtIterator<K,D,constant>::operator->() const {
+	return curr;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                                 STEPPING                                   | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Moves the iterator to the next node in order, by following the parent links
+ *						Amortized O(1), with no extra memory
+ * parameters: 			N/A
+ * return value:		The moved iterator
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant> &rbtIterator<K,D,constant>::operator++() {
+		// If there is a right branch, the next node is its leftmost node
+	if (curr->right) {
+		curr = curr->right;
+		while(curr->left) curr = curr->left;
+		return *this;
+	}
+
+		// Otherwise, climbs until coming up from a left branch (or past the root, to the end)
+	rbtNode<K,D> *prev;
+	do {
+		prev = curr;
+		curr = curr->parent;
+	} while(curr && prev == curr->right);
+	return *this;
+}
+
+/*
+ * function_identifier: Moves the iterator to the next node in order
+ * parameters: 			N/A
+ * return value:		The iterator before moving
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant> rbtIterator<K,D,constant>::operator++(int) {
+	rbtIterator<K,D,constant> temp = *this;
+	++*this;
+	return temp;
+}
+
+/*
+ * function_identifier: Moves the iterator to the previous node in order (from the end, to the last node)
+ * parameters: 			N/A
+ * return value:		The moved iterator
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant> &rbtIterator<K,D,constant>::operator--() {
+		// From the end, the previous node is the rightmost node (an empty tree stays at the end)
+	if (!curr) {
+		curr = root;
+		if (!curr) return *this;
+		while(curr->right) curr = curr->right;
+		return *this;
+	}
+
+		// If there is a left branch, the previous node is its rightmost node
+	if (curr->left) {
+		curr = curr->left;
+		while(curr->right) curr = curr->right;
+		return *this;
+	}
+
+		// Otherwise, climbs until coming up from a right branch
+	rbtNode<K,D> *prev;
+	do {
+		prev = curr;
+		curr = curr->parent;
+	} while(curr && prev == curr->left);
+	return *this;
+}
+
+/*
+ * function_identifier: Moves the iterator to the previous node in order
+ * parameters: 			N/A
+ * return value:		The iterator before moving
+*/
+template <typename K, typename D, bool constant>
+rbtIterator<K,D,constant> rbtIterator<K,D,constant>::operator--(int) {
+	rbtIterator<K,D,constant> temp = *this;
+	--*this;
+	return temp;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                                COMPARISON                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Checks if two iterators are at the same node
+ * parameters: 			Another iterator (const or mutable)
+ * return value:		A boolean value if the iterators are equal or not
+*/
+template <typename K, typename D, bool constant>
+template <bool V>
+bool rbtIterator<K,D,constant>::operator==(const rbtIterator<K,D,V> &it) const {
+	return curr == it.curr;
+}
+
+/*
+ * function_identifier: Checks if two iterators are at different nodes
+ * parameters: 			Another iterator (const or mutable)
+ * return value:		A boolean value if the iterators are different or not
+*/
+template <typename K, typename D, bool constant>
+template <bool V>
+bool rbtIterator<K,D,constant>::operator!=(const rbtIterator<K,D,V> &it) const {
+	return curr != it.curr;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              TREE ITERATORS                                | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Gets an iterator at the first node, in order, of the red-black tree
+ *						Iterators stay valid until the tree's structure changes
+ * parameters: 			N/A
+ * return value:		An iterator (the end iterator if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::iterator rbTree<K,D,C>::begin() {
+	return iterator(rbt_minKey(), root);
+}
+
+/*
+ * function_identifier: Gets a const iterator at the first node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const iterator (the end iterator if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_iterator rbTree<K,D,C>::begin() const {
+	return const_iterator(rbt_minKey(), root);
+}
+
+/*
+ * function_identifier: Gets a const iterator at the first node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const iterator (the end iterator if the tree is empty)
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_iterator rbTree<K,D,C>::cbegin() const {
+	return begin();
+}
+
+/*
+ * function_identifier: Gets the iterator past the last node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		An iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::iterator rbTree<K,D,C>::end() {
+	return iterator(NULL, root);
+}
+
+/*
+ * function_identifier: Gets the const iterator past the last node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_iterator rbTree<K,D,C>::end() const {
+	return const_iterator(NULL, root);
+}
+
+/*
+ * function_identifier: Gets the const iterator past the last node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_iterator rbTree<K,D,C>::cend() const {
+	return end();
+}
+
+/*
+ * function_identifier: Gets a reverse iterator at the last node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A reverse iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::reverse_iterator rbTree<K,D,C>::rbegin() {
+	return reverse_iterator(end());
+}
+
+/*
+ * function_identifier: Gets a const reverse iterator at the last node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const reverse iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_reverse_iterator rbTree<K,D,C>::rbegin() const {
+	return const_reverse_iterator(end());
+}
+
+/*
+ * function_identifier: Gets a const reverse iterator at the last node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const reverse iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_reverse_iterator rbTree<K,D,C>::crbegin() const {
+	return rbegin();
+}
+
+/*
+ * function_identifier: Gets the reverse iterator past the first node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A reverse iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::reverse_iterator rbTree<K,D,C>::rend() {
+	return reverse_iterator(begin());
+}
+
+/*
+ * function_identifier: Gets the const reverse iterator past the first node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const reverse iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_reverse_iterator rbTree<K,D,C>::rend() const {
+	return const_reverse_iterator(begin());
+}
+
+/*
+ * function_identifier: Gets the const reverse iterator past the first node, in order, of the red-black tree
+ * parameters: 			N/A
+ * return value:		A const reverse iterator
+*/
+template <typename K, typename D, typename C>
+typename rbTree<K,D,C>::const_reverse_iterator rbTree<K,D,C>::crend() const {
+	return rend();
+}
+
+#endif /* _rbt_ITERATOR */
\ No newline at end of file
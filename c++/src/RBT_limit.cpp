@@ -16,13 +16,6 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-		// External From 'RBT_sort.cpp'
-	template <typename K, typename D>
-	extern inline bool(*fooPtr)(rbtNode<K,D> *, rbtNode<K,D> *);
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                               TREE LIMITS                                  | */
@@ -36,10 +29,10 @@ namespace {
  * parameters: 			
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clamp(K stK, K edK, D stD, D edD) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clamp(K stK, K edK, D stD, D edD) {
 		// Ignores the trival case
-	if (stK > edK || stD > edD) {
+	if (C::key(stK, edK) > 0 || C::data(stD, edD) > 0) {
 		rbt_clear();
 		return;
 	}
@@ -52,18 +45,18 @@ void rbTree<K,D>::rbt_clamp(K stK, K edK, D stD, D edD) {
 	IdxE = rbtNodes + size - 1;
 
 		// Deletes all nodes less than start key
-	while(IdxE >= IdxS && (*IdxS)->key < stK)
-		delete *IdxS++;
+	while(IdxE >= IdxS && C::key((*IdxS)->key, stK) < 0)
+		freeNode(*IdxS++);
 		// Deletes all nodes greater than end key
-	while(IdxE > IdxS && (*IdxE)->key > edK)
-		delete *IdxE--;
+	while(IdxE > IdxS && C::key((*IdxE)->key, edK) > 0)
+		freeNode(*IdxE--);
 
 		// Initializes extra variables
 	rbtNode<K,D> **IdxM = IdxS, **markS = IdxS;
 		// Deletes all nodes with data not in range
 	while(IdxE >= IdxS) {
-		if ((*IdxS)->data < stD || (*IdxS)->data > edD)
-			delete *IdxS++;
+		if (C::data((*IdxS)->data, stD) < 0 || C::data((*IdxS)->data, edD) > 0)
+			freeNode(*IdxS++);
 		else
 			*IdxM++ = *IdxS++;
 	}
@@ -90,8 +83,8 @@ void rbTree<K,D>::rbt_clamp(K stK, K edK, D stD, D edD) {
  * parameters: 			
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clamp(size_t arrayLengthK, K *stK, K *edK, size_t arrayLengthD, D *stD, D *edD) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clamp(size_t arrayLengthK, K *stK, K *edK, size_t arrayLengthD, D *stD, D *edD) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -101,8 +94,12 @@ void rbTree<K,D>::rbt_clamp(size_t arrayLengthK, K *stK, K *edK, size_t arrayLen
 	K tempKey, *endPtrK; D *endPtrD; D *stDBase = stD, *edDBase = edD;
 
 		// Sorts the given ranges based on their start value
-	quickSortPair(stK, edK, 0, arrayLengthK - 1);
-	quickSortPair(stD, edD, 0, arrayLengthD - 1);
+	quickSortPair(stK, edK, 0, arrayLengthK - 1, [] (const K &key1, const K &key2) -> bool {
+		return valueOrder(key1, key2, false);
+	});
+	quickSortPair(stD, edD, 0, arrayLengthD - 1, [] (const D &data1, const D &data2) -> bool {
+		return valueOrder(data1, data2, true);
+	});
 
 		// Gets the needed nodes and indexes
 	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
@@ -113,16 +110,16 @@ void rbTree<K,D>::rbt_clamp(size_t arrayLengthK, K *stK, K *edK, size_t arrayLen
 	while(1) {
 start_exclude:
 			// Deletes all nodes before the current start key and after the previous end key
-		while((*IdxS)->key < *stK) {
-			delete *IdxS++;
+		while(C::key((*IdxS)->key, *stK) < 0) {
+			freeNode(*IdxS++);
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_clamp;
 		}
 			// Saves all nodes after the current start key and before the current end key 
-		while((*IdxS)->key <= *edK) {
+		while(C::key((*IdxS)->key, *edK) <= 0) {
 				// Moves up in the data array if current node is outside of it
-			while(stD < endPtrD && (*IdxS)->data > *edD) {
+			while(stD < endPtrD && C::data((*IdxS)->data, *edD) > 0) {
 				stD++; edD++;
 					// If we reached the end of the data array, then all future nodes (with
 					// the current key) are outside of the clamp. Delete them
@@ -131,12 +128,12 @@ start_exclude:
 					tempKey = (*IdxS)->key;
 					while(true) {
 							// Deletes the current node and moves forward in the array
-						delete *IdxS++;
+						freeNode(*IdxS++);
 							// Stops when we run out of nodes
 						if (IdxS == IdxE)
 							goto finish_clamp;
 							// Escapes when we find a node with a different key
-						if (tempKey != (*IdxS)->key)
+						if (C::key(tempKey, (*IdxS)->key) != 0)
 							break;
 					}
 
@@ -148,15 +145,15 @@ start_exclude:
 				// Saves the current node's key for comparison
 			tempKey = (*IdxS)->key;
 				// Checks if to save or delete the current node
-			if ((*IdxS)->data < *stD)
-				delete *IdxS++;
+			if (C::data((*IdxS)->data, *stD) < 0)
+				freeNode(*IdxS++);
 			else
 				*IdxM++ = *IdxS++;
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_clamp;
 				// Reset base data range indexes when we find a node with a different key
-			if (tempKey != (*IdxS)->key) {
+			if (C::key(tempKey, (*IdxS)->key) != 0) {
 				stD = stDBase; edD = edDBase;
 			}
 		}
@@ -168,7 +165,7 @@ start_exclude:
 	}
 		// Deletes any extra nodes
 	while(IdxS != IdxE)
-		delete *IdxS++;
+		freeNode(*IdxS++);
 
 finish_clamp:
 		// Calculates the size of the array of non-deleted nodes
@@ -192,10 +189,10 @@ finish_clamp:
  * parameters: 			
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_exclude(K stK, K edK, D stD, D edD) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_exclude(K stK, K edK, D stD, D edD) {
 		// Ignores the trival case
-	if (stK > edK)
+	if (C::key(stK, edK) > 0)
 		return;
 
 		// Initializes the needed values
@@ -205,19 +202,19 @@ void rbTree<K,D>::rbt_exclude(K stK, K edK, D stD, D edD) {
 	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
 	IdxE = rbtNodes + size;
 
-	while(IdxS < IdxE && (*IdxS)->key < stK) {
-		if ((*IdxS)->data < stD || (*IdxS)->data > edD)
+	while(IdxS < IdxE && C::key((*IdxS)->key, stK) < 0) {
+		if (C::data((*IdxS)->data, stD) < 0 || C::data((*IdxS)->data, edD) > 0)
 			*IdxM++ = *IdxS++;
 		else
-			delete *IdxS++;
+			freeNode(*IdxS++);
 	}
-	while(IdxS < IdxE && (*IdxS)->key <= edK)
-		delete *IdxS++;
+	while(IdxS < IdxE && C::key((*IdxS)->key, edK) <= 0)
+		freeNode(*IdxS++);
 	while(IdxS < IdxE) {
-		if ((*IdxS)->data < stD || (*IdxS)->data > edD)
+		if (C::data((*IdxS)->data, stD) < 0 || C::data((*IdxS)->data, edD) > 0)
 			*IdxM++ = *IdxS++;
 		else
-			delete *IdxS++;
+			freeNode(*IdxS++);
 	}
 
 		// Calculates the size of the array of non-deleted nodes
@@ -241,8 +238,8 @@ void rbTree<K,D>::rbt_exclude(K stK, K edK, D stD, D edD) {
  * parameters: 			
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_exclude(size_t arrayLengthK, K *stK, K *edK, size_t arrayLengthD, D *stD, D *edD) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_exclude(size_t arrayLengthK, K *stK, K *edK, size_t arrayLengthD, D *stD, D *edD) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -252,8 +249,12 @@ void rbTree<K,D>::rbt_exclude(size_t arrayLengthK, K *stK, K *edK, size_t arrayL
 	K tempKey, *endPtrK; D *endPtrD; D *stDBase = stD, *edDBase = edD;
 
 		// Sorts the given ranges based on their start value
-	quickSortPair(stK, edK, 0, arrayLengthK - 1);
-	quickSortPair(stD, edD, 0, arrayLengthD - 1);
+	quickSortPair(stK, edK, 0, arrayLengthK - 1, [] (const K &key1, const K &key2) -> bool {
+		return valueOrder(key1, key2, false);
+	});
+	quickSortPair(stD, edD, 0, arrayLengthD - 1, [] (const D &data1, const D &data2) -> bool {
+		return valueOrder(data1, data2, true);
+	});
 
 		// Gets the needed nodes and indexes
 	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
@@ -264,9 +265,9 @@ void rbTree<K,D>::rbt_exclude(size_t arrayLengthK, K *stK, K *edK, size_t arrayL
 	while(1) {
 start_exclude:
 			// Saves all nodes before the current start key and after the previous end key
-		while(endPtrK == stK || (*IdxS)->key < *stK) {
+		while(endPtrK == stK || C::key((*IdxS)->key, *stK) < 0) {
 				// Moves up in the data array if current node is outside of it
-			while(stD < endPtrD && (*IdxS)->data > *edD) {
+			while(stD < endPtrD && C::data((*IdxS)->data, *edD) > 0) {
 				stD++; edD++;
 					// If we reached the end of the data array, then all future nodes (with
 					// the current key) are outside of the clamp. Delete them
@@ -277,7 +278,7 @@ start_exclude:
 						if (IdxS == IdxE)
 							goto finish_exclude;
 							// Escapes when we find a node with a different key
-						if ((*(IdxS - 1))->key != (*IdxS)->key)
+						if (C::key((*(IdxS - 1))->key, (*IdxS)->key) != 0)
 							break;
 					}
 
@@ -289,21 +290,21 @@ start_exclude:
 				// Saves the current node's key for comparison
 			tempKey = (*IdxS)->key;
 				// Checks if to save or delete the current node
-			if ((*IdxS)->data >= *stD)
-				delete *IdxS++;
+			if (C::data((*IdxS)->data, *stD) >= 0)
+				freeNode(*IdxS++);
 			else
 				*IdxM++ = *IdxS++;
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_exclude;
 				// Reset base data range indexes when we find a node with a different key
-			if (tempKey != (*IdxS)->key) {
+			if (C::key(tempKey, (*IdxS)->key) != 0) {
 				stD = stDBase; edD = edDBase;
 			}
 		}
 			// Deletes all nodes after the current start key and before the current end key
-		while((*IdxS)->key <= *edK) {
-			delete *IdxS++;
+		while(C::key((*IdxS)->key, *edK) <= 0) {
+			freeNode(*IdxS++);
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_exclude;
@@ -330,319 +331,165 @@ finish_exclude:
 
 	/*		KEYS	  */
 
+/*
+ * function_identifier: The base for the key limits. Cuts the red-black tree before and after each of a number of
+ *						ranges, then keeps the nodes inside the ranges (or outside them) and drops the rest. Whole
+ *						branches are split off and joined back, so O(R*log(N)) for R ranges, plus the dropped nodes
+ * parameters: 			The number of ranges, a function telling if a node (at a given index in the part of the
+ *						tree not yet cut) is before a range, a function telling if it is not after the range, and if
+ *						the nodes inside the ranges are kept
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+template <typename F1, typename F2>
+void rbTree<K,D,C>::limitBase(size_t ranges, F1 before, F2 within, bool inside) {
+		// Initializes the needed values
+	rbtNode<K,D> *kept = NULL, *lo, *mid, *rest = root;
+	size_t keptHeight = 0, loHeight, midHeight, restHeight = blackHeightBase(root);
+
+		// Cuts each range out of the rest of the tree, and keeps either it or what came before it
+	for(size_t range = 0; range < ranges && rest; range++) {
+		splitBase(rest, restHeight, [&before, range] (rbtNode<K,D> *node, size_t idx) -> bool {
+			return before(node, idx, range);
+		}, 0, lo, loHeight, rest, restHeight);
+		splitBase(rest, restHeight, [&within, range] (rbtNode<K,D> *node, size_t idx) -> bool {
+			return within(node, idx, range);
+		}, 0, mid, midHeight, rest, restHeight);
+
+		dropBase(inside ? lo : mid);
+		kept = inside ? concatBase(kept, keptHeight, mid, midHeight, keptHeight) : concatBase(kept, keptHeight, lo, loHeight, keptHeight);
+	}
+
+		// Keeps or drops what comes after the last range
+	if (inside)
+		dropBase(rest);
+	else
+		kept = concatBase(kept, keptHeight, rest, restHeight, keptHeight);
+
+		// Sets up the new root
+	root = kept;
+	if (root) {
+		root->parent = NULL;
+		root->setColor(false);
+	}
+}
+
 /*
  * function_identifier: Limits all nodes, in the red-black tree, to have a key between the two keys provided
- *						Deletes extras
+ *						Deletes extras. O(log(N)), plus the deleted nodes
  * parameters: 			The start and end keys of a range
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clampKey(K st, K ed) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clampKey(K st, K ed) {
 		// Ignores the trival case
-	if (st > ed) {
+	if (C::key(st, ed) > 0) {
 		rbt_clear();
 		return;
 	}
 
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxE;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbtNodes = rbt_getAllNodes();
-	IdxE = rbtNodes + size - 1;
-
-		// Deletes all nodes less than start key
-	while(IdxE >= IdxS && (*IdxS)->key < st)
-		delete *IdxS++;
-		// Deletes all nodes greater than end key
-	while(IdxE > IdxS && (*IdxE)->key > ed)
-		delete *IdxE--;
-
-		// Checks if there is any nodes left to process
-	if (IdxE != IdxS) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(IdxS - rbtNodes, IdxE - rbtNodes, rbtNodes, &root);
-		size = IdxE - IdxS + 1;
-		root->parent = NULL;
-	} else {
-			// If no remaining nodes, set root to NULL and size to 0
-		root = NULL; size = 0;
-	}
-
-		// Clears accessed node array
-	delete [] rbtNodes;
+		// Keeps only the nodes from the start key through the end key
+	limitBase(1, [&st] (rbtNode<K,D> *node, size_t, size_t) -> bool {return C::key(node->key, st) < 0;},
+				 [&ed] (rbtNode<K,D> *node, size_t, size_t) -> bool {return C::key(node->key, ed) <= 0;}, true);
 }
 
 /*
  * function_identifier: Limits all nodes, in the red-black tree, to have a key between the key ranges provided
- *						Deletes extras
+ *						Deletes extras. O(R*log(N)) for R ranges, plus the deleted nodes
  * parameters: 			The length of the arrays, an array of start keys, and an array of end keys
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clampKey(size_t arrayLength, K *st, K *ed) {
-		// Ignores the trival case
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clampKey(size_t arrayLength, K *st, K *ed) {
+		// Ignores the trival cases
 	if (!size)
 		return;
-
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxM, **IdxE;
-	K *endPtr;
-
-		// Sorts the given key ranges based on their start key
-	quickSortPair(st, ed, 0, arrayLength - 1);
-
-		// Gets the needed nodes and indexes
-	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
-	IdxE = rbtNodes + size;
-	endPtr = st + arrayLength;
-
-		// Cycles through the entire array of accessed nodes
-	while(1) {
-			// Deletes all nodes before the current start key and after the previous end key
-		while((*IdxS)->key < *st) {
-			delete *IdxS++;
-				// Stops when we run out of nodes
-			if (IdxS == IdxE)
-				goto finish_clamp_key;
-		}
-			// Saves all nodes after the current start key and before the current end key 
-		while((*IdxS)->key <= *ed) {
-			*IdxM++ = *IdxS++;
-				// Stops when we run out of nodes
-			if (IdxS == IdxE)
-				goto finish_clamp_key;
-		}
-			// Moves forward in the start and end key arrays
-		st++; ed++;
-			// Stops when we run out of ranges to process
-		if (endPtr == st)
-			break;
+	if (!arrayLength) {
+		rbt_clear();
+		return;
 	}
-		// Deletes any extra nodes
-	while(IdxS != IdxE)
-		delete *IdxS++;
 
-finish_clamp_key:
-		// Calculates the size of the array of non-deleted nodes
-	size = IdxM - rbtNodes;
-
-		// Checks if there is any nodes left to process
-	if (size) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(0, size - 1, rbtNodes, &root);
-		root->parent = NULL;
-	} else
-			// If no remaining nodes, set root to NULL
-		root = NULL;
+		// Sorts the given key ranges based on their start key
+	quickSortPair(st, ed, 0, arrayLength - 1, [] (const K &key1, const K &key2) -> bool {
+		return valueOrder(key1, key2, false);
+	});
 
-		// Clears accessed node array
-	delete [] rbtNodes;
+		// Keeps only the nodes inside the ranges, in order
+	limitBase(arrayLength, [st] (rbtNode<K,D> *node, size_t, size_t range) -> bool {return C::key(node->key, st[range]) < 0;},
+						   [ed] (rbtNode<K,D> *node, size_t, size_t range) -> bool {return C::key(node->key, ed[range]) <= 0;}, true);
 }
 
 /*
  * function_identifier: Limits all nodes, in the red-black tree, to have a key outside the range of the two keys provided
- *						Deletes extras
+ *						Deletes extras. O(log(N)), plus the deleted nodes
  * parameters: 			The start and end keys of a range
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_excludeKey(K st, K ed) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_excludeKey(K st, K ed) {
 		// Ignores the trival case
-	if (st > ed)
+	if (C::key(st, ed) > 0)
 		return;
 
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxM, **IdxE;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbtNodes = rbt_getAllNodes();
-	IdxE = rbtNodes + size;
-
-		// Skips all nodes before the start key
-	while(IdxS < IdxE && (*IdxS)->key < st)
-		IdxS++;
-
-		// Sets this index as the begining of our deletion
-	IdxM = IdxS;
-
-		// Deletes all nodes until passing the end key
-	while(IdxS < IdxE && (*IdxS)->key <= ed)
-		delete *IdxS++;
-
-		// Checks if any nodes were deleted
-	if (IdxM != IdxS)
-			// If some nodes were deleted, place the remaining nodes into the array
-		while(IdxS < IdxE)
-			*IdxM++ = *IdxS++;
-	else
-			// If no nodes deleted, just skip to the end
-			// Everything is already fine how it is
-		IdxM = IdxE;
-
-		// Calculates the size of the array of non-deleted nodes
-	size = IdxM - rbtNodes;
-
-		// Checks if there is any nodes left to process
-	if (size) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(0, size - 1, rbtNodes, &root);
-		root->parent = NULL;
-	} else
-		// If no remaining nodes, set root to NULL
-		root = NULL;
-
-		// Clears accessed node array
-	delete [] rbtNodes;
+		// Drops only the nodes from the start key through the end key
+	limitBase(1, [&st] (rbtNode<K,D> *node, size_t, size_t) -> bool {return C::key(node->key, st) < 0;},
+				 [&ed] (rbtNode<K,D> *node, size_t, size_t) -> bool {return C::key(node->key, ed) <= 0;}, false);
 }
 
 /*
  * function_identifier: Limits all nodes, in the red-black tree, to have a key outside the ranges provided
- *						Deletes extras
+ *						Deletes extras. O(R*log(N)) for R ranges, plus the deleted nodes
  * parameters: 			The length of the arrays, an array of start keys, and an array of end keys
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_excludeKey(size_t arrayLength, K *st, K *ed) {
-		// Ignores the trival case
-	if (!size)
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_excludeKey(size_t arrayLength, K *st, K *ed) {
+		// Ignores the trival cases
+	if (!size || !arrayLength)
 		return;
 
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxM, **IdxE;
-	K *endPtr;
-
 		// Sorts the given key ranges based on their start key
-	quickSortPair(st, ed, 0, arrayLength - 1);
+	quickSortPair(st, ed, 0, arrayLength - 1, [] (const K &key1, const K &key2) -> bool {
+		return valueOrder(key1, key2, false);
+	});
 
-		// Gets the needed nodes and indexes
-	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
-	IdxE = rbtNodes + size;
-	endPtr = st + arrayLength;
-
-		// Cycles through the entire array of accessed nodes
-	while(1) {
-			// Saves all nodes before the current start key and after the previous end key
-		while((*IdxS)->key < *st) {
-			*IdxM++ = *IdxS++;
-				// Stops when we run out of nodes
-			if (IdxS == IdxE)
-				goto finish_exclude_key;
-		}
-			// Deletes all nodes after the current start key and before the current end key
-		while((*IdxS)->key <= *ed) {
-			delete *IdxS++;
-				// Stops when we run out of nodes
-			if (IdxS == IdxE)
-				goto finish_exclude_key;
-		}
-			// Moves forward in the start and end key arrays
-		st++; ed++;
-			// Stops when we run out of ranges to process
-		if (endPtr == st)
-			break;
-	}
-		// Deletes any extra nodes
-	while(IdxS != IdxE)
-		*IdxM++ = *IdxS++;
-
-finish_exclude_key:
-		// Calculates the size of the array of non-deleted nodes
-	size = IdxM - rbtNodes;
-
-		// Checks if there is any nodes left to process
-	if (size) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(0, size - 1, rbtNodes, &root);
-		root->parent = NULL;
-	} else
-			// If no remaining nodes, set root to NULL
-		root = NULL;
-
-		// Clears accessed node array
-	delete [] rbtNodes;
+		// Drops only the nodes inside the ranges, in order
+	limitBase(arrayLength, [st] (rbtNode<K,D> *node, size_t, size_t range) -> bool {return C::key(node->key, st[range]) < 0;},
+						   [ed] (rbtNode<K,D> *node, size_t, size_t range) -> bool {return C::key(node->key, ed[range]) <= 0;}, false);
 }
 
 /*
  * function_identifier: Limits all nodes, in the red-black tree, to have a key less than or equal to the key provided
- *						Deletes extras
+ *						Deletes extras. O(log(N)), plus the deleted nodes
  * parameters: 			A key limit
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_upperLimitKey(K lim) {
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxE;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbtNodes = rbt_getAllNodes();
-	IdxE = rbtNodes + size;
-
-		// Skips all nodes until one with a greater key than the limit is found
-	while(IdxS != IdxE && (*IdxS)->key <= lim)
-		IdxS++;
-
-		// Calculates the size of the new tree
-	size = IdxS - rbtNodes;
-
-		// Checks if there is any nodes left to process
-	if (size) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(0, size - 1, rbtNodes, &root);
-		root->parent = NULL;
-	} else
-			// If no remaining nodes, set root to NULL
-		root = NULL;
-
-		// Deletes all extra nodes
-	while(IdxS != IdxE)
-		delete *IdxS++;
-
-		// Clears accessed node array
-	delete [] rbtNodes;
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_upperLimitKey(K lim) {
+	limitBase(1, [] (rbtNode<K,D> *, size_t, size_t) -> bool {return false;},
+				 [&lim] (rbtNode<K,D> *node, size_t, size_t) -> bool {return C::key(node->key, lim) <= 0;}, true);
 }
 
 /*
  * function_identifier: Limits all nodes, in the red-black tree, to have a key greater than or equal to the key provided
- *						Deletes extras
+ *						Deletes extras. O(log(N)), plus the deleted nodes
  * parameters: 			A key limit
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_lowerLimitKey(K lim) {
-		// Initializes the needed values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxE;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbtNodes = rbt_getAllNodes();
-	IdxE = rbtNodes + size;
-
-		// Deletes all nodes until one with a greater key than the limit is found
-	while(IdxS != IdxE && (*IdxS)->key < lim)
-		delete *IdxS++;
-
-		// Checks if there is any nodes left to process
-	if (IdxE != IdxS) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(IdxS - rbtNodes, size - 1, rbtNodes, &root);
-		size = IdxE - IdxS;
-		root->parent = NULL;
-	} else {
-			// If no remaining nodes, set root to NULL and size to 0
-		root = NULL; size = 0;
-	}
-
-		// Clears accessed node array
-	delete [] rbtNodes;
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_lowerLimitKey(K lim) {
+	limitBase(1, [&lim] (rbtNode<K,D> *node, size_t, size_t) -> bool {return C::key(node->key, lim) < 0;},
+				 [] (rbtNode<K,D> *, size_t, size_t) -> bool {return true;}, true);
 }
 
 /*
  * function_identifier: Deletes a certain number of the nodes with the highest keys
+ *						O(log(N)), plus the deleted nodes
  * parameters: 			Number of nodes to delete
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_deleteHighestKey(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_deleteHighestKey(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -650,35 +497,21 @@ void rbTree<K,D>::rbt_deleteHighestKey(size_t val) {
 		rbt_clear();
 		return;
 	}
-		// Initializes the needed values
-	rbtNode<K,D> **IdxS, **IdxE;
 
-		// Gets the needed nodes and indexes
-	IdxS = rbt_getAllNodes(); IdxE = IdxS + size;
-
-		// Shortens the size
-	size -= val;
-
-		// Create a tree from vaild nodes
-	treeifyShallow(0, size - 1, IdxS, &root);
-	root->parent = NULL;
-
-		// Deletes extra nodes
-	IdxS += size;
-	while(IdxS != IdxE)
-		delete *IdxS++;
-
-		// Clears accessed node array
-	delete [] (IdxE - size - val);
+		// Keeps the nodes before the last val nodes
+	size_t cut = size - val;
+	limitBase(1, [] (rbtNode<K,D> *, size_t, size_t) -> bool {return false;},
+				 [cut] (rbtNode<K,D> *, size_t idx, size_t) -> bool {return idx < cut;}, true);
 }
 
 /*
  * function_identifier: Removes a certain number of the nodes with the highest keys
+ *						O(log(N)), plus the removed nodes
  * parameters: 			Number of keys to remove
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeHighestKey(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeHighestKey(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -686,56 +519,35 @@ void rbTree<K,D>::rbt_removeHighestKey(size_t val) {
 		rbt_clear();
 		return;
 	}
-		// Initializes the needed values
-	rbtNode<K,D> **IdxS, **IdxE;
-	K keyCheck;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbt_getAllNodes(); IdxE = IdxS + size - 1;
 
-		// Deletes the last node
-	keyCheck = (*IdxE)->key;
-	delete *IdxE--;
-
-		// Cycles through the array of accessed nodes until all nodes were considered or a break is reached
-	while(IdxS <= IdxE) {
-			// Checks if a node with a key is found
-		if ((*IdxE)->key != keyCheck) {
-				// If so, check if there are more nodes to remove
-			if (--val > 0) {
-					// If so, set a new key temp and start removing from here
-				keyCheck = (*IdxE)->key;
-			} else
-					// Else, we are finished here
+		// Walks down from the last node, until val keys have passed, to find how many nodes are kept
+	iterator it = --end();
+	K keyCheck = it->key;
+	size_t cut = size;
+	while(cut) {
+			// Checks if a new key is found, and if it is one more than needs to be removed
+		if (C::key(it->key, keyCheck) != 0) {
+			if (!--val)
 				break;
+			keyCheck = it->key;
 		}
-			// Deletes the current node and decreases the index
-		delete *IdxE--;
+		if (--cut)
+			--it;
 	}
 
-		// Calculates the size of the array of non-deleted nodes
-	size = IdxE - IdxS + 1;
-
-		// Checks if there is any nodes left to process
-	if (size) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(0, size - 1, IdxS, &root);
-		root->parent = NULL;
-	} else
-			// If no remaining nodes, set root to NULL
-		root = NULL;
-
-		// Clears accessed node array
-	delete [] IdxS;
+		// Keeps the nodes before the removed keys
+	limitBase(1, [] (rbtNode<K,D> *, size_t, size_t) -> bool {return false;},
+				 [cut] (rbtNode<K,D> *, size_t idx, size_t) -> bool {return idx < cut;}, true);
 }
 
 /*
  * function_identifier: Deletes a certain number of the nodes with the lowest keys
+ *						O(log(N)), plus the deleted nodes
  * parameters: 			Number of nodes to delete
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_deleteLowestKey(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_deleteLowestKey(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -743,34 +555,20 @@ void rbTree<K,D>::rbt_deleteLowestKey(size_t val) {
 		rbt_clear();
 		return;
 	}
-		// Initializes the needed values
-	rbtNode<K,D> **IdxS, **IdxE;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbt_getAllNodes(); IdxE = IdxS + val;
-
-		// Create a tree from vaild nodes
-	treeifyShallow(val, size - 1, IdxS, &root);
-	root->parent = NULL;
-
-		// Deletes extra nodes
-	while(IdxS != IdxE)
-		delete *IdxS++;
 
-		// Clears accessed node array
-	delete [] (IdxE - val);
-
-		// Shortens the size
-	size -= val;
+		// Keeps the nodes after the first val nodes
+	limitBase(1, [val] (rbtNode<K,D> *, size_t idx, size_t) -> bool {return idx < val;},
+				 [] (rbtNode<K,D> *, size_t, size_t) -> bool {return true;}, true);
 }
 
 /*
  * function_identifier: Removes a certain number of the nodes with the lowest keys
+ *						O(log(N)), plus the removed nodes
  * parameters: 			Number of keys to remove
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeLowestKey(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeLowestKey(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -778,48 +576,25 @@ void rbTree<K,D>::rbt_removeLowestKey(size_t val) {
 		rbt_clear();
 		return;
 	}
-		// Initializes the needed values
-	rbtNode<K,D> **IdxS, **IdxE;
-	K keyCheck;
-
-		// Gets the needed nodes and indexes
-	IdxS = rbt_getAllNodes(); IdxE = IdxS + size;
-
-		// Deletes the first node
-	keyCheck = (*IdxS)->key;
-	delete *IdxS++;
 
-		// Cycles through the array of accessed nodes until all nodes were considered or a break is reached
-	while(IdxS != IdxE) {
-			// Checks if a node with a key is found
-		if ((*IdxS)->key != keyCheck) {
-				// If so, check if there are more nodes to remove
-			if (--val > 0) {
-					// If so, set a new key temp and start removing from here
-				keyCheck = (*IdxS)->key;
-			} else
-					// Else, we are finished here
+		// Walks up from the first node, until val keys have passed, to find how many nodes are removed
+	iterator it = begin();
+	K keyCheck = it->key;
+	size_t cut = 0;
+	while(cut != size) {
+			// Checks if a new key is found, and if it is one more than needs to be removed
+		if (C::key(it->key, keyCheck) != 0) {
+			if (!--val)
 				break;
+			keyCheck = it->key;
 		}
-			// Deletes the current node and increases the index
-		delete *IdxS++;
+		cut++;
+		++it;
 	}
 
-		// Calculates the size of the array of non-deleted nodes
-	IdxE -= size;
-	size += IdxE - IdxS;
-
-		// Checks if there is any nodes left to process
-	if (size) {
-			// If there are remaining nodes, create a tree from them
-		treeifyShallow(0, size - 1, IdxS, &root);
-		root->parent = NULL;
-	} else
-			// If no remaining nodes, set root to NULL
-		root = NULL;
-
-		// Clears accessed node array
-	delete [] IdxE;
+		// Keeps the nodes after the removed keys
+	limitBase(1, [cut] (rbtNode<K,D> *, size_t idx, size_t) -> bool {return idx < cut;},
+				 [] (rbtNode<K,D> *, size_t, size_t) -> bool {return true;}, true);
 }
 
 	/*		DATA	  */
@@ -830,14 +605,24 @@ void rbTree<K,D>::rbt_removeLowestKey(size_t val) {
  * parameters: 			The start and end data of a range
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clampData(D st, D ed) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clampData(D st, D ed) {
 		// Ignores the trival case
-	if (st > ed) {
+	if (C::data(st, ed) > 0) {
 		rbt_clear();
 		return;
 	}
 
+#ifdef RBT_DATA_INDEX
+		// If few nodes are outside the range, deletes them one at a time through the data index
+	rbtNode<K,D> *node;
+	size_t low = dataRankBase(st, false, &node), high = size - dataRankBase(ed, true, &node);
+	if (dataFewBase(low + high)) {
+		dataTrimBase(low, high);
+		return;
+	}
+#endif
+
 		// Initializes the needed values
 	rbtNode<K,D> **IdxS, **IdxM, **IdxE;
 
@@ -849,8 +634,8 @@ void rbTree<K,D>::rbt_clampData(D st, D ed) {
 			// Saves nodes within range, deletes all nodes that are outside
 	while(IdxE >= IdxS)
 			// Deletes nodes outside range
-		if ((*IdxS)->data < st || (*IdxS)->data > ed)
-			delete *IdxS++;
+		if (C::data((*IdxS)->data, st) < 0 || C::data((*IdxS)->data, ed) > 0)
+			freeNode(*IdxS++);
 		else
 			// Saves node at next vaild spot
 			*IdxM++ = *IdxS++;
@@ -878,8 +663,8 @@ void rbTree<K,D>::rbt_clampData(D st, D ed) {
  * parameters: 			The length of the arrays, an array of start data, and an array of end data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clampData(size_t arrayLength, D *st, D *ed) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clampData(size_t arrayLength, D *st, D *ed) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -889,7 +674,9 @@ void rbTree<K,D>::rbt_clampData(size_t arrayLength, D *st, D *ed) {
 	D *endPtr;
 
 		// Sorts the given data ranges based on their start data
-	quickSortPair(st, ed, 0, arrayLength - 1);
+	quickSortPair(st, ed, 0, arrayLength - 1, [] (const D &data1, const D &data2) -> bool {
+		return valueOrder(data1, data2, true);
+	});
 
 		// Gets the needed nodes and indexes
 	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
@@ -897,20 +684,19 @@ void rbTree<K,D>::rbt_clampData(size_t arrayLength, D *st, D *ed) {
 	endPtr = st + arrayLength;
 
 		// Sorts the nodes
-	fooPtr<K,D> = dataCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
+	mergeSortCallerBase(rbtNodes, 0, size - 1, compair<DATA>());
 
 		// Cycles through the entire array of accessed nodes
 	while(1) {
 			// Deletes all nodes before the current start data and after the previous end data
-		while((*IdxS)->data < *st) {
-			delete *IdxS++;
+		while(C::data((*IdxS)->data, *st) < 0) {
+			freeNode(*IdxS++);
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_clamp_data;
 		}
 			// Saves all nodes after the current start data and before the current end data 
-		while((*IdxS)->data <= *ed) {
+		while(C::data((*IdxS)->data, *ed) <= 0) {
 			*IdxM++ = *IdxS++;
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
@@ -924,7 +710,7 @@ void rbTree<K,D>::rbt_clampData(size_t arrayLength, D *st, D *ed) {
 	}
 		// Deletes any extra nodes
 	while(IdxS != IdxE)
-		delete *IdxS++;
+		freeNode(*IdxS++);
 
 finish_clamp_data:
 		// Calculates the size of the array of non-deleted nodes
@@ -933,8 +719,7 @@ finish_clamp_data:
 		// Checks if there is any nodes left to process
 	if (size) {
 			// Sorts the nodes
-		fooPtr<K,D> = keyDataCompair;
-		mergeSortCallerBase(rbtNodes, 0, size - 1);
+		mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 		
 			// If there are remaining nodes, create a tree from them
 		treeifyShallow(0, size - 1, rbtNodes, &root);
@@ -953,11 +738,24 @@ finish_clamp_data:
  * parameters: 			The start and end data of a range
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_excludeData(D st, D ed) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_excludeData(D st, D ed) {
 		// Ignores the trival case
-	if (st > ed)
+	if (C::data(st, ed) > 0)
+		return;
+
+#ifdef RBT_DATA_INDEX
+		// If few nodes are inside the range, deletes them one at a time through the data index
+	rbtNode<K,D> *node;
+	size_t count = dataRankBase(ed, true, &node) - dataRankBase(st, false, &node);
+	if (dataFewBase(count)) {
+		while(count--) {
+			dataRankBase(st, false, &node);
+			rbt_delete(node);
+		}
 		return;
+	}
+#endif
 
 		// Initializes the needed values
 	rbtNode<K,D> **IdxS, **IdxM, **IdxE;
@@ -970,11 +768,11 @@ void rbTree<K,D>::rbt_excludeData(D st, D ed) {
 			// Saves nodes outside range, deletes all nodes that are inside
 	while(IdxE >= IdxS)
 			// Saves node at next vaild spot if outside range
-		if ((*IdxS)->key < st || (*IdxS)->key > ed)
+		if (C::data((*IdxS)->data, st) < 0 || C::data((*IdxS)->data, ed) > 0)
 			*IdxM++ = *IdxS++;
 		else
 			// Deletes nodes inside range
-			delete *IdxS++;
+			freeNode(*IdxS++);
 
 		// Resets IdxS to start of node array and calculates the size
 	IdxS -= size;
@@ -999,8 +797,8 @@ void rbTree<K,D>::rbt_excludeData(D st, D ed) {
  * parameters: 			The length of the arrays, an array of start data, and an array of end data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_excludeData(size_t arrayLength, D *st, D *ed) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_excludeData(size_t arrayLength, D *st, D *ed) {
 		// Ignores the trival case
 	if (!size)
 		return;
@@ -1010,7 +808,9 @@ void rbTree<K,D>::rbt_excludeData(size_t arrayLength, D *st, D *ed) {
 	D *endPtr;
 
 		// Sorts the given data ranges based on their start data
-	quickSortPair(st, ed, 0, arrayLength - 1);
+	quickSortPair(st, ed, 0, arrayLength - 1, [] (const D &data1, const D &data2) -> bool {
+		return valueOrder(data1, data2, true);
+	});
 
 		// Gets the needed nodes and indexes
 	IdxS = IdxM = rbtNodes = rbt_getAllNodes();
@@ -1018,21 +818,20 @@ void rbTree<K,D>::rbt_excludeData(size_t arrayLength, D *st, D *ed) {
 	endPtr = st + arrayLength;
 
 		// Sorts the nodes
-	fooPtr<K,D> = dataCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
+	mergeSortCallerBase(rbtNodes, 0, size - 1, compair<DATA>());
 
 		// Cycles through the entire array of accessed nodes
 	while(1) {
 			// Saves all nodes before the current start data and after the previous end data
-		while((*IdxS)->data < *st) {
+		while(C::data((*IdxS)->data, *st) < 0) {
 			*IdxM++ = *IdxS++;
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_exclude_data;
 		}
 			// Deletes all nodes after the current start data and before the current end data
-		while((*IdxS)->data <= *ed) {
-			delete *IdxS++;
+		while(C::data((*IdxS)->data, *ed) <= 0) {
+			freeNode(*IdxS++);
 				// Stops when we run out of nodes
 			if (IdxS == IdxE)
 				goto finish_exclude_data;
@@ -1054,8 +853,7 @@ finish_exclude_data:
 		// Checks if there is any nodes left to process
 	if (size) {
 			// Sorts the nodes
-		fooPtr<K,D> = keyDataCompair;
-		mergeSortCallerBase(rbtNodes, 0, size - 1);
+		mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
 
 			// If there are remaining nodes, create a tree from them
 		treeifyShallow(0, size - 1, rbtNodes, &root);
@@ -1074,12 +872,22 @@ finish_exclude_data:
  * parameters: 			A data limit
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_upperLimitData(D lim) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_upperLimitData(D lim) {
 		// Ignores the trival case
 	if (!size)
 		return;
 
+#ifdef RBT_DATA_INDEX
+		// If few nodes have a greater data, deletes them one at a time through the data index
+	rbtNode<K,D> *node;
+	size_t high = size - dataRankBase(lim, true, &node);
+	if (dataFewBase(high)) {
+		dataTrimBase(0, high);
+		return;
+	}
+#endif
+
 		// Initializes the needed values
 	rbtNode<K,D> **rbtNodes, **IdxS, **IdxM, **IdxE;
 
@@ -1089,10 +897,10 @@ void rbTree<K,D>::rbt_upperLimitData(D lim) {
 
 		// Deletes all nodes with a greater data
 	do {
-		if ((*IdxS)->data <= lim)
+		if (C::data((*IdxS)->data, lim) <= 0)
 			*IdxM++ = *IdxS;
 		else
-			delete *IdxS;
+			freeNode(*IdxS);
 	} while(++IdxS != IdxE);
 
 		// Calculates the size of the new tree
@@ -1117,12 +925,22 @@ void rbTree<K,D>::rbt_upperLimitData(D lim) {
  * parameters: 			A data limit
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_lowerLimitData(D lim) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_lowerLimitData(D lim) {
 		// Ignores the trival case
 	if (!size)
 		return;
 
+#ifdef RBT_DATA_INDEX
+		// If few nodes have a smaller data, deletes them one at a time through the data index
+	rbtNode<K,D> *node;
+	size_t low = dataRankBase(lim, false, &node);
+	if (dataFewBase(low)) {
+		dataTrimBase(low, 0);
+		return;
+	}
+#endif
+
 		// Initializes the needed values
 	rbtNode<K,D> **rbtNodes, **IdxS, **IdxM, **IdxE;
 
@@ -1132,10 +950,10 @@ void rbTree<K,D>::rbt_lowerLimitData(D lim) {
 
 		// Deletes all nodes with a smaller data
 	do {
-		if ((*IdxS)->data >= lim)
+		if (C::data((*IdxS)->data, lim) >= 0)
 			*IdxM++ = *IdxS;
 		else
-			delete *IdxS;
+			freeNode(*IdxS);
 	} while(++IdxS != IdxE);
 
 		// Calculates the size of the new tree
@@ -1159,8 +977,8 @@ void rbTree<K,D>::rbt_lowerLimitData(D lim) {
  * parameters: 			Number of nodes to delete
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_deleteHighestData(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_deleteHighestData(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -1175,11 +993,9 @@ void rbTree<K,D>::rbt_deleteHighestData(size_t val) {
 	IdxS = rbt_getAllNodes(); IdxE = IdxS + size;
 
 		// Gets a sorts a subset of the nodes, divided via their data
-	fooPtr<K,D> = dataCompair;
-	mergeSortCallerBase(IdxS, 0, size - 1);
+	mergeSortCallerBase(IdxS, 0, size - 1, compair<DATA>());
 	size -= val; // Shortens the size
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(IdxS, 0, size - 1);
+	mergeSortCallerBase(IdxS, 0, size - 1, compair<KEYDATA>());
 
 		// Create a tree from vaild nodes
 	treeifyShallow(0, size - 1, IdxS, &root);
@@ -1188,7 +1004,7 @@ void rbTree<K,D>::rbt_deleteHighestData(size_t val) {
 		// Deletes extra nodes
 	IdxS += size;
 	while(IdxS != IdxE)
-		delete *IdxS++;
+		freeNode(*IdxS++);
 
 		// Clears accessed node array
 	delete [] (IdxE - size - val);
@@ -1199,8 +1015,8 @@ void rbTree<K,D>::rbt_deleteHighestData(size_t val) {
  * parameters: 			Number of data values to remove
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeHighestData(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeHighestData(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -1216,17 +1032,16 @@ void rbTree<K,D>::rbt_removeHighestData(size_t val) {
 	IdxS = rbt_getAllNodes(); IdxE = IdxS + size - 1;
 
 		// Sorts the nodes
-	fooPtr<K,D> = dataCompair;
-	mergeSortCallerBase(IdxS, 0, size - 1);
+	mergeSortCallerBase(IdxS, 0, size - 1, compair<DATA>());
 
 		// Deletes the last node
 	dataCheck = (*IdxE)->data;
-	delete *IdxE--;
+	freeNode(*IdxE--);
 
 		// Cycles through the array of accessed nodes until all nodes were considered or a break is reached
 	while(IdxS <= IdxE) {
 			// Checks if a node with a data is found
-		if ((*IdxE)->data != dataCheck) {
+		if (C::data((*IdxE)->data, dataCheck) != 0) {
 				// If so, check if there are more nodes to remove
 			if (--val > 0)
 					// If so, set a new data temp and start removing from here
@@ -1236,7 +1051,7 @@ void rbTree<K,D>::rbt_removeHighestData(size_t val) {
 				break;
 		}
 			// Deletes the current node and decreases the index
-		delete *IdxE--;
+		freeNode(*IdxE--);
 	}
 
 		// Calculates the size of the array of non-deleted nodes
@@ -1245,8 +1060,7 @@ void rbTree<K,D>::rbt_removeHighestData(size_t val) {
 		// Checks if there is any nodes left to process
 	if (size) {
 			// If there are remaining nodes, sort them and create a tree from the result
-		fooPtr<K,D> = keyDataCompair;
-		mergeSortCallerBase(IdxS, 0, size - 1);
+		mergeSortCallerBase(IdxS, 0, size - 1, compair<KEYDATA>());
 		treeifyShallow(0, size - 1, IdxS, &root);
 		root->parent = NULL;
 	} else
@@ -1262,8 +1076,8 @@ void rbTree<K,D>::rbt_removeHighestData(size_t val) {
  * parameters: 			Number of nodes to delete
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_deleteLowestData(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_deleteLowestData(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -1278,11 +1092,9 @@ void rbTree<K,D>::rbt_deleteLowestData(size_t val) {
 	IdxS = rbt_getAllNodes(); IdxE = IdxS + val;
 
 		// Gets a sorts a subset of the nodes, divided via their data
-	fooPtr<K,D> = dataCompair;
-	mergeSortCallerBase(IdxS, 0, size - 1);
+	mergeSortCallerBase(IdxS, 0, size - 1, compair<DATA>());
 	size -= val; // Shortens the size
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(IdxE, 0, size - 1);
+	mergeSortCallerBase(IdxE, 0, size - 1, compair<KEYDATA>());
 
 		// Create a tree from vaild nodes
 	treeifyShallow(0, size - 1, IdxE, &root);
@@ -1290,7 +1102,7 @@ void rbTree<K,D>::rbt_deleteLowestData(size_t val) {
 
 		// Deletes extra nodes
 	while(IdxS != IdxE)
-		delete *IdxS++;
+		freeNode(*IdxS++);
 
 		// Clears accessed node array
 	delete [] (IdxE - val);
@@ -1301,8 +1113,8 @@ void rbTree<K,D>::rbt_deleteLowestData(size_t val) {
  * parameters: 			Number of data values to remove
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_removeLowestData(size_t val) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_removeLowestData(size_t val) {
 		// Ignores the trival cases
 	if (!val)
 		return;
@@ -1316,17 +1128,16 @@ void rbTree<K,D>::rbt_removeLowestData(size_t val) {
 
 		// Gets the needed nodes and indexes
 	IdxS = rbtNodes = rbt_getAllNodes(); IdxE = IdxS + size;
-	fooPtr<K,D> = dataCompair;
-	mergeSortCallerBase(IdxS, 0, size - 1);
+	mergeSortCallerBase(IdxS, 0, size - 1, compair<DATA>());
 
 		// Deletes the first node
 	dataCheck = (*IdxS)->data;
-	delete *IdxS++;
+	freeNode(*IdxS++);
 
 		// Cycles through the array of accessed nodes until all nodes were considered or a break is reached
 	while(IdxS != IdxE) {
 			// Checks if a node with a data is found
-		if ((*IdxS)->data != dataCheck) {
+		if (C::data((*IdxS)->data, dataCheck) != 0) {
 				// If so, check if there are more nodes to remove
 			if (--val > 0)
 					// If so, set a new key temp and start removing from here
@@ -1336,7 +1147,7 @@ void rbTree<K,D>::rbt_removeLowestData(size_t val) {
 				break;
 		}
 			// Deletes the current node and increases the index
-		delete *IdxS++;
+		freeNode(*IdxS++);
 	}
 
 		// Calculates the size of the array of non-deleted nodes
@@ -1345,8 +1156,7 @@ void rbTree<K,D>::rbt_removeLowestData(size_t val) {
 		// Checks if there is any nodes left to process
 	if (size) {
 			// If there are remaining nodes, sort them and create a tree from the result
-		fooPtr<K,D> = keyDataCompair;
-		mergeSortCallerBase(IdxS, 0, size - 1);
+		mergeSortCallerBase(IdxS, 0, size - 1, compair<KEYDATA>());
 		treeifyShallow(0, size - 1, IdxS, &root);
 		root->parent = NULL;
 	} else
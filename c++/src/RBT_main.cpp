@@ -13,6 +13,68 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                             DEFAULT ORDERING                               | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Compares two keys with operator< and operator==
+ * parameters: 			Two keys
+ * return value:		Negative if the first key is less, 0 if they are equal, and positive otherwise
+*/
+template <typename K, typename D>
+inline int rbtCompare<K,D>::key(const K &key1, const K &key2) {
+	return key1 < key2 ? -1 : !(key1 == key2);
+}
+
+/*
+ * function_identifier: Compares two data values with operator< and operator==
+ * parameters: 			Two data values
+ * return value:		Negative if the first data value is less, 0 if they are equal, and positive otherwise
+*/
+template <typename K, typename D>
+inline int rbtCompare<K,D>::data(const D &data1, const D &data2) {
+	return data1 < data2 ? -1 : !(data1 == data2);
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                             DEFAULT AGGREGATE                              | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: The aggregate of no nodes (nothing is kept by default)
+ * parameters: 			N/A
+ * return value:		An empty aggregate
+*/
+template <typename K, typename D>
+inline typename rbtAggregate<K,D>::type rbtAggregate<K,D>::identity() {
+	return type();
+}
+
+/*
+ * function_identifier: The aggregate of a single node (nothing is kept by default)
+ * parameters: 			The node's key and data
+ * return value:		An empty aggregate
+*/
+template <typename K, typename D>
+inline typename rbtAggregate<K,D>::type rbtAggregate<K,D>::lift(const K &, const D &) {
+	return type();
+}
+
+/*
+ * function_identifier: Joins the aggregates of two runs of nodes (nothing is kept by default)
+ * parameters: 			The aggregates of the earlier and the later run
+ * return value:		An empty aggregate
+*/
+template <typename K, typename D>
+inline typename rbtAggregate<K,D>::type rbtAggregate<K,D>::combine(const type &, const type &) {
+	return type();
+}
+
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                              NODE FUNCTIONS                                | */
@@ -29,10 +91,22 @@ rbtNode<K,D>::rbtNode(K Key, D Data) {
 		// Initialize basic values for the node
 	parent = left = right = NULL;
 	descendants = 0;
+#ifdef RBT_DATA_BOUNDS
+	minData = maxData = this;
+#endif
+#ifdef RBT_DATA_INDEX
+	dataLeft = dataRight = dataParent = NULL;
+	dataDescendants = 0;
+	dataColor = false;
+#endif
 
 		// Copy over basic values for the node
 	key = Key;
 	data = Data;
+
+		// A lone node's aggregate is its own
+	if constexpr (!std::is_same<typename rbtAggregate<K,D>::type, rbtNoAggregate>::value)
+		this->aggregate = rbtAggregate<K,D>::lift(key, data);
 }
 
 /*
@@ -45,11 +119,23 @@ rbtNode<K,D>::rbtNode(const rbtNode<K,D> *newNode) {
 		// Initialize basic values for the node
 	parent = left = right = NULL;
 	descendants = 0;
+#ifdef RBT_DATA_BOUNDS
+	minData = maxData = this;
+#endif
+#ifdef RBT_DATA_INDEX
+	dataLeft = dataRight = dataParent = NULL;
+	dataDescendants = 0;
+	dataColor = false;
+#endif
 
 		// Copy over basic values for the node
 	data = newNode->data;
 	key = newNode->key;
-	color = newNode->color;
+	setColor(newNode->getColor());
+
+		// A lone node's aggregate is its own
+	if constexpr (!std::is_same<typename rbtAggregate<K,D>::type, rbtNoAggregate>::value)
+		this->aggregate = rbtAggregate<K,D>::lift(key, data);
 }
 
 /*
@@ -72,6 +158,34 @@ K rbtNode<K,D>::rbt_getKey() const {
 	return key;
 }
 
+/*
+ * function_identifier: Returns the color of a node
+ * parameters: 			N/A
+ * return value:		True if the node is red, false if it is black
+*/
+template <typename K, typename D>
+inline bool rbtNode<K,D>::getColor() const {
+#ifdef RBT_COMPACT_NODES
+	return parent.getColor();
+#else
+	return color;
+#endif
+}
+
+/*
+ * function_identifier: Sets the color of a node
+ * parameters: 			True to color the node red, false to color it black
+ * return value:		N/A
+*/
+template <typename K, typename D>
+inline void rbtNode<K,D>::setColor(bool red) {
+#ifdef RBT_COMPACT_NODES
+	parent.setColor(red);
+#else
+	color = red;
+#endif
+}
+
 /*
  * function_identifier: Checks if two nodes have the same keys and data values
  * parameters: 			A node
@@ -82,19 +196,161 @@ bool rbtNode<K,D>::equal(const rbtNode<K,D> *node) {
 	return ((key == node->key) && (data == node->data));
 }
 
+#ifdef RBT_COMPACT_NODES
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                           NODE LINK FUNCTIONS                              | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Points the link at a new parent, keeping the stored color
+ * parameters: 			A node
+ * return value:		This link
+*/
+template <typename K, typename D>
+inline rbtLink<K,D> &rbtLink<K,D>::operator=(rbtNode<K,D> *node) {
+	bits = reinterpret_cast<uintptr_t>(node) | (bits & 1);
+	return *this;
+}
+
+/*
+ * function_identifier: Points the link at another link's parent, keeping the stored color
+ * parameters: 			A link
+ * return value:		This link
+*/
+template <typename K, typename D>
+inline rbtLink<K,D> &rbtLink<K,D>::operator=(const rbtLink<K,D> &link) {
+	return *this = static_cast<rbtNode<K,D> *>(link);
+}
+
+/*
+ * function_identifier: Converts the link into the parent node it points at
+ * parameters: 			N/A
+ * return value:		A node
+*/
+template <typename K, typename D>
+inline rbtLink<K,D>::operator rbtNode<K,D> *() const {
+	return reinterpret_cast<rbtNode<K,D> *>(bits & ~(uintptr_t)1);
+}
+
+/*
+ * function_identifier: Accesses the parent node the link points at
+ * parameters: 			N/A
+ * return value:		A node
+*/
+template <typename K, typename D>
+inline rbtNode<K,D> *rbtLink<K,D>::operator->() const {
+	return reinterpret_cast<rbtNode<K,D> *>(bits & ~(uintptr_t)1);
+}
+
+/*
+ * function_identifier: Returns the color stored in the low bit of the link
+ * parameters: 			N/A
+ * return value:		True if red, false if black
+*/
+template <typename K, typename D>
+inline bool rbtLink<K,D>::getColor() const {
+	return bits & 1;
+}
+
+/*
+ * function_identifier: Stores a color in the low bit of the link
+ * parameters: 			True for red, false for black
+ * return value:		N/A
+*/
+template <typename K, typename D>
+inline void rbtLink<K,D>::setColor(bool red) {
+	bits = (bits & ~(uintptr_t)1) | (uintptr_t)red;
+}
+#endif
+
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                         RED-BLACK TREE FUNCTIONS                           | */
 /* |                                                                            | */
 /*	============================================================================  */
 
+/*
+ * function_identifier: Allocates a new node from the tree's pool, creating the pool on first use
+ * parameters: 			A key and data values
+ * return value:		A node
+*/
+template <typename K, typename D, typename C>
+inline rbtNode<K,D> *rbTree<K,D,C>::allocNode(K key, D data) {
+	if (!pool)
+		pool = std::make_shared<rbtPool<K,D>>();
+	return new (pool->allocate()) rbtNode<K,D>(key, data);
+}
+
+/*
+ * function_identifier: Allocates a copy of a node from the tree's pool, creating the pool on first use
+ * parameters: 			A node
+ * return value:		A node
+*/
+template <typename K, typename D, typename C>
+inline rbtNode<K,D> *rbTree<K,D,C>::allocNode(const rbtNode<K,D> *node) {
+	if (!pool)
+		pool = std::make_shared<rbtPool<K,D>>();
+	return new (pool->allocate()) rbtNode<K,D>(node);
+}
+
+/*
+ * function_identifier: Destroys a node and returns its storage to the tree's pool
+ * parameters: 			A node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::freeNode(rbtNode<K,D> *node) {
+	node->~rbtNode<K,D>();
+	pool->deallocate(node);
+}
+
+/*
+ * function_identifier: Recalculates what a node keeps about its subtree, from its children: the subtree's aggregate,
+ *						and (with RBT_DATA_BOUNDS) the nodes with the smallest and largest data. Ties go to the first
+ *						node in order for the minimum, and the last for the maximum. Does nothing if nodes keep neither
+ * parameters: 			A node whose children are up to date
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::augmentBase(rbtNode<K,D> *node) {
+		// Joins the aggregates in key order: left branch, node, right branch
+	if constexpr (!std::is_same<typename aggregator::type, rbtNoAggregate>::value) {
+		node->aggregate = aggregator::lift(node->key, node->data);
+		if (node->left)
+			node->aggregate = aggregator::combine(node->left->aggregate, node->aggregate);
+		if (node->right)
+			node->aggregate = aggregator::combine(node->aggregate, node->right->aggregate);
+	}
+
+#ifdef RBT_DATA_BOUNDS
+		// Starts from the left branch's bounds, or the node itself
+	node->minData = node->maxData = node;
+	if (node->left) {
+		node->minData = C::data(node->data, node->left->minData->data) < 0 ? node : node->left->minData;
+		node->maxData = C::data(node->data, node->left->maxData->data) >= 0 ? node : node->left->maxData;
+	}
+
+		// Then lets the right branch's bounds take over
+	if (node->right) {
+		if (C::data(node->right->minData->data, node->minData->data) < 0)
+			node->minData = node->right->minData;
+		if (C::data(node->right->maxData->data, node->maxData->data) >= 0)
+			node->maxData = node->right->maxData;
+	}
+#else
+	(void)node;
+#endif
+}
+
 /*
  * function_identifier: Performs a left rotation in the red-black tree
  * parameters: 			The pivot node
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::leftRotate(rbtNode<K,D> *pivot) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::leftRotate(rbtNode<K,D> *pivot) {
 		// Return if invaild pivot given
 	if(!pivot || !pivot->right) return;
 
@@ -128,6 +384,10 @@ void rbTree<K,D>::leftRotate(rbtNode<K,D> *pivot) {
 	detach->descendants = pivot->descendants + 1;
 	if(detach->right)
 		detach->descendants += detach->right->descendants + 1;
+
+		// Corrects what each node keeps about its subtree, pivot first as it is now below detach
+	augmentBase(pivot);
+	augmentBase(detach);
 }
 
 /*
@@ -135,8 +395,8 @@ void rbTree<K,D>::leftRotate(rbtNode<K,D> *pivot) {
  * parameters: 			The pivot node
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rightRotate(rbtNode<K,D> *pivot) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rightRotate(rbtNode<K,D> *pivot) {
 		// Return if invaild pivot given
 	if(!pivot || !pivot->left) return;
 
@@ -171,6 +431,10 @@ void rbTree<K,D>::rightRotate(rbtNode<K,D> *pivot) {
 	detach->descendants = pivot->descendants + 1;
 	if(detach->left)
 		detach->descendants += detach->left->descendants + 1;
+
+		// Corrects what each node keeps about its subtree, pivot first as it is now below detach
+	augmentBase(pivot);
+	augmentBase(detach);
 }
 
 /*
@@ -178,14 +442,14 @@ void rbTree<K,D>::rightRotate(rbtNode<K,D> *pivot) {
  * parameters: 			The root node of the branch to delete
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::deleteBranch(rbtNode<K,D> *curr) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::deleteBranch(rbtNode<K,D> *curr) {
 		// Recursively delete descendants
 	if(curr->left) deleteBranch(curr->left);
 	if(curr->right) deleteBranch(curr->right);
 
 		// Frees the current root node
-	delete curr;
+	freeNode(curr);
 }
 
 /*
@@ -193,8 +457,8 @@ void rbTree<K,D>::deleteBranch(rbtNode<K,D> *curr) {
  * parameters: 			A node in the original red-black tree, and a position in the new red-black tree
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::copyTree(rbtNode<K,D> *curr, rbtNode<K,D> **currNew){
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::copyTree(rbtNode<K,D> *curr, rbtNode<K,D> **currNew){
 		// Ignores the trival case
 	if(!curr) {
 		*currNew = NULL;
@@ -202,8 +466,8 @@ void rbTree<K,D>::copyTree(rbtNode<K,D> *curr, rbtNode<K,D> **currNew){
 	}
 
 		// Allocates a new node for the copy tree
-	*currNew = new rbtNode<K,D>(curr);
-	(*currNew)->color = curr->color;
+	*currNew = allocNode(curr);
+	(*currNew)->setColor(curr->getColor());
 	(*currNew)->descendants = curr->descendants;
 
 	// Sets the children node's parents appropriately
@@ -218,6 +482,24 @@ void rbTree<K,D>::copyTree(rbtNode<K,D> *curr, rbtNode<K,D> **currNew){
 	if((*currNew)->right)
 			// If there is a right child, set its parent
 		(*currNew)->right->parent = *currNew;
+
+		// Sets what the node keeps about its subtree, now that both children are copied
+	augmentBase(*currNew);
+}
+
+/*
+ * function_identifier: Exchanges the nodes, size and pool of two red-black trees
+ * parameters: 			A red-black tree
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::swapTree(rbTree<K,D,C> &rbt) {
+	std::swap(root, rbt.root);
+	std::swap(size, rbt.size);
+#ifdef RBT_DATA_INDEX
+	std::swap(dataRoot, rbt.dataRoot);
+#endif
+	pool.swap(rbt.pool);
 }
 
 /*
@@ -225,16 +507,23 @@ void rbTree<K,D>::copyTree(rbtNode<K,D> *curr, rbtNode<K,D> **currNew){
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_free() {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_free() {
 		// Ignores the trival case
 	if(!root) return;
 
+		// If no other tree shares the pool and no node needs its destructor run, drop every slab at once
+	if constexpr (std::is_trivially_destructible_v<K> && std::is_trivially_destructible_v<D>)
+		if (pool.use_count() == 1) {
+			pool->reset();
+			return;
+		}
+
 		// Deletes all of the root's descendants
 	if(root->right) deleteBranch(root->right);
 	if(root->left) deleteBranch(root->left);
 
-	delete root;
+	freeNode(root);
 }
 
 /*
@@ -242,18 +531,29 @@ void rbTree<K,D>::rbt_free() {
  * parameters: 			N/A
  * return value:		A node
 */
-template <typename K, typename D>
-rbtNode<K,D> *rbTree<K,D>::rbt_getRoot() const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_getRoot() const {
 	return root;
 }
 
+/*
+ * function_identifier: Returns the node pool used by the red-black tree, so other trees may share it
+ *						A shared pool is not synchronized; trees sharing a pool must not be modified concurrently
+ * parameters: 			N/A
+ * return value:		The tree's node pool
+*/
+template <typename K, typename D, typename C>
+std::shared_ptr<rbtPool<K,D>> rbTree<K,D,C>::rbt_getPool() const {
+	return pool;
+}
+
 /*
  * function_identifier: Checks if the red-black tree is empty
  * parameters: 			N/A
  * return value:		Boolean with value depending if the tree if empty or not
 */
-template <typename K, typename D>
-bool rbTree<K,D>::rbt_isEmpty() const {
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::rbt_isEmpty() const {
 	return size == 0;
 }
 
@@ -262,8 +562,8 @@ bool rbTree<K,D>::rbt_isEmpty() const {
  * parameters: 			N/A
  * return value:		the red-black tree's size
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_getSize() const {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_getSize() const {
 	return size;
 }
 
@@ -272,15 +572,56 @@ size_t rbTree<K,D>::rbt_getSize() const {
  * parameters: 			The key and data to insert
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_insert(K key, D data) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_insert(K key, D data) {
+		// Checks for node overflow while increasing size
+	if (++size == 0 || size - 1 > (rbt_count_t)-1)
+		throw std::overflow_error ("overflow - too many inserted into the red black tree"); 
+
+		// Allocates a new node, and links it in
+	insertBase(allocNode(key, data));
+}
+
+/*
+ * function_identifier: Allows a user to insert new data, with given key, into a red-black tree, starting from a
+ *						nearby node. If the new node goes right before or after the hint, it takes two comparisons
+ *						The hint must be NULL or a node still in this tree. Hints from another tree are refused, by
+ *						an O(log(N)) climb to the root, but freed nodes cannot be told apart
+ * parameters: 			A node from the current tree (such as the last inserted node), and the key and data to insert
+ * return value:		The new node (which can be the next hint)
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::rbt_insert(rbtNode<K,D> *hint, K key, D data) {
+		// Checks if the hint is from this tree
+	rbtNode<K,D> *top = hint;
+	while(top && top->parent)
+		top = top->parent;
+	if (hint && top != root)
+		throw std::invalid_argument ("invalid argument - the hint is not a node of the red black tree");
+
 		// Checks for node overflow while increasing size
-	if (++size == 0)
+	if (++size == 0 || size - 1 > (rbt_count_t)-1)
 		throw std::overflow_error ("overflow - too many inserted into the red black tree"); 
 
-		// Allocates a new node
-	rbtNode<K,D> *opNode = new rbtNode<K,D>(key, data);
-	opNode->color = true;
+		// Allocates a new node, and links it in
+	rbtNode<K,D> *opNode = allocNode(key, data);
+	insertBase(opNode, hint);
+	return opNode;
+}
+
+/*
+ * function_identifier: Links a new, unlinked node into the red-black tree (after any equal nodes), and rebalances
+ *						Tries the hint's neighbours before descending from the root, so hinted sorted streams take two
+ *						comparisons per node. The tree's size must already count the node
+ * parameters: 			The node to insert, and a node from this tree to try first (or NULL)
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::insertBase(rbtNode<K,D> *opNode, rbtNode<K,D> *hint) {
+	opNode->setColor(true);
+
+		// Links the new node into the data index
+	dataInsertBase(opNode);
 
 		// If there is no root node, use the node we just created and finish
 	if(!root) {
@@ -290,127 +631,183 @@ void rbTree<K,D>::rbt_insert(K key, D data) {
 	else {
 			// Initializes the needed values
 		rbtNode<K,D> *temp = 0;
-		rbtNode<K,D> *curr = root;
-
-			// Finds an empty position that opNode can be put in
-		while(1) {
-				// Adding a child to this node
-			curr->descendants++;
-				// Sets temp to curr, before storing a child in curr
-			temp = curr;
-
-			if((opNode->key < curr->key) || ((opNode->key == curr->key) && (opNode->data < curr->data))){
-					// If opNode < curr, opNode should be somewhere at the left branch of curr
-					// temp is now curr's parent
-				curr = curr->left;
-					// If curr position is empty, fill it with opNode and finish
-				if(!curr) {
-					temp->left = opNode;
-					break;
-				}
+		rbtNode<K,D> *curr;
+		bool left = false;
+
+			// Checks if the new node goes between the hint and the node after it
+		if(hint && !keyDataCompair(opNode, hint)) {
+			iterator next(hint, root);
+			if(++next == end() || keyDataCompair(opNode, &*next)) {
+				left = hint->right != NULL;
+				temp = left ? &*next : hint;
+			}
+		}
+			// Else, checks if it goes between the node before the hint and the hint
+		else if(hint) {
+			iterator prev(hint, root);
+			if(--prev == end() || !keyDataCompair(opNode, &*prev)) {
+				left = !hint->left;
+				temp = left ? hint : &*prev;
 			}
-			else {
-					// If opNode > curr, opNode should be somewhere at the right branch of curr
-					// temp is now curr's parent
-				curr = curr->right;
-					// If curr position is empty, fill it with opNode and finish
-				if(!curr) {
-					temp->right = opNode;
-					break;
+		}
+
+		if(temp) {
+				// Fills the position with opNode, and sets opNode's parent appropriately
+			if(left) temp->left = opNode;
+			else temp->right = opNode;
+			opNode->parent = temp;
+
+				// Adds opNode to its ancestors' descendants
+			for(curr = temp; curr; curr = curr->parent)
+				curr->descendants++;
+		}
+		else {
+				// Finds an empty position that opNode can be put in
+			curr = root;
+			while(1) {
+					// Adding a child to this node
+				curr->descendants++;
+					// Sets temp to curr, before storing a child in curr
+				temp = curr;
+
+					// Orders by key first and then by data, with one key comparison per level
+				int cmp = C::key(opNode->key, curr->key);
+				if(cmp < 0 || (!cmp && C::data(opNode->data, curr->data) < 0)){
+						// If opNode < curr, opNode should be somewhere at the left branch of curr
+						// temp is now curr's parent
+					curr = curr->left;
+						// If curr position is empty, fill it with opNode and finish
+					if(!curr) {
+						temp->left = opNode;
+						break;
+					}
+				}
+				else {
+						// If opNode > curr, opNode should be somewhere at the right branch of curr
+						// temp is now curr's parent
+					curr = curr->right;
+						// If curr position is empty, fill it with opNode and finish
+					if(!curr) {
+						temp->right = opNode;
+						break;
+					}
 				}
 			}
+
+				// Sets opNode's parent appropriately
+			opNode->parent = temp;
 		}
 
-			// Sets opNode's parent appropriately
-		opNode->parent = temp;
+			// Corrects what opNode's ancestors keep about their subtrees
+		if (augmented)
+			for(curr = temp; curr; curr = curr->parent)
+				augmentBase(curr);
+	}
 
 		// Insertion finished
 		// Now begins to rebalance the tree in case the insertion messed something up
+	insertFixBase(opNode);
+}
 
-			// Loops until opNode's parent isn't red
-		while(opNode != root && opNode->parent != root && opNode->parent->color == true) {
-				// Sets temp to be opNode's uncle
-				// If left grandparent's child is opNode's parent, right grandparent's child is its uncle
-			if(opNode->parent->parent->left == opNode->parent) temp = opNode->parent->parent->right;
-				// If right grandparent's child is opNode's parent, left grandparent's child is its uncle
-			else temp = opNode->parent->parent->left;
-
-				// If uncle is black, check if the opNode node fits in one of 4 cases (LL, RR, LR, RL)
-			if(!temp || temp->color == false) {
-				if(opNode == opNode->parent->left) {
-					// opNode is left child
-
-						// LL case
-						// Swap the colors of opNode's parent and grandparent, then right rotate on opNode's grandparent
-					if(opNode->parent == opNode->parent->parent->left) {
-							// Swap Colors
-						bool color = opNode->parent->color;
-						opNode->parent->color = opNode->parent->parent->color;
-						opNode->parent->parent->color = color;
-
-							// Right Rotate grandparent
-						rightRotate(opNode->parent->parent);
-					}
+/*
+ * function_identifier: Rebalances the red-black tree after a red node is linked in below a possibly red parent
+ *						(used by insertions and joins)
+ * parameters: 			The red node
+ * return value:		True if the root had to be colored black (the tree's black height grew by one)
+*/
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::insertFixBase(rbtNode<K,D> *opNode) {
+		// Initializes the needed values
+	rbtNode<K,D> *temp;
+
+		// Loops until opNode's parent isn't red
+	while(opNode != root && opNode->parent != root && opNode->parent->getColor() == true) {
+			// Sets temp to be opNode's uncle
+			// If left grandparent's child is opNode's parent, right grandparent's child is its uncle
+		if(opNode->parent->parent->left == opNode->parent) temp = opNode->parent->parent->right;
+			// If right grandparent's child is opNode's parent, left grandparent's child is its uncle
+		else temp = opNode->parent->parent->left;
+
+			// If uncle is black, check if the opNode node fits in one of 4 cases (LL, RR, LR, RL)
+		if(!temp || temp->getColor() == false) {
+			if(opNode == opNode->parent->left) {
+				// opNode is left child
+
+					// LL case
+					// Swap the colors of opNode's parent and grandparent, then right rotate on opNode's grandparent
+				if(opNode->parent == opNode->parent->parent->left) {
+						// Swap Colors
+					bool color = opNode->parent->getColor();
+					opNode->parent->setColor(opNode->parent->parent->getColor());
+					opNode->parent->parent->setColor(color);
+
+						// Right Rotate grandparent
+					rightRotate(opNode->parent->parent);
+				}
 
-						// RL case
-						// Swaps the color of opNode and its grandparent, right rotates opNode's parent, and finally left rotate on opNode's grandparent
-					else {
-							// Swap Colors
-						bool color = opNode->color;
-						opNode->color = opNode->parent->parent->color;
-						opNode->parent->parent->color = color;
+					// RL case
+					// Swaps the color of opNode and its grandparent, right rotates opNode's parent, and finally left rotate on opNode's grandparent
+				else {
+						// Swap Colors
+					bool color = opNode->getColor();
+					opNode->setColor(opNode->parent->parent->getColor());
+					opNode->parent->parent->setColor(color);
 
-							// Right Rotate Parent
-						rightRotate(opNode->parent);
+						// Right Rotate Parent (opNode takes its place, below the grandparent)
+					rightRotate(opNode->parent);
 
-							// Left Rotate grandparent
-						leftRotate(opNode->parent->parent);
-					}
-					
-				} else {
-					// opNode is right child
-
-						// RR case
-						// Swap the colors of opNode's parent and grandparent, then left rotate on opNode's grandparent
-					if(opNode->parent == opNode->parent->parent->right) {
-							// Swap Colors
-						bool color = opNode->parent->color;
-						opNode->parent->color = opNode->parent->parent->color;
-						opNode->parent->parent->color = color;
-
-							// Left Rotate grandparent
-						leftRotate(opNode->parent->parent);
-					}
+						// Left Rotate grandparent
+					leftRotate(opNode->parent);
+				}
+				
+			} else {
+				// opNode is right child
+
+					// RR case
+					// Swap the colors of opNode's parent and grandparent, then left rotate on opNode's grandparent
+				if(opNode->parent == opNode->parent->parent->right) {
+						// Swap Colors
+					bool color = opNode->parent->getColor();
+					opNode->parent->setColor(opNode->parent->parent->getColor());
+					opNode->parent->parent->setColor(color);
+
+						// Left Rotate grandparent
+					leftRotate(opNode->parent->parent);
+				}
 
-						// LR case
-						// Swaps the color of opNode and its grandparent, left rotates opNode's parent, and finally right rotate on opNode's grandparent
-					else {
-							// Swap Colors
-						bool color = opNode->color;
-						opNode->color = opNode->parent->parent->color;
-						opNode->parent->parent->color = color;
+					// LR case
+					// Swaps the color of opNode and its grandparent, left rotates opNode's parent, and finally right rotate on opNode's grandparent
+				else {
+						// Swap Colors
+					bool color = opNode->getColor();
+					opNode->setColor(opNode->parent->parent->getColor());
+					opNode->parent->parent->setColor(color);
 
-							// Left Rotate Parent
-						leftRotate(opNode->parent);
+						// Left Rotate Parent (opNode takes its place, below the grandparent)
+					leftRotate(opNode->parent);
 
-							// Right Rotate grandparent
-						rightRotate(opNode->parent->parent);
-					}
+						// Right Rotate grandparent
+					rightRotate(opNode->parent);
 				}
 			}
-				// If uncle is red, color it and its sibling black, but it's parent red
-				// Afterwards, begin rebalancing the tree at opNode's grandparent's positon now
-			else {
-				opNode = opNode->parent->parent;
-				opNode->color = true;
-				opNode->left->color = false;
-				opNode->right->color = false;
-			}
+
+				// The rotated subtree's top is now black, so rebalancing is done
+			break;
+		}
+			// If uncle is red, color it and its sibling black, but it's parent red
+			// Afterwards, begin rebalancing the tree at opNode's grandparent's positon now
+		else {
+			opNode = opNode->parent->parent;
+			opNode->setColor(true);
+			opNode->left->setColor(false);
+			opNode->right->setColor(false);
 		}
 	}
 
 		// Ensures that the root node is black
-	root->color = false;
+	bool grew = root->getColor();
+	root->setColor(false);
+	return grew;
 }
 
 /*
@@ -419,12 +816,36 @@ void rbTree<K,D>::rbt_insert(K key, D data) {
  * return value:		The old data in the deleted node
 */
 
-template <typename K, typename D>
-D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
+template <typename K, typename D, typename C>
+D rbTree<K,D,C>::rbt_delete(rbtNode<K,D> *opNode) {
 		// Returns default if given invaild node
 	if(!opNode)
 		return D();
 
+		// Unlinks the node from the data index
+	dataEraseBase(opNode);
+
+		// Copies the opNode's data to be later returned
+	D ret = opNode->data;
+	
+		// Decreases the rbt's node count
+	size--;
+
+		// Unlinks the node from the red-black tree, and frees it
+	unlinkBase(opNode);
+	freeNode(opNode);
+	return ret;
+}
+
+/*
+ * function_identifier: Unlinks a node from the red-black tree, and rebalances, without freeing it or touching its key
+ *						and data. A node with two children first trades places with the next node, so every other
+ *						node stays where it is. The node must already be out of the data index, and out of the size
+ * parameters: 			The node to unlink
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::unlinkBase(rbtNode<K,D> *opNode) {
 		// Initializes the needed values
 	rbtNode<K,D> *curr;
 
@@ -435,22 +856,38 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 		curr = opNode->right;
 		while(curr->left) curr = curr->left;
 
-			// Exchange data and key with the found node
-		opNode->key = curr->key;
-		D tempData = opNode->data;
-		opNode->data = curr->data;
-		curr->data = tempData;
+			// Trades colors and subtree sizes with the found node
+		bool color = opNode->getColor();
+		opNode->setColor(curr->getColor());
+		curr->setColor(color);
+		rbt_count_t descendants = opNode->descendants;
+		opNode->descendants = curr->descendants;
+		curr->descendants = descendants;
+
+			// The found node takes the node's place
+		rbtNode<K,D> *currParent = curr->parent, *currRight = curr->right;
+		curr->parent = opNode->parent;
+		if(!opNode->parent) root = curr;
+		else if(opNode == opNode->parent->left) opNode->parent->left = curr;
+		else opNode->parent->right = curr;
+		curr->left = opNode->left;
+		curr->left->parent = curr;
+		if(currParent == opNode) {
+			curr->right = opNode;
+			opNode->parent = curr;
+		} else {
+			curr->right = opNode->right;
+			curr->right->parent = curr;
+			currParent->left = opNode;
+			opNode->parent = currParent;
+		}
 
-			// Now, act to delete this found node instead
-		opNode = curr;
+			// The node takes the found node's place, with at most a right child
+		opNode->left = NULL;
+		opNode->right = currRight;
+		if(currRight) currRight->parent = opNode;
 	}
 
-		// Copies the opNode's data to be later returned
-	D ret = opNode->data;
-	
-		// Decreases the rbt's node count
-	size--;
-
 		// Corrects the descendants of the parent nodes
 	curr = opNode;
 	while(curr) {
@@ -470,11 +907,9 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 			// Color the new root node black and assign a NULL parent
 		if(curr) {
 			curr->parent = NULL;
-			curr->color = false;
+			curr->setColor(false);
 		}
-			// Frees the node scheduled to be deleted
-		delete opNode;
-		return ret; // Finish fixup
+		return; // Finish fixup
 	}
 		// Else, the node to be deleted is not the root
 	else {
@@ -482,6 +917,11 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 		if(curr) curr->parent = opNode->parent;
 		if(opNode == opNode->parent->left) opNode->parent->left = curr;
 		else opNode->parent->right = curr;
+
+			// Corrects what the ancestors keep about their subtrees (this includes the node that took the deleted node's place)
+		if (augmented)
+			for(rbtNode<K,D> *temp = opNode->parent; temp; temp = temp->parent)
+				augmentBase(temp);
 	}
 
 	// Node deleted
@@ -490,16 +930,14 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 		// Checks simple cases
 			// Checks if the opNode node was red and if there is no child
 			// If so, no fixup required
-	if(opNode->color == true && !curr) {delete opNode; return ret;}
+	if(opNode->getColor() == true && !curr) return;
 
 		// Initializes needed variable
 	rbtNode<K,D> *parent = opNode->parent;
 
-	delete opNode; // Frees the deleted node
-
 		// Checks if the replacement is red
 		// If so, set it to black and finish
-	if(curr && curr->color == true) {curr->color = false; return ret;}
+	if(curr && curr->getColor() == true) {curr->setColor(false); return;}
 
 	// At this point, the replacement node is now double black
 	// We will now promote it
@@ -513,10 +951,10 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 				// Check if sibling is not NULL
 			if(opNode) {
 					// Checks if sibling is red and left child
-				if(opNode->color == true) {
+				if(opNode->getColor() == true) {
 						// Colors the appropriate nodes
-					parent->color = true;
-					opNode->color = false;
+					parent->setColor(true);
+					opNode->setColor(false);
 
 						// Right Rotation of parent
 					rightRotate(parent);
@@ -524,13 +962,13 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 				}
 					// Checks if sibling's left child is red
 					// If so, LL case: sibling is black and left child and sibling's left child is red
-				else if(opNode->left && opNode->left->color == true) {
+				else if(opNode->left && opNode->left->getColor() == true) {
 						// Right Rotation of parent
 					rightRotate(parent);
 				}
 					// Checks if sibling's right child is red
 					// If so, LR case: sibling is black and left child and sibling's right child is red
-				else if(opNode->right && opNode->right->color == true) {
+				else if(opNode->right && opNode->right->getColor() == true) {
 						// Left Rotation of sibling
 					leftRotate(opNode);
 						// Right Rotation of parent
@@ -541,11 +979,11 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 
 					// Else, sibling is black and has at least one red child
 					// Moves down the blackness
-				parent->parent->color = parent->color;
+				parent->parent->setColor(parent->getColor());
 				parent = parent->parent;
-				parent->left->color = false;
-				if(parent->right) parent->right->color = false;
-				if(curr) curr->color = false;
+				parent->left->setColor(false);
+				if(parent->right) parent->right->setColor(false);
+				if(curr) curr->setColor(false);
 
 				break; // Finish fixup
 			}
@@ -557,10 +995,10 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 				// Check if sibling is not NULL
 			if(opNode) {
 					// Checks if sibling is red and right child
-				if(opNode->color == true) {
+				if(opNode->getColor() == true) {
 						// Colors the appropriate nodes
-					parent->color = true;
-					opNode->color = false;
+					parent->setColor(true);
+					opNode->setColor(false);
 
 						// Left Rotation of parent
 					leftRotate(parent);
@@ -568,13 +1006,13 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 				}
 					// Checks if sibling's right child is red
 					// If so, RR case: sibling is black and right child and sibling's right child is red
-				else if(opNode->right && opNode->right->color == true) {
+				else if(opNode->right && opNode->right->getColor() == true) {
 						// Left Rotation of parent
 					leftRotate(parent);
 				}
 					// Checks if sibling's left child is red
 					// If so, RL case: sibling is black and right child and sibling's left child is red
-				else if(opNode->left && opNode->left->color == true) {
+				else if(opNode->left && opNode->left->getColor() == true) {
 						// Right Rotation of sibling
 					rightRotate(opNode);
 						// Left Rotation of parent
@@ -585,11 +1023,11 @@ D rbTree<K,D>::rbt_delete(rbtNode<K,D> *opNode) {
 
 					// Else, sibling is black and has at least one red child
 					// Moves down the blackness
-				parent->parent->color = parent->color;
+				parent->parent->setColor(parent->getColor());
 				parent = parent->parent; // Moves up the parent
-				if(parent->left) parent->left->color = false;
-				parent->right->color = false;
-				if(curr) curr->color = false; // Sets the promoted node to be black
+				if(parent->left) parent->left->setColor(false);
+				parent->right->setColor(false);
+				if(curr) curr->setColor(false); // Sets the promoted node to be black
 				break; // Finish fixup
 			}
 		}
@@ -597,21 +1035,20 @@ blackChildren:
 
 			// Else, sibling is either NULL or black and has two black children
 			// Moves up the blackness
-		if(opNode) opNode->color = true;
-		if(curr) curr->color = false;
+		if(opNode) opNode->setColor(true);
+		if(curr) curr->setColor(false);
 			// If parent was already black, it is now the promoted node
-		if(parent != root && parent->color == false) {
+		if(parent != root && parent->getColor() == false) {
 			curr = parent;
 			parent = curr->parent;
 			continue; // Go back to start of loop with new promoted node
 		}
-		parent->color = false;
+		parent->setColor(false);
 		break; // Finish fixup
 	}
 
 		// Ensures that the root node is black
-	root->color = false;
-	return ret;
+	root->setColor(false);
 }
 
 /*
@@ -620,21 +1057,21 @@ blackChildren:
  * return value:		The data from the old root
 */
 
-template <typename K, typename D>
-D rbTree<K,D>::rbt_pop() {
+template <typename K, typename D, typename C>
+D rbTree<K,D,C>::rbt_pop() {
 	return rbt_delete(root);
 }
 
 /*
  * function_identifier: The basic assignment operation for red-black trees
  * parameters: 			A red-black tree
- * return value:		N/A
+ * return value:		This object
 */
-template <typename K, typename D>
-void rbTree<K,D>::operator=(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator=(const rbTree<K,D,C> &rbt) {
 		// Ignores the trival case
 	if (rbt.root == root)
-		return;
+		return *this;
 
 		// Deletes all nodes
 	rbt_free();
@@ -642,6 +1079,32 @@ void rbTree<K,D>::operator=(const rbTree<K,D> &rbt) {
 		// Deep copies over the tree
 	size = rbt.size;
 	copyTree(rbt.root, &(this->root));
+	dataIndexBase();
+	return *this;
+}
+
+/*
+ * function_identifier: The move assignment operation for red-black trees. Takes over the given tree's nodes and pool
+ * parameters: 			An expiring red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator=(rbTree<K,D,C> &&rbt) {
+		// Ignores the trival case
+	if (&rbt == this)
+		return *this;
+
+		// Deletes all nodes
+	rbt_free();
+
+		// Takes over the other tree, leaving it empty
+	root = rbt.root; size = rbt.size;
+#ifdef RBT_DATA_INDEX
+	dataRoot = rbt.dataRoot;
+#endif
+	pool = std::move(rbt.pool);
+	rbt.root = NULL; rbt.size = 0;
+	return *this;
 }
 
 /*
@@ -649,8 +1112,8 @@ void rbTree<K,D>::operator=(const rbTree<K,D> &rbt) {
  * parameters: 			N/A
  * return value:		A red-black tree deep copy
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_copy() const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_copy() const {
 	return rbTree(*this);
 }
 
@@ -659,8 +1122,8 @@ rbTree<K,D> rbTree<K,D>::rbt_copy() const {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_clear() {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_clear() {
 	rbt_free(); // Deletes all nodes
 	root = NULL; size = 0;
 }
@@ -670,8 +1133,8 @@ void rbTree<K,D>::rbt_clear() {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-rbTree<K,D>::rbTree() {
+template <typename K, typename D, typename C>
+rbTree<K,D,C>::rbTree() {
 	root = NULL; size = 0;
 }
 
@@ -680,11 +1143,36 @@ rbTree<K,D>::rbTree() {
  * parameters: 			A red-black tree
  * return value:		N/A
 */
-template <typename K, typename D>
-rbTree<K,D>::rbTree(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C>::rbTree(const rbTree<K,D,C> &rbt) {
 		// Deep copies over the tree
 	size = rbt.size;
 	copyTree(rbt.root, &(this->root));
+	dataIndexBase();
+}
+
+/*
+ * function_identifier: The move constructor for the red-black tree. Takes over the given tree's nodes and pool
+ * parameters: 			An expiring red-black tree
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C>::rbTree(rbTree<K,D,C> &&rbt) noexcept : pool(std::move(rbt.pool)) {
+	root = rbt.root; size = rbt.size;
+#ifdef RBT_DATA_INDEX
+	dataRoot = rbt.dataRoot;
+#endif
+	rbt.root = NULL; rbt.size = 0;
+}
+
+/*
+ * function_identifier: The constructor for a red-black tree that allocates its nodes from a given, possibly shared, pool
+ * parameters: 			A node pool
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C>::rbTree(std::shared_ptr<rbtPool<K,D>> nodePool) : pool(nodePool) {
+	root = NULL; size = 0;
 }
 
 /*
@@ -692,8 +1180,8 @@ rbTree<K,D>::rbTree(const rbTree<K,D> &rbt) {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-rbTree<K,D>::~rbTree() {
+template <typename K, typename D, typename C>
+rbTree<K,D,C>::~rbTree() {
 		// Deletes the root and all of its descendants
 	rbt_free();
 }
@@ -17,13 +17,6 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-		// External From 'RBT_sort.cpp'
-	template <typename K, typename D>
-	extern inline bool(*fooPtr)(rbtNode<K,D> *, rbtNode<K,D> *);
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                          TREE BASIC OPERATIONS                             | */
@@ -35,13 +28,13 @@ namespace {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator+(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator+(const rbTree<K,D,C> &rbt) const {
 		// Ignores the trival case
 	if (!rbt.size)
-		return rbTree<K,D>(*this);
+		return rbTree<K,D,C>(*this);
 	if (!size)
-		return rbTree<K,D>(rbt);
+		return rbTree<K,D,C>(rbt);
 
 		// Initializes the needed values
 	rbtNode<K,D> **rbtNodes;
@@ -62,11 +55,10 @@ rbTree<K,D> rbTree<K,D>::operator+(const rbTree<K,D> &rbt) const {
 	rbt.rbt_getAllNodes(rbtNodes + size);
 
 		// Sorts the nodes
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortBase(rbtNodes, 0, size - 1, sizeNew);
+	mergeSortBase(rbtNodes, 0, size - 1, sizeNew, compair<KEYDATA>());
 
 		// Create a tree from nodes
-	rbTree<K,D> rbtNew = rbTree<K,D>();
+	rbTree<K,D,C> rbtNew = rbTree<K,D,C>();
 	rbtNew.size = sizeNew;
 	rbtNew.treeify(0, sizeNew - 1, rbtNodes, &rbtNew.root);
 
@@ -82,14 +74,15 @@ rbTree<K,D> rbTree<K,D>::operator+(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator+=(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator+=(const rbTree<K,D,C> &rbt) {
 		// Ignores the trival case
 	if (!rbt.size)
 		return *this;
 	if (!size) {
 		size = rbt.size;
 		copyTree(rbt.root, &(this->root));
+		dataIndexBase();
 		return *this;
 	}
 
@@ -112,7 +105,7 @@ rbTree<K,D> rbTree<K,D>::operator+=(const rbTree<K,D> &rbt) {
 
 		// Deep copies the second tree's nodes
 	while(IdxS2 != IdxE2) {
-		*IdxS1 = new rbtNode<K,D>(*IdxS2);
+		*IdxS1 = allocNode(*IdxS2);
 		IdxS1++; IdxS2++;
 	}
 
@@ -120,8 +113,7 @@ rbTree<K,D> rbTree<K,D>::operator+=(const rbTree<K,D> &rbt) {
 	delete [] (IdxE2 - rbt.size);
 
 		// Makes sure all the nodes are sorted
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortBase(rbtNodes, 0, size - 1, sizeNew);
+	mergeSortBase(rbtNodes, 0, size - 1, sizeNew, compair<KEYDATA>());
 
 		// Create a tree from nodes
 	size = sizeNew;
@@ -140,8 +132,8 @@ rbTree<K,D> rbTree<K,D>::operator+=(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_add(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_add(const rbTree<K,D,C> &rbt) const {
 	return *this + rbt;
 }
 
@@ -150,23 +142,70 @@ inline rbTree<K,D> rbTree<K,D>::rbt_add(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		This object		
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_addI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_addI(const rbTree<K,D,C> &rbt) {
 	return *this += rbt;
 }
 
+/*
+ * function_identifier: Combines the nodes of an expiring red-black tree into a new red-black tree
+ *						Reuses the expiring tree's nodes, so only the nodes needed from this tree are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator+(rbTree<K,D,C> &&rbt) const {
+	rbt += *this;
+	return std::move(rbt);
+}
+
+/*
+ * function_identifier: Combines the nodes of an expiring red-black tree into the current tree
+ *						Keeps the nodes of whichever tree is larger, so only the smaller tree's nodes are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator+=(rbTree<K,D,C> &&rbt) {
+		// Takes over the larger tree's nodes
+	if (rbt.size > size)
+		swapTree(rbt);
+
+	return *this += rbt;
+}
+
+/*
+ * function_identifier: The alias for the + operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_add(rbTree<K,D,C> &&rbt) const {
+	return *this + std::move(rbt);
+}
+
+/*
+ * function_identifier: The alias for the += operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_addI(rbTree<K,D,C> &&rbt) {
+	return *this += std::move(rbt);
+}
+
 /*
  * function_identifier: The base template for the sub opperations
  * parameters: 			A red-black tree, a function to copy over nodes not subtracted
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::subBase(const rbTree<K,D> &rbt, void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&)) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::subBase(const rbTree<K,D,C> &rbt, void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&)) const {
 		// Ignores the trival case
 	if (!size)
-		return rbTree<K,D>();
+		return rbTree<K,D,C>();
 	if (!rbt.size)
-		return rbTree<K,D>(*this);
+		return rbTree<K,D,C>(*this);
 
 		// Initializes the needed values
 	rbtNode<K,D> **IdxS1, **IdxE1, **IdxS2, **IdxE2, **IdxM;
@@ -192,7 +231,7 @@ inline rbTree<K,D> rbTree<K,D>::subBase(const rbTree<K,D> &rbt, void (*foo)(rbtN
 	IdxS1 = IdxE1 - size;
 
 		// Create a tree from nodes
-	rbTree<K,D> newTree = rbTree<K,D>();
+	rbTree<K,D,C> newTree = rbTree<K,D,C>();
 	newTree.size = IdxM - IdxS1;
 
 	if (newTree.size)
@@ -212,42 +251,32 @@ inline rbTree<K,D> rbTree<K,D>::subBase(const rbTree<K,D> &rbt, void (*foo)(rbtN
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator-(const rbTree<K,D> &rbt) const {
-	return subBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxM, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE2) -> void {
-			// Cycles through the entire array of accessed nodes and data
-		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
-				// Checks if both considered nodes have equal keys and data
-				// If so, ignore it and move forward
-				// If not, save it, then move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					IdxS1++; IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					*IdxM++ = *IdxS1++;
-				else
-					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				*IdxM++ = *IdxS1++;
-			else
-				IdxS2++;
-	});
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator-(const rbTree<K,D,C> &rbt) const {
+		// Copies this tree, and subtracts the other tree from the copy
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew -= rbt;
+	return rbtNew;
 }
 
 /*
  * function_identifier: Deletes all nodes in the current tree with the same data and key as a node in the second tree
+ *						Splits this tree around the other tree's runs and joins the kept pieces back. O(M*log(N/M + 1)),
+ *						for M nodes in the other tree and N nodes in this one, plus the dropped nodes. If this tree is
+ *						the smaller one, only the other tree's matching runs are looked up, in O(N*log(M))
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator-=(const rbTree<K,D> &rbt) {
-		// Gets the needed nodes
-	auto delNodes = rbt.rbt_getAllNodes();
-		// Deletes the nodes from current tree
-	rbt_repDelete(rbt.size, delNodes);
-		// Clears this accessed node array
-	delete [] delNodes;
-		// Return this object
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator-=(const rbTree<K,D,C> &rbt) {
+		// Ignores the trival case
+	if (&rbt == this) {
+		rbt_clear();
+		return *this;
+	}
+
+		// Drops as many of this tree's equal nodes as the other tree has, and keeps unmatched nodes
+	mergeRunsI(rbt, true, false, subRunBase);
 	return *this;
 }
 
@@ -256,8 +285,8 @@ rbTree<K,D> rbTree<K,D>::operator-=(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_sub(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_sub(const rbTree<K,D,C> &rbt) const {
 	return *this - rbt;
 }
 
@@ -266,27 +295,61 @@ inline rbTree<K,D> rbTree<K,D>::rbt_sub(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		This object		
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_subI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_subI(const rbTree<K,D,C> &rbt) {
 	return *this -= rbt;
 }
 
+/*
+ * function_identifier: Outputs a new red-black tree with all nodes, in this tree, that are not in the second provided tree
+ *						Both trees are cut into even parts, and each part is subtracted on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_subParallel(const rbTree<K,D,C> &rbt, size_t threads) const {
+		// Copies this tree, and subtracts the other tree from the copy
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew.rbt_subParallelI(rbt, threads);
+	return rbtNew;
+}
+
+/*
+ * function_identifier: Deletes all nodes in the current tree with the same data and key as a node in the second tree
+ *						Both trees are cut into even parts, and each part is subtracted on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_subParallelI(const rbTree<K,D,C> &rbt, size_t threads) {
+		// Ignores the trival case
+	if (&rbt == this) {
+		rbt_clear();
+		return *this;
+	}
+
+	mergeRunsI(rbt, true, false, subRunBase, threads ? threads : std::thread::hardware_concurrency());
+	return *this;
+}
+
 /*
  * function_identifier: Outputs a new red-black tree with all nodes, in this tree, with keys that are not in the second provided tree
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_subKeys(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_subKeys(const rbTree<K,D,C> &rbt) const {
 	return subBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxM, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE2) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, ignore it and move forward
 				// If not, save it, then move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				IdxS2++;
@@ -298,8 +361,8 @@ rbTree<K,D> rbTree<K,D>::rbt_subKeys(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible keys to the current red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_subKeysI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_subKeysI(const rbTree<K,D,C> &rbt) {
 		// Gets the needed keys
 	auto keys = rbt.rbt_getAllKeys();
 		// Deletes the nodes from current tree
@@ -315,17 +378,17 @@ rbTree<K,D> rbTree<K,D>::rbt_subKeysI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_subData(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_subData(const rbTree<K,D,C> &rbt) const {
 	return subBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxM, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE2) -> void {
 			// Cycles through the entire array of accessed nodes and data
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, ignore it and move forward
 				// If not, save it, then move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				IdxS2++;
@@ -337,8 +400,8 @@ rbTree<K,D> rbTree<K,D>::rbt_subData(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible data values to the current red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_subDataI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_subDataI(const rbTree<K,D,C> &rbt) {
 		// Gets the needed data
 	auto data = rbt.rbt_getAllData();
 		// Deletes the nodes from current tree
@@ -355,14 +418,14 @@ rbTree<K,D> rbTree<K,D>::rbt_subDataI(const rbTree<K,D> &rbt) {
  * parameters: 			The number of times each node should be duplicated
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator*(const size_t &val) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator*(const size_t &val) const {
 		// Ignores the trival case
 	if (val <= 1) {
 		if (val == 0)
-			return rbTree<K,D>();
+			return rbTree<K,D,C>();
 		else
-			return rbTree<K,D>(*this);
+			return rbTree<K,D,C>(*this);
 	}
 
 		// Initializes the needed values
@@ -382,14 +445,15 @@ rbTree<K,D> rbTree<K,D>::operator*(const size_t &val) const {
 	IdxS = rbtNodes + size - 1; IdxE = rbtNodes + sizeNew - 1; 
 
 		// Duplicates each node, in the current tree, a certain number of times
+		// The duplicates are allocated from the new tree's pool
+	rbTree<K,D,C> newTree = rbTree<K,D,C>();
 	while(IdxS >= rbtNodes) {
 		for(size_t i=0; i<val; i++)
-			*IdxE-- = new rbtNode<K,D>(*IdxS);
+			*IdxE-- = newTree.allocNode(*IdxS);
 		IdxS--;
 	}
 
 		// Creates a tree from the duplicated nodes
-	rbTree<K,D> newTree = rbTree<K,D>();
 	newTree.size = sizeNew;
 	newTree.treeifyShallow(0, sizeNew - 1, rbtNodes, &newTree.root);
 
@@ -405,8 +469,8 @@ rbTree<K,D> rbTree<K,D>::operator*(const size_t &val) const {
  * parameters: 			The number of times each node should be duplicated
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator*=(const size_t &val) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator*=(const size_t &val) {
 		// Ignores the trival case
 	if (val <= 1) {
 		if (val == 0)
@@ -434,7 +498,7 @@ rbTree<K,D> rbTree<K,D>::operator*=(const size_t &val) {
 	while(IdxS >= rbtNodes) {
 		*IdxE-- = *IdxS;
 		for(size_t i=1; i<val; i++)
-			*IdxE-- = new rbtNode<K,D>(*IdxS);
+			*IdxE-- = allocNode(*IdxS);
 		IdxS--;
 	}
 
@@ -454,8 +518,8 @@ rbTree<K,D> rbTree<K,D>::operator*=(const size_t &val) {
  * parameters: 			The number of times each node should be duplicated
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_mul(const size_t &val) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_mul(const size_t &val) const {
 	return *this * val;
 }
 
@@ -464,8 +528,8 @@ inline rbTree<K,D> rbTree<K,D>::rbt_mul(const size_t &val) const {
  * parameters: 			The number of times each node should be duplicated
  * return value:		This object		
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_mulI(const size_t &val) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_mulI(const size_t &val) {
 	return *this *= val;
 }
 
@@ -480,8 +544,8 @@ inline rbTree<K,D> rbTree<K,D>::rbt_mulI(const size_t &val) {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_invert() {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_invert() {
 		// Ignores the trival case
 	if (!size)
 		return *this;
@@ -495,8 +559,10 @@ rbTree<K,D> rbTree<K,D>::rbt_invert() {
 	IdxM = new rbtNode<K,D> *[size];
 
 		// Deep copies all the nodes over, reversing the priorities
+		// The copies are allocated from the new tree's pool
+	rbTree<K,D,C> newTree = rbTree<K,D,C>();
 	while(rbtNodes <= IdxE)
-		*IdxM++ = new rbtNode<K,D>((*IdxS++)->key, (*IdxE--)->data);
+		*IdxM++ = newTree.allocNode((*IdxS++)->key, (*IdxE--)->data);
 
 		// Clears accessed node array
 	delete [] rbtNodes;
@@ -505,11 +571,9 @@ rbTree<K,D> rbTree<K,D>::rbt_invert() {
 	IdxM -= size;
 
 		// Sorts the nodes
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(IdxM, 0, size - 1);
+	mergeSortCallerBase(IdxM, 0, size - 1, compair<KEYDATA>());
 
 		// Creates a tree from the duplicated nodes
-	rbTree<K,D> newTree = rbTree<K,D>();
 	newTree.size = size;
 	newTree.treeifyShallow(0, size - 1, IdxM, &newTree.root);
 
@@ -525,8 +589,8 @@ rbTree<K,D> rbTree<K,D>::rbt_invert() {
  * parameters: 			N/A
  * return value:		N/A
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_invertI() {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_invertI() {
 		// Ignores the trival case
 	if (!size)
 		return *this;
@@ -546,9 +610,9 @@ rbTree<K,D> rbTree<K,D>::rbt_invertI() {
 		(*IdxE--)->data = tmp;
 	}
 
-		// Sorts the nodes
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(rbtNodes, 0, size - 1);
+		// Sorts the nodes, and relinks them so equal keys stay ordered by data (this also recalculates what nodes keep about their subtrees)
+	mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
+	treeifyShallow(0, size - 1, rbtNodes, &root);
 
 		// Clears accessed node array
 	delete [] rbtNodes;
@@ -564,13 +628,13 @@ rbTree<K,D> rbTree<K,D>::rbt_invertI() {
  *						treeifyShallow
  * return value:		An array of smaller subtrees
 */
-template <typename K, typename D>
-inline rbTree<K,D> *rbTree<K,D>::divideBase(
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> *rbTree<K,D,C>::divideBase(
 	size_t div,
 	enum rbtraversal traversal,
-	rbTree<K,D> *(rbTree<K, D>::*foo)(),
-	void (rbTree<K, D>::*bar)(size_t, rbtNode<K,D> **, rbTree<K,D> *, enum rbtraversal, size_t (rbTree<K, D>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **)),
-	size_t (rbTree<K, D>::*nar)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **))
+	rbTree<K,D,C> *(rbTree<K,D,C>::*foo)(),
+	void (rbTree<K,D,C>::*bar)(size_t, rbtNode<K,D> **, rbTree<K,D,C> *, enum rbtraversal, size_t (rbTree<K,D,C>::*)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **)),
+	size_t (rbTree<K,D,C>::*nar)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **))
 {
 		// Error or ignore the trival case
 	if (div <= 1) {
@@ -583,14 +647,18 @@ inline rbTree<K,D> *rbTree<K,D>::divideBase(
 	}
 
 		// Initializes the needed values
-	rbTree<K,D> *TreeArray;
+	rbTree<K,D,C> *TreeArray;
 	rbtNode<K,D> **IdxS;
-	fooPtr<K,D> = keyDataCompair;
 
 		// Gets the needed tree, nodes, and indexes
-	TreeArray = new rbTree<K,D>[div]();
+	TreeArray = new rbTree<K,D,C>[div]();
 	IdxS = rbt_getAllNodes(traversal);
 
+		// Subtrees that take over this tree's nodes must keep the pool those nodes live in
+	if (nar == &rbTree<K,D,C>::treeifyShallow)
+		for(size_t i=0; i<div; i++)
+			TreeArray[i].pool = pool;
+
 		// Base values needed to determine how to distribute
 	(this->*bar)(div, IdxS, TreeArray, traversal, nar);
 
@@ -606,11 +674,11 @@ inline rbTree<K,D> *rbTree<K,D>::divideBase(
  * parameters: 			N/A
  * return value:		An array of one smaller subtree
 */
-template <typename K, typename D>
-inline rbTree<K,D> *rbTree<K,D>::deepDivideHelper() {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> *rbTree<K,D,C>::deepDivideHelper() {
 		// If div is 1, return the trival case
-	rbTree<K,D> *TreeArray = new rbTree<K,D>[1];
-	*TreeArray = rbTree<K,D>(*this);
+	rbTree<K,D,C> *TreeArray = new rbTree<K,D,C>[1];
+	*TreeArray = rbTree<K,D,C>(*this);
 	return TreeArray;
 };
 
@@ -619,12 +687,16 @@ inline rbTree<K,D> *rbTree<K,D>::deepDivideHelper() {
  * parameters: 			N/A
  * return value:		An array of one smaller subtree
 */
-template <typename K, typename D>
-inline rbTree<K,D> *rbTree<K,D>::shallowDivideHelper() {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> *rbTree<K,D,C>::shallowDivideHelper() {
 		// If div is 1, return the trival case
-	rbTree<K,D> *TreeArray = new rbTree<K,D>[1];
+	rbTree<K,D,C> *TreeArray = new rbTree<K,D,C>[1];
 	TreeArray->root = this->root;
+#ifdef RBT_DATA_INDEX
+	TreeArray->dataRoot = this->dataRoot;
+#endif
 	TreeArray->size = this->size;
+	TreeArray->pool = this->pool;
 	return TreeArray;
 };
 
@@ -637,13 +709,13 @@ inline rbTree<K,D> *rbTree<K,D>::shallowDivideHelper() {
  *						and either treeify or treeifyShallow
  * return value:		N/A
 */
-template <typename K, typename D>
-inline void rbTree<K,D>::distributeDivideHelper(
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::distributeDivideHelper(
 	size_t div,
 	rbtNode<K,D> **IdxS,
-	rbTree<K,D> *TreeS,
+	rbTree<K,D,C> *TreeS,
 	enum rbtraversal traversal,
-	size_t (rbTree<K, D>::*foo)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **))
+	size_t (rbTree<K,D,C>::*foo)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **))
 {
 		// Initializes needed values
 	bool check;
@@ -659,10 +731,10 @@ inline void rbTree<K,D>::distributeDivideHelper(
 
 			// Sorts the list of nodes if the given traversal didn't already keep them sorted
 		if (traversal != IN_ORDER)
-			mergeSortCallerBase(IdxS, 0, div - !check);
+			mergeSortCallerBase(IdxS, 0, div - !check, compair<KEYDATA>());
 
 			// Converts this current subset of nodes into a new tree (deep copy)
-		(TreeS->*foo)(0, div - !check, IdxS, &TreeS->root);
+		TreeS->size = (TreeS->*foo)(0, div - !check, IdxS, &TreeS->root);
 		TreeS++;
 
 			// Moves forward to next subset of nodes
@@ -681,13 +753,13 @@ inline void rbTree<K,D>::distributeDivideHelper(
  *						and either treeify or treeifyShallow
  * return value:		N/A
 */
-template <typename K, typename D>
-inline void rbTree<K,D>::scatterDivideHelper(
+template <typename K, typename D, typename C>
+inline void rbTree<K,D,C>::scatterDivideHelper(
 	size_t div,
 	rbtNode<K,D> **IdxS,
-	rbTree<K,D> *TreeS,
+	rbTree<K,D,C> *TreeS,
 	enum rbtraversal traversal,
-	size_t (rbTree<K, D>::*foo)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **))
+	size_t (rbTree<K,D,C>::*foo)(size_t, size_t, rbtNode<K,D> **, rbtNode<K,D> **))
 {
 	size_t len = size / div + ((size % div) > 0);
 	div = div < size ? div : size;
@@ -702,9 +774,9 @@ inline void rbTree<K,D>::scatterDivideHelper(
 
 			// Sorts the current subset of nodes if the given traversal didn't already keep them sorted
 		if (traversal != IN_ORDER)
-			mergeSortCallerBase(rbtNodes, 0, len);
+			mergeSortCallerBase(rbtNodes, 0, len, compair<KEYDATA>());
 
-		(TreeS->*foo)(0, len, rbtNodes, &TreeS->root);
+		TreeS->size = (TreeS->*foo)(0, len, rbtNodes, &TreeS->root);
 		(TreeS++)->root->parent = NULL;
 	}
 
@@ -718,10 +790,10 @@ inline void rbTree<K,D>::scatterDivideHelper(
  * parameters: 			The number of trees to create and the traversal type to distribute by
  * return value:		An array of rbTrees
 */
-template <typename K, typename D>
-rbTree<K,D> *rbTree<K,D>::rbt_distribute(size_t div, enum rbtraversal traversal) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> *rbTree<K,D,C>::rbt_distribute(size_t div, enum rbtraversal traversal) {
 		// Gets and returns the subtree array
-	return divideBase(div, traversal, &rbTree<K, D>::deepDivideHelper, &rbTree<K,D>::distributeDivideHelper, &rbTree<K,D>::treeify);
+	return divideBase(div, traversal, &rbTree<K,D,C>::deepDivideHelper, &rbTree<K,D,C>::distributeDivideHelper, &rbTree<K,D,C>::treeify);
 }
 
 /*
@@ -731,10 +803,10 @@ rbTree<K,D> *rbTree<K,D>::rbt_distribute(size_t div, enum rbtraversal traversal)
  * parameters: 			The number of trees to create and the traversal type to distribute by
  * return value:		An array of rbTrees
 */
-template <typename K, typename D>
-rbTree<K,D> *rbTree<K,D>::rbt_distribute_shallow(size_t div, enum rbtraversal traversal) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> *rbTree<K,D,C>::rbt_distribute_shallow(size_t div, enum rbtraversal traversal) {
 		// Gets the subtree array
-	rbTree<K,D> *TreeArray = divideBase(div, traversal, &rbTree<K, D>::shallowDivideHelper, &rbTree<K,D>::distributeDivideHelper, &rbTree<K,D>::treeifyShallow);
+	rbTree<K,D,C> *TreeArray = divideBase(div, traversal, &rbTree<K,D,C>::shallowDivideHelper, &rbTree<K,D,C>::distributeDivideHelper, &rbTree<K,D,C>::treeifyShallow);
 
 		// All nodes no longer belong to this tree, so size is 0 and root is NULL
 	size = 0; root = NULL;
@@ -750,10 +822,10 @@ rbTree<K,D> *rbTree<K,D>::rbt_distribute_shallow(size_t div, enum rbtraversal tr
  * parameters: 			The number of trees to create and the traversal type to distribute by
  * return value:		An array of rbTrees
 */
-template <typename K, typename D>
-rbTree<K,D> *rbTree<K,D>::rbt_scatter(size_t div, enum rbtraversal traversal) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> *rbTree<K,D,C>::rbt_scatter(size_t div, enum rbtraversal traversal) {
 		// Gets and returns the subtree array
-	return divideBase(div, traversal, &rbTree<K, D>::deepDivideHelper, &rbTree<K,D>::scatterDivideHelper, &rbTree<K,D>::treeify);
+	return divideBase(div, traversal, &rbTree<K,D,C>::deepDivideHelper, &rbTree<K,D,C>::scatterDivideHelper, &rbTree<K,D,C>::treeify);
 }
 
 /*
@@ -763,10 +835,10 @@ rbTree<K,D> *rbTree<K,D>::rbt_scatter(size_t div, enum rbtraversal traversal) {
  * parameters: 			The number of trees to create and the traversal type to distribute by
  * return value:		An array of rbTrees
 */
-template <typename K, typename D>
-rbTree<K,D> *rbTree<K,D>::rbt_scatter_shallow(size_t div, enum rbtraversal traversal) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> *rbTree<K,D,C>::rbt_scatter_shallow(size_t div, enum rbtraversal traversal) {
 		// Gets the subtree array
-	rbTree<K,D> *TreeArray = divideBase(div, traversal, &rbTree<K, D>::shallowDivideHelper, &rbTree<K,D>::scatterDivideHelper, &rbTree<K,D>::treeifyShallow);
+	rbTree<K,D,C> *TreeArray = divideBase(div, traversal, &rbTree<K,D,C>::shallowDivideHelper, &rbTree<K,D,C>::scatterDivideHelper, &rbTree<K,D,C>::treeifyShallow);
 
 		// All nodes no longer belong to this tree, so size is 0 and root is NULL
 	size = 0; root = NULL;
@@ -775,4 +847,533 @@ rbTree<K,D> *rbTree<K,D>::rbt_scatter_shallow(size_t div, enum rbtraversal trave
 	return TreeArray;
 }
 
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              SPLIT AND JOIN                                | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Counts the black nodes on the path from a node down to a leaf (the same on every path)
+ * parameters: 			A node (or NULL)
+ * return value:		The black height
+*/
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::blackHeightBase(rbtNode<K,D> *curr) {
+	size_t height = 0;
+	for(; curr; curr = curr->left)
+		height += !curr->getColor();
+	return height;
+}
+
+/*
+ * function_identifier: Joins two detached branches, and a detached node that goes between them in order, into one
+ *						red-black branch. The node is hung off the taller branch's inner spine, level with the
+ *						shorter branch, then rebalanced like an insertion. O(difference in black heights)
+ *						Uses this tree's root while working
+ * parameters: 			The lower branch and its black height, the middle node, the upper branch and its black
+ *						height (either branch may be NULL or have a red root), and where to store the result's height
+ * return value:		The joined branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::joinBase(rbtNode<K,D> *lo, size_t loHeight, rbtNode<K,D> *mid, rbtNode<K,D> *hi, size_t hiHeight, size_t &height) {
+		// Colors both roots black, which keeps each branch valid on its own
+	if (lo && lo->getColor()) {
+		lo->setColor(false);
+		loHeight++;
+	}
+	if (hi && hi->getColor()) {
+		hi->setColor(false);
+		hiHeight++;
+	}
+	height = std::max(loHeight, hiHeight);
+
+		// Finds the first black node, down the taller branch's inner spine, as tall as the shorter branch
+	rbtNode<K,D> *parent = NULL, *curr;
+	if (loHeight >= hiHeight) {
+		root = curr = lo;
+		while(curr && (curr->getColor() || loHeight > hiHeight)) {
+			loHeight -= !curr->getColor();
+			parent = curr;
+			curr = curr->right;
+		}
+		mid->left = curr;
+		mid->right = hi;
+		if (parent) parent->right = mid;
+	}
+	else {
+		root = curr = hi;
+		while(curr && (curr->getColor() || hiHeight > loHeight)) {
+			hiHeight -= !curr->getColor();
+			parent = curr;
+			curr = curr->left;
+		}
+		mid->left = lo;
+		mid->right = curr;
+		if (parent) parent->left = mid;
+	}
+
+		// Links the middle node, as a red node, in that black node's place
+	mid->setColor(true);
+	mid->parent = parent;
+	if (!parent) root = mid;
+	if (mid->left) mid->left->parent = mid;
+	if (mid->right) mid->right->parent = mid;
+	mid->descendants = 0;
+	if (mid->left) mid->descendants += mid->left->descendants + 1;
+	if (mid->right) mid->descendants += mid->right->descendants + 1;
+	augmentBase(mid);
+
+		// Every node above it gains the middle node and the shorter branch
+	size_t gained = mid->descendants + 1 - (curr ? curr->descendants + 1 : 0);
+	for(curr = parent; curr; curr = curr->parent) {
+		curr->descendants += gained;
+		augmentBase(curr);
+	}
+
+		// Only the middle node may have a red parent, which an insertion's rebalancing fixes
+	height += insertFixBase(mid);
+	return root;
+}
+
+/*
+ * function_identifier: Splits a detached branch into the nodes that go below a given point and the rest, by
+ *						joining, on the way back up, each node with the pieces on its side. O(log(N))
+ *						Uses this tree's root while working
+ * parameters: 			The branch and its black height, a function telling if a node (at a given index in the
+ *						branch) goes below the point, the index of the branch's first node, and where to store both
+ *						resulting branches and their black heights
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+void rbTree<K,D,C>::splitBase(rbtNode<K,D> *curr, size_t height, F below, size_t idx, rbtNode<K,D> *&lo, size_t &loHeight, rbtNode<K,D> *&hi, size_t &hiHeight) {
+		// Ignores the trival case
+	if (!curr) {
+		lo = hi = NULL;
+		loHeight = hiHeight = 0;
+		return;
+	}
+
+		// Detaches the node from its branches, which are a black level lower if the node is black
+	rbtNode<K,D> *left = curr->left, *right = curr->right, *mid;
+	size_t midHeight;
+	height -= !curr->getColor();
+	curr->left = curr->right = NULL;
+	if (left) {
+		left->parent = NULL;
+		idx += left->descendants + 1;
+	}
+	if (right) right->parent = NULL;
+
+		// The node and its left branch go below, along with the lower piece of its right branch
+	if (below(curr, idx)) {
+		splitBase(right, height, below, idx + 1, mid, midHeight, hi, hiHeight);
+		lo = joinBase(left, height, curr, mid, midHeight, loHeight);
+	}
+		// Else, the node and its right branch go above, along with the upper piece of its left branch
+	else {
+		splitBase(left, height, below, idx - (left ? left->descendants + 1 : 0), lo, loHeight, mid, midHeight);
+		hi = joinBase(mid, midHeight, curr, right, height, hiHeight);
+	}
+}
+
+/*
+ * function_identifier: Joins two detached branches, where every node in the first goes before the second, by taking
+ *						the second branch's first node out to join them around. O(log(N))
+ * parameters: 			The lower branch and its black height, the upper branch and its black height, and where to
+ *						store the result's height
+ * return value:		The joined branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::concatBase(rbtNode<K,D> *lo, size_t loHeight, rbtNode<K,D> *hi, size_t hiHeight, size_t &height) {
+		// Ignores the trival cases
+	if (!hi) {
+		height = loHeight;
+		return lo;
+	}
+	if (!lo) {
+		height = hiHeight;
+		return hi;
+	}
+
+		// Splits off the upper branch's first node, and joins around it
+	rbtNode<K,D> *first;
+	size_t firstHeight;
+	splitBase(hi, hiHeight, [] (rbtNode<K,D> *, size_t idx) -> bool {return !idx;}, 0, first, firstHeight, hi, hiHeight);
+	return joinBase(lo, loHeight, first, hi, hiHeight, height);
+}
+
+/*
+ * function_identifier: Unlinks every node in a detached branch from the data index and frees it
+ * parameters: 			The branch (or NULL)
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::dropBase(rbtNode<K,D> *curr) {
+		// Ignores the trival case
+	if (!curr)
+		return;
+
+		// Drops both branches, then the node itself
+	dropBase(curr->left);
+	dropBase(curr->right);
+	dataEraseBase(curr);
+	size--;
+	freeNode(curr);
+}
+
+/*
+ * function_identifier: Keeps the first or last nodes of a detached branch, and drops the rest. O(log(N)), plus
+ *						the dropped nodes
+ * parameters: 			The branch and its black height, how many nodes to keep, if the first (or last) nodes are
+ *						kept, and where to store the result's height
+ * return value:		The kept branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::keepRunBase(rbtNode<K,D> *curr, size_t height, size_t count, bool first, size_t &keptHeight) {
+	rbtNode<K,D> *lo, *hi;
+	size_t loHeight, hiHeight, cut = first ? count : (curr ? curr->descendants + 1 : 0) - count;
+
+		// Splits the branch where the kept nodes start or end, and drops the other side
+	splitBase(curr, height, [cut] (rbtNode<K,D> *, size_t idx) -> bool {return idx < cut;}, 0, lo, loHeight, hi, hiHeight);
+	dropBase(first ? hi : lo);
+	keptHeight = first ? loHeight : hiHeight;
+	return first ? lo : hi;
+}
+
+/*
+ * function_identifier: Builds a branch of copies of some nodes, in order, from this tree's pool, and links the
+ *						copies into the data index. O(number of nodes)
+ * parameters: 			The start and end of the array of (sorted) nodes to copy, and where to store the result's height
+ * return value:		The branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::copyRunBase(rbtNode<K,D> *const *IdxS, rbtNode<K,D> *const *IdxE, size_t &height) {
+		// Ignores the trival case
+	if (IdxS == IdxE) {
+		height = 0;
+		return NULL;
+	}
+
+		// Copies the middle node, and joins it with copies of each half
+	rbtNode<K,D> *const *IdxM = IdxS + (IdxE - IdxS) / 2, *lo, *hi, *mid = allocNode(*IdxM);
+	size_t loHeight, hiHeight;
+	size++;
+	dataInsertBase(mid);
+	lo = copyRunBase(IdxS, IdxM, loHeight);
+	hi = copyRunBase(IdxM + 1, IdxE, hiHeight);
+	return joinBase(lo, loHeight, mid, hi, hiHeight, height);
+}
+
+/*
+ * function_identifier: Keeps what a difference keeps of a run: the last of a tree's equal nodes, after as many as the
+ *						other tree has are dropped
+ * parameters: 			The tree, the branch of its equal nodes, the branch's black height and size, the run in the
+ *						other tree, and where to store the kept branch's height
+ * return value:		The kept branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::subRunBase(rbTree<K,D,C> &rbt, rbtNode<K,D> *eq, size_t height, size_t count, rbtNode<K,D> *const *runS, rbtNode<K,D> *const *runE, size_t &keptHeight) {
+	return rbt.keepRunBase(eq, height, count - std::min(count, (size_t)(runE - runS)), false, keptHeight);
+}
+
+/*
+ * function_identifier: Merges a sorted array of another tree's nodes into a detached branch of this tree, one run of
+ *						equal key-data pairs at a time. The array's middle run splits the branch in three, both outer
+ *						pieces are merged with the array's halves, and the pieces are joined back. Untouched branches
+ *						are reused as they are. O(M*log(N/M + 1)), for M array nodes and N branch nodes
+ * parameters: 			The branch and its black height, the start and end of the array, if branch nodes with no
+ *						equal run in the array are kept, a function choosing what is kept of each run, and where to
+ *						store the result's height
+ * return value:		The merged branch's root
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+rbtNode<K,D> *rbTree<K,D,C>::mergeRunsBase(rbtNode<K,D> *curr, size_t height, rbtNode<K,D> *const *IdxS, rbtNode<K,D> *const *IdxE, bool unmatched, F &keep, size_t &mergedHeight) {
+		// With no runs left, the branch's nodes are unmatched
+	if (IdxS == IdxE) {
+		if (!unmatched) {
+			dropBase(curr);
+			curr = NULL;
+			height = 0;
+		}
+		mergedHeight = height;
+		return curr;
+	}
+
+		// Finds the run of equal nodes in the middle of the array
+	rbtNode<K,D> *const *runS = IdxS + (IdxE - IdxS) / 2, *const *runE = runS + 1;
+	while(runS != IdxS && keyDataEqual(*(runS - 1), *runS))
+		runS--;
+	while(runE != IdxE && keyDataEqual(*runE, *runS))
+		runE++;
+
+		// Splits the branch into the nodes before the run, equal to it, and after it
+	rbtNode<K,D> *lo, *eq, *hi;
+	size_t loHeight, eqHeight, hiHeight;
+	splitBase(curr, height, [runS] (rbtNode<K,D> *node, size_t) -> bool {return keyDataCompair(node, *runS);}, 0, lo, loHeight, hi, hiHeight);
+	splitBase(hi, hiHeight, [runS] (rbtNode<K,D> *node, size_t) -> bool {return !keyDataCompair(*runS, node);}, 0, eq, eqHeight, hi, hiHeight);
+
+		// Merges each piece, and joins them back together in order
+	lo = mergeRunsBase(lo, loHeight, IdxS, runS, unmatched, keep, loHeight);
+	eq = keep(*this, eq, eqHeight, eq ? eq->descendants + 1 : 0, runS, runE, eqHeight);
+	hi = mergeRunsBase(hi, hiHeight, runE, IdxE, unmatched, keep, hiHeight);
+	lo = concatBase(lo, loHeight, eq, eqHeight, loHeight);
+	return concatBase(lo, loHeight, hi, hiHeight, mergedHeight);
+}
+
+/*
+ * function_identifier: Merges a sorted array of another tree's nodes into this tree on several threads. Both are cut
+ *						below the same pivots, taken evenly from the larger one, so no run of equal nodes is cut. Each
+ *						part is merged (see mergeRunsBase) by its own worker tree, with its own pool, and the parts are
+ *						joined back in order, once every pool has been absorbed into this tree's pool
+ * parameters: 			The array and its length, if nodes with no equal run in the array are kept, a function
+ *						choosing what is kept of each run, the number of parts, and where to store the result's height
+ * return value:		The merged tree's root
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+rbtNode<K,D> *rbTree<K,D,C>::mergeRunsParallelBase(rbtNode<K,D> *const *rbtNodes, size_t len, bool unmatched, F &keep, size_t parts, size_t &height) {
+	std::vector<rbTree<K,D,C>> trees(parts);
+	std::vector<rbtNode<K,D> *const *> bounds(parts + 1);
+	std::vector<size_t> heights(parts);
+	std::vector<rbtNode<K,D> *> pivots(parts - 1);
+
+		// Picks the pivots before anything is cut
+	for(size_t i = 1; i < parts; i++)
+		pivots[i - 1] = len > size ? rbtNodes[len * i / parts] : rbt_nodeAt(size * i / parts);
+
+		// Cuts this tree, and the array, below each pivot, and hands each part to a worker tree
+	rbtNode<K,D> *rest = root;
+	size_t restHeight = blackHeightBase(root);
+	bounds[0] = rbtNodes;
+	for(size_t i = 0; i < parts; i++) {
+		rbtNode<K,D> *part = rest;
+		heights[i] = restHeight;
+		if (i + 1 < parts) {
+			rbtNode<K,D> *pivot = pivots[i];
+			splitBase(rest, restHeight, [pivot] (rbtNode<K,D> *node, size_t) -> bool {return keyDataCompair(node, pivot);}, 0, part, heights[i], rest, restHeight);
+			bounds[i + 1] = std::lower_bound(bounds[i], rbtNodes + len, pivot, keyDataCompair);
+		} else
+			bounds[i + 1] = rbtNodes + len;
+
+		trees[i].root = part;
+		trees[i].size = part ? part->descendants + 1 : 0;
+		trees[i].pool = std::make_shared<rbtPool<K,D>>();
+	}
+
+		// Merges every part on its own thread, each with its own data index
+	std::vector<std::thread> workers;
+	for(size_t i = 0; i < parts; i++)
+		workers.emplace_back([&, i] () -> void {
+			rbTree<K,D,C> &tree = trees[i];
+			tree.dataIndexBase();
+			tree.root = tree.mergeRunsBase(tree.root, heights[i], bounds[i], bounds[i + 1], unmatched, keep, heights[i]);
+		});
+	for(auto &worker : workers)
+		worker.join();
+
+		// Takes back every part's nodes, and joins the parts in order
+	if (!pool)
+		pool = std::make_shared<rbtPool<K,D>>();
+	rbtNode<K,D> *merged = NULL;
+	height = 0;
+	for(size_t i = 0; i < parts; i++) {
+		pool->absorb(*trees[i].pool);
+		merged = concatBase(merged, height, trees[i].root, heights[i], height);
+		trees[i].root = NULL;
+		trees[i].size = 0;
+	}
+	return merged;
+}
+
+/*
+ * function_identifier: Gets, in order, the other tree's nodes that have an equal run in this tree, at most as many per
+ *						run as this tree has. O(N*log(M)), for N nodes in this tree and M in the other, with no
+ *						O(M) pass over the other tree
+ * parameters: 			A red-black tree, and where to store the number of nodes found
+ * return value:		An array of the nodes found (of at most this tree's size)
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::matchedRunsBase(const rbTree<K,D,C> &rbt, size_t &len) const {
+	rbtNode<K,D> **rbtNodes = new rbtNode<K,D> *[size];
+	len = 0;
+
+		// Counts each of this tree's runs, and takes as many equal nodes from the other tree
+	for(iterator it(rbt_minKey(), root), last(NULL, root); it != last;) {
+		rbtNode<K,D> *first = &*it;
+		size_t count = 0;
+		for(; it != last && keyDataEqual(&*it, first); ++it)
+			count++;
+		for(iterator other = rbt.rbt_lowerBound(first->key, first->data); count && other != rbt.end() && keyDataEqual(&*other, first); ++other, count--)
+			rbtNodes[len++] = &*other;
+	}
+	return rbtNodes;
+}
+
+/*
+ * function_identifier: The base for the set operations done in place by splits and joins (see mergeRunsBase)
+ *						On one thread, the data index is kept up to date node by node. On more, large trees are
+ *						merged in parts (see mergeRunsParallelBase) and the data index is rebuilt
+ *						If the other tree's unmatched nodes are not copied in, and this tree is the smaller one, only
+ *						the other tree's matching runs are gathered (see matchedRunsBase), instead of all its nodes
+ * parameters: 			A red-black tree, if nodes with no equal run in that tree are kept, if that tree's nodes with
+ *						no equal run in this tree are copied in, a function choosing what is kept of each run (given
+ *						the tree, the branch of its equal nodes, the branch's black height and size, the run in the
+ *						other tree, and where to store the kept branch's height), and the number of threads to use
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+void rbTree<K,D,C>::mergeRunsI(const rbTree<K,D,C> &rbt, bool unmatched, bool copied, F keep, size_t threads) {
+		// Checks for node overflow
+	if (size + rbt.size < size)
+		throw std::overflow_error("overflow - red black tree(s) to large to perform opperation");
+
+		// Gets the other tree's nodes that can change the result, in order
+	size_t len = rbt.size;
+	rbtNode<K,D> **rbtNodes = !copied && size < rbt.size ? matchedRunsBase(rbt, len) : rbt.rbt_getAllNodes();
+	rbtNode<K,D> *merged;
+	size_t height;
+
+		// Merges them into this tree's nodes, in parts if the trees are large enough to be worth it
+	bool parallel = threads > 1 && size + len >= RBT_PARALLEL_CUTOFF;
+	if (parallel)
+		merged = mergeRunsParallelBase(rbtNodes, len, unmatched, keep, threads, height);
+	else
+		merged = mergeRunsBase(root, blackHeightBase(root), rbtNodes, rbtNodes + len, unmatched, keep, height);
+	root = merged;
+	if (root) {
+		root->parent = NULL;
+		root->setColor(false);
+	}
+
+		// Counts the parts' nodes, and indexes them
+	if (parallel) {
+		size = root ? root->descendants + 1 : 0;
+		dataIndexBase();
+	}
+
+		// Clears the accessed node array
+	delete [] rbtNodes;
+}
+
+/*
+ * function_identifier: Makes this (empty) tree the join of two trees and a node between them, emptying both trees
+ *						If the trees use different pools, the smaller one is first copied into the other's pool
+ * parameters: 			The lower tree, the middle node's key and data, and the upper tree
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::joinTreeBase(rbTree<K,D,C> &lo, K key, D data, rbTree<K,D,C> &hi) {
+		// Checks for node overflow
+	if (lo.size + hi.size + 1 == 0 || lo.size + hi.size > (rbt_count_t)-1)
+		throw std::overflow_error ("overflow - too many nodes to join into the red black tree");
+
+		// Nodes can only be linked together if they live in the same pool
+	if (lo.root && hi.root && lo.pool != hi.pool) {
+		rbTree<K,D,C> &smaller = lo.size < hi.size ? lo : hi;
+		rbTree<K,D,C> moved(lo.size < hi.size ? hi.pool : lo.pool);
+		moved.copyTree(smaller.root, &moved.root);
+		moved.size = smaller.size;
+		smaller.swapTree(moved);
+	}
+
+		// Takes over the pool holding the nodes (an empty tree may still own another pool), and allocates the
+		// middle node from it
+	pool = lo.root ? lo.pool : hi.root ? hi.pool : lo.pool ? lo.pool : hi.pool;
+	rbtNode<K,D> *mid = allocNode(key, data);
+
+		// Joins all the nodes into this tree
+	size_t height;
+	root = joinBase(lo.root, blackHeightBase(lo.root), mid, hi.root, blackHeightBase(hi.root), height);
+	size = lo.size + hi.size + 1;
+	lo.root = hi.root = NULL;
+	lo.size = hi.size = 0;
+
+		// The data index is rebuilt, as the trees' data are not ordered between them
+	dataIndexBase();
+}
+
+/*
+ * function_identifier: Splits the red-black tree at a key, in O(log(N)), without copying any nodes
+ *						This tree is left empty. Both trees share its pool
+ * parameters: 			The key to split at
+ * return value:		A pair of red-black trees: the nodes with keys less than the given key, and the rest
+*/
+template <typename K, typename D, typename C>
+std::pair<rbTree<K,D,C>, rbTree<K,D,C>> rbTree<K,D,C>::rbt_split(K key) {
+		// Both halves keep their nodes in this tree's pool
+	std::pair<rbTree<K,D,C>, rbTree<K,D,C>> halves(pool, pool);
+
+		// Splits the nodes between the halves
+	size_t loHeight, hiHeight;
+	splitBase(root, blackHeightBase(root), [&key] (rbtNode<K,D> *node, size_t) -> bool {
+		return C::key(node->key, key) < 0;
+	}, 0, halves.first.root, loHeight, halves.second.root, hiHeight);
+	halves.first.size = halves.first.root ? halves.first.root->descendants + 1 : 0;
+	halves.second.size = halves.second.root ? halves.second.root->descendants + 1 : 0;
+
+		// All nodes no longer belong to this tree, so size is 0 and root is NULL
+	size = 0; root = NULL;
+
+		// Each half gets its own data index
+	halves.first.dataIndexBase();
+	halves.second.dataIndexBase();
+	return halves;
+}
+
+/*
+ * function_identifier: Joins two trees, and a new node between them, into one red-black tree, in O(log(N)) when
+ *						both trees use the same pool. Every node in the lower tree must come before the new node,
+ *						in order, and every node in the upper tree after it. Both trees are left empty
+ * parameters: 			The lower tree, the new node's key and data, and the upper tree
+ * return value:		The joined red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_join(rbTree<K,D,C> &&lo, K key, D data, rbTree<K,D,C> &&hi) {
+		// Checks that the new node goes between both trees
+	rbtNode<K,D> *loMax = lo.rbt_maxKey(), *hiMin = hi.rbt_minKey();
+	int cmp;
+	if (loMax && ((cmp = C::key(key, loMax->key)) < 0 || (!cmp && C::data(data, loMax->data) < 0)))
+		throw std::invalid_argument ("invalid argument - the lower tree has nodes after the joined node");
+	if (hiMin && ((cmp = C::key(hiMin->key, key)) < 0 || (!cmp && C::data(hiMin->data, data) < 0)))
+		throw std::invalid_argument ("invalid argument - the upper tree has nodes before the joined node");
+
+		// Joins the trees
+	rbTree<K,D,C> rbt;
+	rbt.joinTreeBase(lo, key, data, hi);
+	return rbt;
+}
+
+/*
+ * function_identifier: Concatenates two trees into one red-black tree, in O(log(N)) when both trees use the same
+ *						pool. Every node in the lower tree must come before every node in the upper tree, in order
+ *						Both trees are left empty
+ * parameters: 			The lower and upper trees
+ * return value:		The concatenated red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_concat(rbTree<K,D,C> &&lo, rbTree<K,D,C> &&hi) {
+		// Ignores the trival cases
+	if (!hi.root)
+		return std::move(lo);
+	if (!lo.root)
+		return std::move(hi);
+
+		// Checks that the trees do not overlap
+	rbtNode<K,D> *loMax = lo.rbt_maxKey(), *hiMin = hi.rbt_minKey();
+	int cmp = C::key(hiMin->key, loMax->key);
+	if (cmp < 0 || (!cmp && C::data(hiMin->data, loMax->data) < 0))
+		throw std::invalid_argument ("invalid argument - the lower tree has nodes after the upper tree's first node");
+
+		// Takes the upper tree's first node out, and joins the trees around it
+	K key = hiMin->key;
+	D data = hi.rbt_delete(hiMin);
+	rbTree<K,D,C> rbt;
+	rbt.joinTreeBase(lo, key, data, hi);
+	return rbt;
+}
+
 #endif /* _rbt_OPERATIONS */
\ No newline at end of file
@@ -0,0 +1,224 @@
+#ifndef _rbt_POOL
+#define _rbt_POOL
+#include	"RBT_main.h"
+#include	"RBT_pool.h"
+
+/*==============================================================================\
+ | Program:		Key-Data Red-Black Tree Implementation							|
+ | AUTHOR:		Xavier Alvarez 													|
+ | CREATE DATE:	15-January-2023 												|
+ | COPYRIGHT:	apache-2.0														|
+ | VERSION:		1.0																|
+ | DESCRIPTION:	A red-black semi-balanced binary search tree. Provides a		|
+ |				multitude of useful functions, including O(log(N)) lookup,		|
+ |				insert and delete operations.									|
+ \=============================================================================*/
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                             SLAB MANAGEMENT                                | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Allocates a new slab of node slots and makes it the current bump region
+ *						The first slot of every slab links to the previously allocated slab
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D>
+void rbtPool<K,D>::newSlab() {
+		// Allocates the slab, plus one slot for the slab link
+	rbtSlot *slab = new rbtSlot[slabLen + 1];
+	slab->next = slabs;
+	slabs = slab;
+
+		// Hands out slots from the new slab
+	bump = slab + 1;
+	bumpEnd = bump + slabLen;
+
+		// Grows the next slab, up to the maximum slab length
+	if (slabLen < slabMax)
+		slabLen = (slabLen << 1) < slabMax ? slabLen << 1 : slabMax;
+}
+
+/*
+ * function_identifier: Gets storage for a single node. Reuses freed slots before touching a new slab
+ * parameters: 			N/A
+ * return value:		Uninitialized storage for a node
+*/
+template <typename K, typename D>
+inline void *rbtPool<K,D>::allocate() {
+	rbtSlot *slot;
+
+		// Reuses a freed slot if one is available
+	if (freeList) {
+		slot = freeList;
+		freeList = freeList->next;
+	} else {
+			// Otherwise, bump allocates from the current slab
+		if (bump == bumpEnd)
+			newSlab();
+		slot = bump++;
+	}
+
+	live++;
+	return slot->raw;
+}
+
+/*
+ * function_identifier: Returns the storage of a single, already destroyed, node to the pool
+ * parameters: 			The node storage
+ * return value:		N/A
+*/
+template <typename K, typename D>
+inline void rbtPool<K,D>::deallocate(void *ptr) {
+	rbtSlot *slot = reinterpret_cast<rbtSlot *>(ptr);
+
+		// Pushes the slot onto the free list
+	slot->next = freeList;
+	freeList = slot;
+	live--;
+}
+
+/*
+ * function_identifier: Drops every node in the pool at once, without visiting any of them
+ *						Keeps the most recent (largest) slab around for reuse
+ *						Only safe when no tree still owns nodes from this pool, or they are all trivially destructible and discarded
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D>
+void rbtPool<K,D>::reset() {
+		// Ignores the trival case
+	if (!slabs) return;
+
+		// Frees all but the most recent slab
+	rbtSlot *curr = slabs->next, *next;
+	while(curr) {
+		next = curr->next;
+		delete [] curr;
+		curr = next;
+	}
+	slabs->next = NULL;
+
+		// Starts handing out slots from the kept slab again
+	bump = slabs + 1;
+	freeList = NULL;
+	live = 0;
+}
+
+/*
+ * function_identifier: Takes over every slab and free slot of another pool, leaving it empty. Nodes handed out
+ *						by the other pool are returned to this one afterwards
+ * parameters: 			The other pool
+ * return value:		N/A
+*/
+template <typename K, typename D>
+void rbtPool<K,D>::absorb(rbtPool<K,D> &other) {
+		// Frees the rest of the other pool's bump region
+	while(other.bump != other.bumpEnd) {
+		other.bump->next = other.freeList;
+		other.freeList = other.bump++;
+	}
+
+		// Links the other pool's slabs in behind the most recent slab, which keeps handing out slots
+	if (other.slabs) {
+		rbtSlot *last = other.slabs;
+		while(last->next)
+			last = last->next;
+		if (slabs) {
+			last->next = slabs->next;
+			slabs->next = other.slabs;
+		} else
+			slabs = other.slabs;
+	}
+
+		// Reuses the other pool's free slots first
+	if (other.freeList) {
+		rbtSlot *last = other.freeList;
+		while(last->next)
+			last = last->next;
+		last->next = freeList;
+		freeList = other.freeList;
+	}
+
+		// Counts the other pool's live nodes (which wraps around, if it freed more of this pool's nodes than it handed out)
+	live += other.live;
+	other.slabs = other.freeList = other.bump = other.bumpEnd = NULL;
+	other.live = 0;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              POOL FUNCTIONS                                | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Returns the number of nodes currently handed out by the pool
+ * parameters: 			N/A
+ * return value:		The number of live nodes
+*/
+template <typename K, typename D>
+size_t rbtPool<K,D>::rbt_getLive() const {
+	return live;
+}
+
+/*
+ * function_identifier: Returns the number of slabs the pool currently holds
+ * parameters: 			N/A
+ * return value:		The number of slabs
+*/
+template <typename K, typename D>
+size_t rbtPool<K,D>::rbt_getSlabCount() const {
+	size_t count = 0;
+	for(rbtSlot *curr = slabs; curr; curr = curr->next)
+		count++;
+	return count;
+}
+
+/*
+ * function_identifier: Frees every slab held by the pool. Any node still allocated from the pool becomes invalid
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D>
+void rbtPool<K,D>::rbt_release() {
+		// Frees all slabs
+	rbtSlot *next;
+	while(slabs) {
+		next = slabs->next;
+		delete [] slabs;
+		slabs = next;
+	}
+
+		// Resets the pool to its empty state
+	freeList = bump = bumpEnd = NULL;
+	live = 0;
+}
+
+/*
+ * function_identifier: The constructor for the node pool
+ * parameters: 			The length of the first slab, and the maximum length any slab may grow to
+ * return value:		N/A
+*/
+template <typename K, typename D>
+rbtPool<K,D>::rbtPool(size_t first, size_t max) {
+	slabs = freeList = bump = bumpEnd = NULL;
+	slabLen = first ? first : 1;
+	slabMax = max > slabLen ? max : slabLen;
+	live = 0;
+}
+
+/*
+ * function_identifier: Frees all slabs before this object is deleted
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D>
+rbtPool<K,D>::~rbtPool() {
+	rbt_release();
+}
+
+#endif /* _rbt_POOL */
\ No newline at end of file
@@ -29,10 +29,10 @@
  *						to check if this call is in xor context
  * return value:		A red-black tree
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-inline rbTree<K,D> rbTree<K,D>::orBase(
-									  const rbTree<K,D> &rbt,
+inline rbTree<K,D,C> rbTree<K,D,C>::orBase(
+									  const rbTree<K,D,C> &rbt,
 									  void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
 									  F bar,
 									  bool data,
@@ -42,14 +42,14 @@ inline rbTree<K,D> rbTree<K,D>::orBase(
 		// If one or both of the trees are empty, or if the same tree is given, do the trival case
 	if (!rbt.size || &rbt == this) {
 		if (_xor && &rbt == this)
-			return rbTree<K,D>();
+			return rbTree<K,D,C>();
 
-		rbTree<K,D> ret = rbTree<K,D>(*this);
+		rbTree<K,D,C> ret = rbTree<K,D,C>(*this);
 		(ret.*bar)();
 		return ret;
 	}
 	if (!size) {
-		rbTree<K,D> ret = rbTree<K,D>(rbt);
+		rbTree<K,D,C> ret = rbTree<K,D,C>(rbt);
 		(ret.*bar)();
 		return ret;
 	}
@@ -75,9 +75,8 @@ inline rbTree<K,D> rbTree<K,D>::orBase(
 
 		// If we are doing an 'or' based on data, sort nodes by data
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(IdxS1, 0, size - 1);
-		mergeSortCallerBase(IdxS2, 0, rbt.size - 1);
+		mergeSortCallerBase(IdxS1, 0, size - 1, compair<DATA>());
+		mergeSortCallerBase(IdxS2, 0, rbt.size - 1, compair<DATA>());
 	}
 
 		// Cycles through the entire node array
@@ -96,14 +95,13 @@ inline rbTree<K,D> rbTree<K,D>::orBase(
 	sizeNew = IdxM - rbtNodes;
 
 		// Makes the tree
-	rbTree<K,D> rbtNew = rbTree<K,D>();
+	rbTree<K,D,C> rbtNew = rbTree<K,D,C>();
 	rbtNew.size = sizeNew;
 
 	if (sizeNew) {
 			// If we are doing an 'or' based on data, restore final nodes by key
 		if (data) {
-			fooPtr<K,D> = keyCompair;
-			mergeSortCallerBase(rbtNodes, 0, sizeNew - 1);
+			mergeSortCallerBase(rbtNodes, 0, sizeNew - 1, compair<KEY>());
 		}
 
 			// If there are remaining nodes, place them into the new tree
@@ -124,12 +122,12 @@ inline rbTree<K,D> rbTree<K,D>::orBase(
  *						to check if this call is in xor context
  * return value:		This object
 */
-template <typename K, typename D>
-template <typename F>
-inline rbTree<K,D> rbTree<K,D>::orBaseI(
-									   const rbTree<K,D> &rbt,
-									   void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
-									   F bar,
+template <typename K, typename D, typename C>
+template <typename F1, typename F2>
+inline rbTree<K,D,C> &rbTree<K,D,C>::orBaseI(
+									   const rbTree<K,D,C> &rbt,
+									   F1 foo,
+									   F2 bar,
 									   bool data,
 									   bool _xor
 									   )
@@ -145,6 +143,7 @@ inline rbTree<K,D> rbTree<K,D>::orBaseI(
 	if (!size) {
 		size = rbt.size;
 		copyTree(rbt.root, &(this->root));
+		dataIndexBase();
 		(this->*bar)();
 		return *this;
 	}
@@ -170,9 +169,8 @@ inline rbTree<K,D> rbTree<K,D>::orBaseI(
 
 		// If we are doing an 'or' based on data, sort nodes by data
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(IdxS1, 0, size - 1);
-		mergeSortCallerBase(IdxS2, 0, rbt.size - 1);
+		mergeSortCallerBase(IdxS1, 0, size - 1, compair<DATA>());
+		mergeSortCallerBase(IdxS2, 0, rbt.size - 1, compair<DATA>());
 	}
 
 		// Cycles through the entire node array
@@ -182,7 +180,7 @@ inline rbTree<K,D> rbTree<K,D>::orBaseI(
 	while(IdxS1 < IdxE1)
 		*IdxM++ = *IdxS1++;
 	while(IdxS2 < IdxE2)
-		*IdxM++ = new rbtNode<K,D>(*IdxS2++);
+		*IdxM++ = allocNode(*IdxS2++);
 
 		// Removes the array we don't need any more
 	delete [] (IdxE1 - size);
@@ -194,8 +192,7 @@ inline rbTree<K,D> rbTree<K,D>::orBaseI(
 	if (size) {
 			// If we are doing an 'and' based on data, restore final nodes by key
 		if (data) {
-			fooPtr<K,D> = keyCompair;
-			mergeSortCallerBase(rbtNodes, 0, size - 1);
+			mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEY>());
 		}
 
 		treeifyShallow(0, size - 1, rbtNodes, &root);
@@ -210,6 +207,61 @@ inline rbTree<K,D> rbTree<K,D>::orBaseI(
 	return *this;
 }
 
+/*
+ * function_identifier: Keeps what a union keeps of a run: as many of a tree's equal nodes as the other tree has, or
+ *						copies of the other tree's run if the tree has none
+ * parameters: 			The tree, the branch of its equal nodes, the branch's black height and size, the run in the
+ *						other tree, and where to store the kept branch's height
+ * return value:		The kept branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::orRunBase(rbTree<K,D,C> &rbt, rbtNode<K,D> *eq, size_t height, size_t count, rbtNode<K,D> *const *runS, rbtNode<K,D> *const *runE, size_t &keptHeight) {
+	if (!count)
+		return rbt.copyRunBase(runS, runE, keptHeight);
+	return rbt.keepRunBase(eq, height, std::min(count, (size_t)(runE - runS)), true, keptHeight);
+}
+
+/*
+ * function_identifier: Keeps what a union by most keeps of a run: all of a tree's equal nodes, and copies of the
+ *						other tree's extra ones
+ * parameters: 			The tree, the branch of its equal nodes, the branch's black height and size, the run in the
+ *						other tree, and where to store the kept branch's height
+ * return value:		The kept branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::orMostRunBase(rbTree<K,D,C> &rbt, rbtNode<K,D> *eq, size_t height, size_t count, rbtNode<K,D> *const *runS, rbtNode<K,D> *const *runE, size_t &keptHeight) {
+	size_t extra = (size_t)(runE - runS) > count ? (runE - runS) - count : 0, copiesHeight;
+	rbtNode<K,D> *copies = rbt.copyRunBase(runE - extra, runE, copiesHeight);
+	return rbt.concatBase(eq, height, copies, copiesHeight, keptHeight);
+}
+
+/*
+ * function_identifier: Keeps what an exclusive or keeps of a run: equal nodes from both trees cancel out in pairs,
+ *						and the rest of the longer run is kept (from the tree) or copied (from the other tree)
+ * parameters: 			The tree, the branch of its equal nodes, the branch's black height and size, the run in the
+ *						other tree, and where to store the kept branch's height
+ * return value:		The kept branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::xorRunBase(rbTree<K,D,C> &rbt, rbtNode<K,D> *eq, size_t height, size_t count, rbtNode<K,D> *const *runS, rbtNode<K,D> *const *runE, size_t &keptHeight) {
+	size_t other = runE - runS;
+	if (count >= other)
+		return rbt.keepRunBase(eq, height, count - other, false, keptHeight);
+	rbt.dropBase(eq);
+	return rbt.copyRunBase(runS + count, runE, keptHeight);
+}
+
+/*
+ * function_identifier: Keeps what an intersection keeps of a run: as many of a tree's equal nodes as the other tree has
+ * parameters: 			The tree, the branch of its equal nodes, the branch's black height and size, the run in the
+ *						other tree, and where to store the kept branch's height
+ * return value:		The kept branch's root
+*/
+template <typename K, typename D, typename C>
+rbtNode<K,D> *rbTree<K,D,C>::andRunBase(rbTree<K,D,C> &rbt, rbtNode<K,D> *eq, size_t height, size_t count, rbtNode<K,D> *const *runS, rbtNode<K,D> *const *runE, size_t &keptHeight) {
+	return rbt.keepRunBase(eq, height, std::min(count, (size_t)(runE - runS)), true, keptHeight);
+}
+
 /*
  * function_identifier: Takes all nodes from nodes from two rbTrees and process them into a new rbTree
  *						For nodes with unique key-data pair unique between the trees, add them like normal. If two trees share
@@ -218,36 +270,12 @@ inline rbTree<K,D> rbTree<K,D>::orBaseI(
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator|(const rbTree<K,D> &rbt) const {
-	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
-			// Loops through both sections of the array
-		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
-				// Checks if both considered nodes are equal
-				// If so, save it and continues saving as long as their more similar nodes in both trees. Skip the remaining
-				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					do {
-						(*IdxM++) = *IdxS1;
-					} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->equal(*IdxS2));
-
-					IdxS1--;
-					while(IdxS2 < IdxE2 && (*IdxS1)->equal(*IdxS2))
-						IdxS2++;
-					IdxS2--; IdxS1++;
-					while(IdxS1 < IdxE1 && (*IdxS1)->equal(*IdxS2))
-						IdxS1++;
-					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					*IdxM++ = *IdxS1++;
-				else
-					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				*IdxM++ = *IdxS1++;
-			else
-				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy);
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator|(const rbTree<K,D,C> &rbt) const {
+		// Copies this tree, and merges the other tree into the copy
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew |= rbt;
+	return rbtNew;
 }
 
 /*
@@ -255,39 +283,20 @@ rbTree<K,D> rbTree<K,D>::operator|(const rbTree<K,D> &rbt) const {
  *						For nodes with unique key-data pair unique between the trees, add them like normal. If two trees share
  *						the same key-data pair in or more of their nodes, whichever tree has the least number of the
  *						duplicates have precedence.
+ *						Splits this tree around the other tree's runs and joins the pieces back, so untouched branches
+ *						are reused. O(M*log(N/M + 1)), for M nodes in the other tree and N nodes in this one
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator|=(const rbTree<K,D> &rbt) {
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
-			// Loops through both sections of the array
-		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
-				// Checks if both considered nodes are equal
-				// If so, save it and continues saving as long as their more similar nodes in both trees. Skip the remaining
-				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					do {
-						(*IdxM++) = *IdxS1;
-					} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->equal(*IdxS2));
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator|=(const rbTree<K,D,C> &rbt) {
+		// Ignores the trival case
+	if (&rbt == this)
+		return *this;
 
-					IdxS1--;
-					while(IdxS2 < IdxE2 && (*IdxS1)->equal(*IdxS2))
-						IdxS2++;
-					IdxS2--; IdxS1++;
-					while(IdxS1 < IdxE1 && (*IdxS1)->equal(*IdxS2))
-						delete *IdxS1++;
-					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					*IdxM++ = *IdxS1++;
-				else
-					(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				*IdxM++ = *IdxS1++;
-			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy);
+		// Keeps as many of this tree's equal nodes as the other tree has, or copies the other tree's run if there are none
+	mergeRunsI(rbt, true, true, orRunBase);
+	return *this;
 }
 
 /*
@@ -295,8 +304,8 @@ rbTree<K,D> rbTree<K,D>::operator|=(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_or(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_or(const rbTree<K,D,C> &rbt) const {
 	return *this | rbt;
 }
 
@@ -305,19 +314,66 @@ inline rbTree<K,D> rbTree<K,D>::rbt_or(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_orI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_orI(const rbTree<K,D,C> &rbt) {
 	return *this |= rbt;
 }
 
+/*
+ * function_identifier: Unions an expiring red-black tree into a new red-black tree
+ *						Reuses the expiring tree's nodes, so only the nodes needed from this tree are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator|(rbTree<K,D,C> &&rbt) const {
+	rbt |= *this;
+	return std::move(rbt);
+}
+
+/*
+ * function_identifier: Unions an expiring red-black tree into the current tree
+ *						Keeps the nodes of whichever tree is larger, so only the smaller tree's nodes are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator|=(rbTree<K,D,C> &&rbt) {
+		// Takes over the larger tree's nodes
+	if (rbt.size > size)
+		swapTree(rbt);
+
+	return *this |= rbt;
+}
+
+/*
+ * function_identifier: The alias for the | operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_or(rbTree<K,D,C> &&rbt) const {
+	return *this | std::move(rbt);
+}
+
+/*
+ * function_identifier: The alias for the |= operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_orI(rbTree<K,D,C> &&rbt) {
+	return *this |= std::move(rbt);
+}
+
 /*
  * function_identifier: Places all the nodes in both trees into a single resulting tree. No duplicate data/keys
  *						pairs.
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -325,26 +381,26 @@ rbTree<K,D> rbTree<K,D>::rbt_orLeast(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes are equal
 				// If so, save it. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					(*IdxM++) = *IdxS1;
 
 					IdxS2++;
-					while(IdxS2 < IdxE2 && (*IdxS1)->equal(*IdxS2))
+					while(IdxS2 < IdxE2 && keyDataEqual(*IdxS1, *IdxS2))
 						IdxS2++;
 					IdxS2--; IdxS1++;
-					while(IdxS1 < IdxE1 && (*IdxS1)->equal(*IdxS2))
+					while(IdxS1 < IdxE1 && keyDataEqual(*IdxS1, *IdxS2))
 						IdxS1++;
 					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
 					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -353,36 +409,36 @@ rbTree<K,D> rbTree<K,D>::rbt_orLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes are equal
 				// If so, save it. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					(*IdxM++) = *IdxS1;
 
 					IdxS2++;
-					while(IdxS2 < IdxE2 && (*IdxS1)->equal(*IdxS2))
+					while(IdxS2 < IdxE2 && keyDataEqual(*IdxS1, *IdxS2))
 						IdxS2++;
 					IdxS2--; IdxS1++;
-					while(IdxS1 < IdxE1 && (*IdxS1)->equal(*IdxS2))
-						delete *IdxS1++;
+					while(IdxS1 < IdxE1 && keyDataEqual(*IdxS1, *IdxS2))
+						freeNode(*IdxS1++);
 					IdxS2++;
 
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
-					(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+					(*IdxM++) = allocNode(*IdxS2++);
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -393,27 +449,12 @@ rbTree<K,D> rbTree<K,D>::rbt_orLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orMost(const rbTree<K,D> &rbt) const {
-		// Calls the or template function
-	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
-			// Loops through both sections of the array
-		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
-				// Checks if both considered nodes are equal
-				// If so, save it until no more similar nodes are found in either tree
-				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					(*IdxM++) = *IdxS1++; IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					*IdxM++ = *IdxS1++;
-				else
-					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				*IdxM++ = *IdxS1++;
-			else
-				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy);
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orMost(const rbTree<K,D,C> &rbt) const {
+		// Copies this tree, and merges the other tree into the copy
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew.rbt_orMostI(rbt);
+	return rbtNew;
 }
 
 /*
@@ -421,30 +462,20 @@ rbTree<K,D> rbTree<K,D>::rbt_orMost(const rbTree<K,D> &rbt) const {
  *						For nodes with unique key-data pair between both trees, add them like normal. If two trees share
  *						nodes with the same key-data pair in or more of their nodes, whichever tree has the most number of
  *						duplicates takes precedence.
+ *						Splits this tree around the other tree's runs and joins the pieces back, so untouched branches
+ *						are reused. O(M*log(N/M + 1)), for M nodes in the other tree and N nodes in this one
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orMostI(const rbTree<K,D> &rbt) {
-		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
-			// Loops through both sections of the array
-		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
-				// Checks if both considered nodes are equal
-				// If so, save it until no more similar nodes are found in either tree
-				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					(*IdxM++) = *IdxS1++; IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					*IdxM++ = *IdxS1++;
-				else
-					(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				*IdxM++ = *IdxS1++;
-			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy);
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orMostI(const rbTree<K,D,C> &rbt) {
+		// Ignores the trival case
+	if (&rbt == this)
+		return *this;
+
+		// Keeps all of this tree's equal nodes, and copies the other tree's extra ones
+	mergeRunsI(rbt, true, true, orMostRunBase);
+	return *this;
 }
 
 /*
@@ -455,31 +486,31 @@ rbTree<K,D> rbTree<K,D>::rbt_orMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orKey(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orKey(const rbTree<K,D,C> &rbt) const {
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it and continues saving as long as their more similar nodes in both trees. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				do {
 					(*IdxM++) = *IdxS1;
-				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == (*IdxS2)->key);
+				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, (*IdxS2)->key) == 0);
 
 				IdxS1--;
-				while(IdxS2 < IdxE2 && (*IdxS1)->key == (*IdxS2)->key)
+				while(IdxS2 < IdxE2 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->key == (*IdxS2)->key)
+				while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
 					IdxS1++;
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -490,31 +521,31 @@ rbTree<K,D> rbTree<K,D>::rbt_orKey(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orKeyI(const rbTree<K,D> &rbt) {
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orKeyI(const rbTree<K,D,C> &rbt) {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it and continues saving as long as their more similar nodes in both trees. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				do {
 					(*IdxM++) = *IdxS1;
-				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == (*IdxS2)->key);
+				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, (*IdxS2)->key) == 0);
 
 				IdxS1--;
-				while(IdxS2 < IdxE2 && (*IdxS1)->key == (*IdxS2)->key)
+				while(IdxS2 < IdxE2 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->key == (*IdxS2)->key)
-					delete *IdxS1++;
+				while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
+					freeNode(*IdxS1++);
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -523,8 +554,8 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orKeyLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orKeyLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -532,21 +563,21 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyLeast(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, save it. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				(*IdxM++) = *IdxS1;
 
 				IdxS2++;
-				while(IdxS2 < IdxE2 && (*IdxS1)->key == (*IdxS2)->key)
+				while(IdxS2 < IdxE2 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->key == (*IdxS2)->key)
+				while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
 					IdxS1++;
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicateKeys);
+    }, &rbTree<K,D,C>::rbt_removeDuplicateKeys);
 }
 
 /*
@@ -555,30 +586,30 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orKeyLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orKeyLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				(*IdxM++) = *IdxS1;
 
 				IdxS2++;
-				while(IdxS2 < IdxE2 && (*IdxS1)->key == (*IdxS2)->key)
+				while(IdxS2 < IdxE2 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->key == (*IdxS2)->key)
-					delete *IdxS1++;
+				while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0)
+					freeNode(*IdxS1++);
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::rbt_removeDuplicateKeys);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::rbt_removeDuplicateKeys);
 }
 
 /*
@@ -589,8 +620,8 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orKeyMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orKeyMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -598,13 +629,13 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, save it until no more similar nodes are found in either tree
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				(*IdxM++) = *IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -615,22 +646,22 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orKeyMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orKeyMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it until no more similar nodes are found in either tree
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				(*IdxM++) = *IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -641,31 +672,31 @@ rbTree<K,D> rbTree<K,D>::rbt_orKeyMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orData(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orData(const rbTree<K,D,C> &rbt) const {
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it and continues saving as long as their more similar nodes in both trees. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				do {
 					(*IdxM++) = *IdxS1;
-				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->data == (*IdxS2)->data);
+				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::data((*IdxS1)->data, (*IdxS2)->data) == 0);
 
 				IdxS1--;
-				while(IdxS2 < IdxE2 && (*IdxS1)->data == (*IdxS2)->data)
+				while(IdxS2 < IdxE2 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->data == (*IdxS2)->data)
+				while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
 					IdxS1++;
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, true);
+    }, &rbTree<K,D,C>::dummy, true);
 }
 
 /*
@@ -676,31 +707,31 @@ rbTree<K,D> rbTree<K,D>::rbt_orData(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orDataI(const rbTree<K,D> &rbt) {
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orDataI(const rbTree<K,D,C> &rbt) {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it and continues saving as long as their more similar nodes in both trees. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				do {
 					(*IdxM++) = *IdxS1;
-				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->data == (*IdxS2)->data);
+				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::data((*IdxS1)->data, (*IdxS2)->data) == 0);
 
 				IdxS1--;
-				while(IdxS2 < IdxE2 && (*IdxS1)->data == (*IdxS2)->data)
+				while(IdxS2 < IdxE2 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->data == (*IdxS2)->data)
-					delete *IdxS1++;
+				while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
+					freeNode(*IdxS1++);
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, true);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, true);
 }
 
 /*
@@ -709,8 +740,8 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orDataLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orDataLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -718,21 +749,21 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataLeast(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, save it. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				(*IdxM++) = *IdxS1;
 
 				IdxS2++;
-				while(IdxS2 < IdxE2 && (*IdxS1)->data == (*IdxS2)->data)
+				while(IdxS2 < IdxE2 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->data == (*IdxS2)->data)
+				while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
 					IdxS1++;
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicateData, true);
+    }, &rbTree<K,D,C>::rbt_removeDuplicateData, true);
 }
 
 /*
@@ -741,30 +772,30 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orDataLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orDataLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it. Skip the remaining
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				(*IdxM++) = *IdxS1;
 
 				IdxS2++;
-				while(IdxS2 < IdxE2 && (*IdxS1)->data == (*IdxS2)->data)
+				while(IdxS2 < IdxE2 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
 					IdxS2++;
 				IdxS2--; IdxS1++;
-				while(IdxS1 < IdxE1 && (*IdxS1)->data == (*IdxS2)->data)
-					delete *IdxS1++;
+				while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0)
+					freeNode(*IdxS1++);
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::rbt_removeDuplicateData, true);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::rbt_removeDuplicateData, true);
 }
 
 /*
@@ -775,8 +806,8 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orDataMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orDataMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -784,13 +815,13 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, save it until no more similar nodes are found in either tree
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				(*IdxM++) = *IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, true);
+    }, &rbTree<K,D,C>::dummy, true);
 }
 
 /*
@@ -801,22 +832,22 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_orDataMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orDataMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it until no more similar nodes are found in either tree
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				(*IdxM++) = *IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				(*IdxM++) = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, true);
+				(*IdxM++) = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, true);
 }
 
 /*
@@ -827,8 +858,8 @@ rbTree<K,D> rbTree<K,D>::rbt_orDataMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator^(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator^(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -836,19 +867,19 @@ rbTree<K,D> rbTree<K,D>::operator^(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal key/data
 				// If so, skip them
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Skips this node
 					IdxS2++; IdxS1++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
 					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, false, true);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -859,28 +890,28 @@ rbTree<K,D> rbTree<K,D>::operator^(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator^=(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator^=(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal key/data
 				// If so, skip/delete them
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Skips/deletes this node
-					IdxS2++; delete *IdxS1++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+					IdxS2++; freeNode(*IdxS1++);
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+					*IdxM++ = allocNode(*IdxS2++);
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, false, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -888,8 +919,8 @@ rbTree<K,D> rbTree<K,D>::operator^=(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_xor(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_xor(const rbTree<K,D,C> &rbt) const {
 	return *this ^ rbt;
 }
 
@@ -898,11 +929,58 @@ inline rbTree<K,D> rbTree<K,D>::rbt_xor(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_xorI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorI(const rbTree<K,D,C> &rbt) {
+	return *this ^= rbt;
+}
+
+/*
+ * function_identifier: Xors an expiring red-black tree into a new red-black tree
+ *						Reuses the expiring tree's nodes, so only the nodes needed from this tree are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator^(rbTree<K,D,C> &&rbt) const {
+	rbt ^= *this;
+	return std::move(rbt);
+}
+
+/*
+ * function_identifier: Xors an expiring red-black tree into the current tree
+ *						Keeps the nodes of whichever tree is larger, so only the smaller tree's nodes are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator^=(rbTree<K,D,C> &&rbt) {
+		// Takes over the larger tree's nodes
+	if (rbt.size > size)
+		swapTree(rbt);
+
 	return *this ^= rbt;
 }
 
+/*
+ * function_identifier: The alias for the ^ operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_xor(rbTree<K,D,C> &&rbt) const {
+	return *this ^ std::move(rbt);
+}
+
+/*
+ * function_identifier: The alias for the ^= operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorI(rbTree<K,D,C> &&rbt) {
+	return *this ^= std::move(rbt);
+}
+
 /*
  * function_identifier: Takes all nodes from two rbTrees and process them into a new rbTree
  *						For nodes with the same key/data pair between both trees, disclude them. Else
@@ -911,8 +989,8 @@ inline rbTree<K,D> rbTree<K,D>::rbt_xorI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -921,36 +999,36 @@ rbTree<K,D> rbTree<K,D>::rbt_xorLeast(const rbTree<K,D> &rbt) const {
 				// If so, skip them. If one tree has more duplicates than the other
 				// tree, save one and skip the rest.
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Saves the expected key/data pair
 					K dupKey = (*IdxS1)->key; D dupData = (*IdxS1)->data;
 
 						// Skips all nodes of same value. Only stops when no more nodes in
 						// one of the two arrays, or if a different key/data pair is found.
-					while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData);
+					while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0);
 
 						// If more of the same key/data pair nodes found on IdxS1's nodes,
 						// save the first and skip the rest
-					if (IdxS1 < IdxE1 && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData) {
+					if (IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0) {
 						*IdxM++ = *IdxS1;
-						while(++IdxS1 < IdxE1 && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData);
+						while(++IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0);
 					}
 						// If more of the same key/data pair nodes found on IdxS2's nodes,
 						// save the first and skip the rest
-					else if (IdxS2 < IdxE2 && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData) {
+					else if (IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0) {
 						*IdxM++ = *IdxS2;
-						while(++IdxS2 < IdxE2 && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData);
+						while(++IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0);
 					}
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
 					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates, false, true);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates, false, true);
 }
 
 /*
@@ -961,18 +1039,18 @@ rbTree<K,D> rbTree<K,D>::rbt_xorLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal key/data
 				// If so, skip/delete them. If one tree has more duplicates than the other
 				// tree, save one and skip/delete the rest.
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Saves the expected key/data pair
 					K dupKey = (*IdxS1)->key; D dupData = (*IdxS1)->data;
 
@@ -980,32 +1058,32 @@ rbTree<K,D> rbTree<K,D>::rbt_xorLeastI(const rbTree<K,D> &rbt) {
 						// when no more nodes in one of the two arrays, or if a different
 						// key/data pair is found.
 					do {
-						delete *IdxS1++;
-					} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData);
+						freeNode(*IdxS1++);
+					} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0);
 
 						// If more of the same key/data pair nodes found on IdxS1's nodes,
 						// save the first and delete the rest
-					if (IdxS1 < IdxE1 && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData) {
+					if (IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0) {
 						*IdxM++ = *IdxS1++;
 						do {
-							delete *IdxS1++;
-						} while(IdxS1 < IdxE1 && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData);
+							freeNode(*IdxS1++);
+						} while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0);
 					}
 						// If more of the same key/data pair nodes found on IdxS2's nodes,
 						// save the first and skip the rest
-					else if (IdxS2 < IdxE2 && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData) {
-						*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-						while(++IdxS2 < IdxE2 && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData);
+					else if (IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0) {
+						*IdxM++ = allocNode(*IdxS2++);
+						while(++IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0);
 					}
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+					*IdxM++ = allocNode(*IdxS2++);
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::rbt_removeDuplicates, false, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates, false, true);
 }
 
 /*
@@ -1016,8 +1094,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1025,25 +1103,25 @@ rbTree<K,D> rbTree<K,D>::rbt_xorMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal key/data
 				// If so, skip all similar nodes in both trees
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Skips all nodes, in IdxS2, duplicate to node found
 						// in IdxS1
-					while(++IdxS2 < IdxE2 && (*IdxS1)->equal(*IdxS2));
+					while(++IdxS2 < IdxE2 && keyDataEqual(*IdxS1, *IdxS2));
 					IdxS2--;
 						// Skips all nodes, in IdxS1, duplicate to node found
 						// in IdxS2
-					while(++IdxS1 < IdxE1 && (*IdxS1)->equal(*IdxS2));
+					while(++IdxS1 < IdxE1 && keyDataEqual(*IdxS1, *IdxS2));
 					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
 					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, false, true);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -1054,36 +1132,36 @@ rbTree<K,D> rbTree<K,D>::rbt_xorMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal key/data
 				// If so, skip/delete all similar nodes in both trees
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Skips all nodes, in IdxS2, duplicate to node found
 						// in IdxS1
-					while(++IdxS2 < IdxE2 && (*IdxS1)->equal(*IdxS2));
+					while(++IdxS2 < IdxE2 && keyDataEqual(*IdxS1, *IdxS2));
 					IdxS2--;
 						// Deletes all nodes, in IdxS1, duplicate to node found
 						// in IdxS2
 					do {
-						delete *IdxS1++;
-					} while(IdxS1 < IdxE1 && (*IdxS1)->equal(*IdxS2));
+						freeNode(*IdxS1++);
+					} while(IdxS1 < IdxE1 && keyDataEqual(*IdxS1, *IdxS2));
 					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					*IdxM++ = *IdxS1++;
 				else
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+					*IdxM++ = allocNode(*IdxS2++);
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, false, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -1094,8 +1172,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorKey(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorKey(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1103,14 +1181,14 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKey(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, skip them
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Skips this node
 				IdxS2++; IdxS1++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, false, true);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -1121,23 +1199,23 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKey(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorKeyI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorKeyI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, skip/delete them
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Skips/deletes this node
-				IdxS2++; delete *IdxS1++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+				IdxS2++; freeNode(*IdxS1++);
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, false, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -1148,8 +1226,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorKeyLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorKeyLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1158,31 +1236,31 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyLeast(const rbTree<K,D> &rbt) const {
 				// If so, skip them. If one tree has more duplicates than the other
 				// tree, save one and skip the rest.
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Saves the expected key
 				K dupKey = (*IdxS1)->key;
 
 					// Skips all nodes of same value. Only stops when no more nodes in
 					// one of the two arrays, or if a different key is found.
-				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS2)->key == dupKey);
+				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::key((*IdxS2)->key, dupKey) == 0);
 
 					// If more nodes with the same key found on IdxS1's nodes,
 					// save the first and skip the rest
-				if (IdxS1 < IdxE1 && (*IdxS1)->key == dupKey) {
+				if (IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0) {
 					*IdxM++ = *IdxS1;
-					while(++IdxS1 < IdxE1 && (*IdxS1)->key == dupKey);
+					while(++IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0);
 				}
 					// If more nodes with the same key found on IdxS2's nodes,
 					// save the first and skip the rest
-				else if (IdxS2 < IdxE2 && (*IdxS2)->key == dupKey) {
+				else if (IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0) {
 					*IdxM++ = *IdxS2;
-					while(++IdxS2 < IdxE2 && (*IdxS2)->key == dupKey);
+					while(++IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0);
 				}
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates, false, true);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates, false, true);
 }
 
 /*
@@ -1193,17 +1271,17 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorKeyLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorKeyLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, skip/delete them. If one tree has more duplicates than the other
 				// tree, save one and skip/delete the rest.
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Saves the expected key
 				K dupKey = (*IdxS1)->key;;
 
@@ -1211,28 +1289,28 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyLeastI(const rbTree<K,D> &rbt) {
 					// when no more nodes in one of the two arrays, or if a different
 					// key is found.
 				do {
-					delete *IdxS1;
-				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS2)->key == dupKey);
+					freeNode(*IdxS1);
+				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::key((*IdxS2)->key, dupKey) == 0);
 
 					// If more nodes with the same key found on IdxS1's nodes,
 					// save the first and delete the rest
-				if (IdxS1 < IdxE1 && (*IdxS1)->key == dupKey) {
+				if (IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0) {
 					*IdxM++ = *IdxS1++;
 					do {
-						delete *IdxS1++;
-					} while(IdxS1 < IdxE1 && (*IdxS1)->key == dupKey);
+						freeNode(*IdxS1++);
+					} while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0);
 				}
 					// If more nodes with the same key found on IdxS2's nodes,
 					// save the first and skip the rest
-				else if (IdxS2 < IdxE2 && (*IdxS2)->key == dupKey) {
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-					while(++IdxS2 < IdxE2 && (*IdxS2)->key == dupKey);
+				else if (IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0) {
+					*IdxM++ = allocNode(*IdxS2++);
+					while(++IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0);
 				}
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::rbt_removeDuplicates, false, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates, false, true);
 }
 
 /*
@@ -1243,8 +1321,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorKeyMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorKeyMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1252,20 +1330,20 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, skip all similar nodes in both trees
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Skips all nodes, in IdxS2, with duplicate key to
 					// node found in IdxS1
-				while(++IdxS2 < IdxE2 && (*IdxS1)->key == (*IdxS2)->key);
+				while(++IdxS2 < IdxE2 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0);
 				IdxS2--;
 					// Skips all nodes, in IdxS1, with duplicate key to
 					// node found in IdxS2
-				while(++IdxS1 < IdxE1 && (*IdxS1)->key == (*IdxS2)->key);
+				while(++IdxS1 < IdxE1 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0);
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, false, true);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -1276,31 +1354,31 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorKeyMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorKeyMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, skip/delete all similar nodes in both trees
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Skips all nodes, in IdxS2, with duplicate key to
 					// node found in IdxS1
-				while(++IdxS2 < IdxE2 && (*IdxS1)->key == (*IdxS2)->key);
+				while(++IdxS2 < IdxE2 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0);
 				IdxS2--;
 					// Deletes all nodes, in IdxS2, with duplicate key to
 					// node found in IdxS1
 				do {
-					delete *IdxS1++;
-				} while(IdxS1 < IdxE1 && (*IdxS1)->key == (*IdxS2)->key);
+					freeNode(*IdxS1++);
+				} while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, (*IdxS2)->key) == 0);
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, false, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, false, true);
 }
 
 /*
@@ -1311,8 +1389,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorKeyMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorData(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorData(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1320,14 +1398,14 @@ rbTree<K,D> rbTree<K,D>::rbt_xorData(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, skip them
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Skips this node
 				IdxS2++; IdxS1++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, true, true);
+    }, &rbTree<K,D,C>::dummy, true, true);
 }
 
 /*
@@ -1338,23 +1416,23 @@ rbTree<K,D> rbTree<K,D>::rbt_xorData(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorDataI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorDataI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, skip/delete them
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Skips/deletes this node
-				IdxS2++; delete *IdxS1++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+				IdxS2++; freeNode(*IdxS1++);
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, true, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, true, true);
 }
 
 /*
@@ -1365,8 +1443,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorDataLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorDataLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1375,31 +1453,31 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataLeast(const rbTree<K,D> &rbt) const {
 				// If so, skip them. If one tree has more duplicates than the other
 				// tree, save one and skip the rest.
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Saves the expected data
 				D dupData = (*IdxS1)->data;
 
 					// Skips all nodes of same value. Only stops when no more nodes in
 					// one of the two arrays, or if a different data is found.
-				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->data == dupData && (*IdxS2)->data == dupData);
+				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::data((*IdxS1)->data, dupData) == 0 && C::data((*IdxS2)->data, dupData) == 0);
 
 					// If more nodes with the same data found on IdxS1's nodes,
 					// save the first and skip the rest
-				if (IdxS1 < IdxE1 && (*IdxS1)->data == dupData) {
+				if (IdxS1 < IdxE1 && C::data((*IdxS1)->data, dupData) == 0) {
 					*IdxM++ = *IdxS1;
-					while(++IdxS1 < IdxE1 && (*IdxS1)->data == dupData);
+					while(++IdxS1 < IdxE1 && C::data((*IdxS1)->data, dupData) == 0);
 				}
 					// If more nodes with the same data found on IdxS2's nodes,
 					// save the first and skip the rest
-				else if (IdxS2 < IdxE2 && (*IdxS2)->data == dupData) {
+				else if (IdxS2 < IdxE2 && C::data((*IdxS2)->data, dupData) == 0) {
 					*IdxM++ = *IdxS2;
-					while(++IdxS2 < IdxE2 && (*IdxS2)->data == dupData);
+					while(++IdxS2 < IdxE2 && C::data((*IdxS2)->data, dupData) == 0);
 				}
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates, true, true);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates, true, true);
 }
 
 /*
@@ -1410,17 +1488,17 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorDataLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorDataLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, skip/delete them. If one tree has more duplicates than the other
 				// tree, save one and skip/delete the rest.
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Saves the expected data
 				D dupData = (*IdxS1)->data;;
 
@@ -1428,28 +1506,28 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataLeastI(const rbTree<K,D> &rbt) {
 					// when no more nodes in one of the two arrays, or if a different
 					// data is found.
 				do {
-					delete *IdxS1;
-				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->data == dupData && (*IdxS2)->data == dupData);
+					freeNode(*IdxS1);
+				} while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::data((*IdxS1)->data, dupData) == 0 && C::data((*IdxS2)->data, dupData) == 0);
 
 					// If more nodes with the same data found on IdxS1's nodes,
 					// save the first and delete the rest
-				if (IdxS1 < IdxE1 && (*IdxS1)->data == dupData) {
+				if (IdxS1 < IdxE1 && C::data((*IdxS1)->data, dupData) == 0) {
 					*IdxM++ = *IdxS1++;
 					do {
-						delete *IdxS1++;
-					} while(IdxS1 < IdxE1 && (*IdxS1)->data == dupData);
+						freeNode(*IdxS1++);
+					} while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, dupData) == 0);
 				}
 					// If more nodes with the same data found on IdxS2's nodes,
 					// save the first and skip the rest
-				else if (IdxS2 < IdxE2 && (*IdxS2)->data == dupData) {
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-					while(++IdxS2 < IdxE2 && (*IdxS2)->data == dupData);
+				else if (IdxS2 < IdxE2 && C::data((*IdxS2)->data, dupData) == 0) {
+					*IdxM++ = allocNode(*IdxS2++);
+					while(++IdxS2 < IdxE2 && C::data((*IdxS2)->data, dupData) == 0);
 				}
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::rbt_removeDuplicates, true, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates, true, true);
 }
 
 /*
@@ -1460,8 +1538,8 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorDataMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorDataMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the or template function
 	return orBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1469,20 +1547,20 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, skip all similar nodes in both trees
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Skips all nodes, in IdxS2, with duplicate data to
 					// node found in IdxS1
-				while(++IdxS2 < IdxE2 && (*IdxS1)->data == (*IdxS2)->data);
+				while(++IdxS2 < IdxE2 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0);
 				IdxS2--;
 					// Skips all nodes, in IdxS1, with duplicate data to
 					// node found in IdxS2
-				while(++IdxS1 < IdxE1 && (*IdxS1)->data == (*IdxS2)->data);
+				while(++IdxS1 < IdxE1 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0);
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
 				*IdxM++ = *IdxS2++;
-    }, &rbTree<K,D>::dummy, true, true);
+    }, &rbTree<K,D,C>::dummy, true, true);
 }
 
 /*
@@ -1493,31 +1571,31 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		This object
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_xorDataMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorDataMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the orI template function
-	return orBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return orBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 < IdxE1 && IdxS2 < IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, skip/delete all similar nodes in both trees
 				// If not, save it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Skips all nodes, in IdxS2, with duplicate data to
 					// node found in IdxS1
-				while(++IdxS2 < IdxE2 && (*IdxS1)->data == (*IdxS2)->data);
+				while(++IdxS2 < IdxE2 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0);
 				IdxS2--;
 					// Deletes all nodes, in IdxS2, with duplicate data to
 					// node found in IdxS1
 				do {
-					delete *IdxS1++;
-				} while(IdxS1 < IdxE1 && (*IdxS1)->data == (*IdxS2)->data);
+					freeNode(*IdxS1++);
+				} while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, (*IdxS2)->data) == 0);
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				*IdxM++ = *IdxS1++;
 			else
-				*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-    }, &rbTree<K,D>::dummy, true, true);
+				*IdxM++ = allocNode(*IdxS2++);
+    }, &rbTree<K,D,C>::dummy, true, true);
 }
 
 /*
@@ -1525,10 +1603,10 @@ rbTree<K,D> rbTree<K,D>::rbt_xorDataMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree and a function to copy over nodes
  * return value:		A red-black tree
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-inline rbTree<K,D> rbTree<K,D>::andBase(
-									   const rbTree<K,D> &rbt,
+inline rbTree<K,D,C> rbTree<K,D,C>::andBase(
+									   const rbTree<K,D,C> &rbt,
 									   void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
 									   F bar,
 									   bool data
@@ -1536,9 +1614,9 @@ inline rbTree<K,D> rbTree<K,D>::andBase(
 {
 		// Ignores the trival case
 	if (!size || !rbt.size)
-		return rbTree<K,D>();
+		return rbTree<K,D,C>();
 	if (&rbt == this) {
-		rbTree<K,D> ret = *this;
+		rbTree<K,D,C> ret = *this;
 		(ret.*bar)();
 		return ret;
 	}
@@ -1553,9 +1631,8 @@ inline rbTree<K,D> rbTree<K,D>::andBase(
 
 		// If we are doing an 'and' based on data, sort nodes by data
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(IdxS1, 0, size - 1);
-		mergeSortCallerBase(IdxS2, 0, rbt.size - 1);
+		mergeSortCallerBase(IdxS1, 0, size - 1, compair<DATA>());
+		mergeSortCallerBase(IdxS2, 0, rbt.size - 1, compair<DATA>());
 	}
 
 		// Cycles through the entire node array
@@ -1571,14 +1648,13 @@ inline rbTree<K,D> rbTree<K,D>::andBase(
 	size_t sizeNew = (IdxM - IdxS1);
 
 		// Create a tree from nodes
-	rbTree<K,D> rbtNew = rbTree<K,D>();
+	rbTree<K,D,C> rbtNew = rbTree<K,D,C>();
 	rbtNew.size = sizeNew;
 
 	if (sizeNew) {
 			// If we are doing an 'and' based on data, restore final nodes by key
 		if (data) {
-			fooPtr<K,D> = keyCompair;
-			mergeSortCallerBase(IdxS1, 0, size - 1);
+			mergeSortCallerBase(IdxS1, 0, size - 1, compair<KEY>());
 		}
 
 			// If there are remaining nodes, place them into the new tree
@@ -1597,12 +1673,12 @@ inline rbTree<K,D> rbTree<K,D>::andBase(
  * parameters: 			A red-black tree and a function to copy over nodes
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-template <typename F>
-inline rbTree<K,D> rbTree<K,D>::andBaseI(
-										const rbTree<K,D> &rbt,
-										void (*foo)(rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&, rbtNode<K,D> **&),
-										F bar,
+template <typename K, typename D, typename C>
+template <typename F1, typename F2>
+inline rbTree<K,D,C> &rbTree<K,D,C>::andBaseI(
+										const rbTree<K,D,C> &rbt,
+										F1 foo,
+										F2 bar,
 										bool data
 										)
 {
@@ -1626,9 +1702,8 @@ inline rbTree<K,D> rbTree<K,D>::andBaseI(
 
 		// If we are doing an 'and' based on data, sort nodes by data
 	if (data) {
-		fooPtr<K,D> = dataCompair;
-		mergeSortCallerBase(IdxS1, 0, size - 1);
-		mergeSortCallerBase(IdxS2, 0, rbt.size - 1);
+		mergeSortCallerBase(IdxS1, 0, size - 1, compair<DATA>());
+		mergeSortCallerBase(IdxS2, 0, rbt.size - 1, compair<DATA>());
 	}
 
 		// Cycles through the entire node array
@@ -1639,7 +1714,7 @@ inline rbTree<K,D> rbTree<K,D>::andBaseI(
 
 		// Deletes any extra nodes
 	while(IdxS1 < IdxE1) {
-		delete *IdxS1;
+		freeNode(*IdxS1);
 		IdxS1++;
 	}
 
@@ -1653,8 +1728,7 @@ inline rbTree<K,D> rbTree<K,D>::andBaseI(
 	if (size) {
 			// If we are doing an 'and' based on data, restore final nodes by key
 		if (data) {
-			fooPtr<K,D> = keyCompair;
-			mergeSortCallerBase(IdxS1, 0, size - 1);
+			mergeSortCallerBase(IdxS1, 0, size - 1, compair<KEY>());
 		}
 
 		treeifyShallow(0, size - 1, IdxS1, &root);
@@ -1674,32 +1748,45 @@ inline rbTree<K,D> rbTree<K,D>::andBaseI(
  *						For nodes with the same key/data pair between both trees, include them. Else
  *						skip them. Each node, from one tree, may only be paired with one other
  *						from another tree
+ *						If this tree is the larger one, only the matching nodes are looked up and copied
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator&(const rbTree<K,D> &rbt) const {
-		// Calls the and template function
-	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
-			// Loops through both sections of the array
-		while(IdxS1 != IdxE1 && IdxS2 != IdxE2) {
-				// Checks if both considered nodes have equal key/data
-				// If so, save it and move forward in both arrays
-				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					*IdxM = *IdxS1;
-					IdxM++; IdxS1++; IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					IdxS1++;
-				else
-					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				IdxS1++;
-			else
-				IdxS2++;
-		}
-    }, &rbTree<K,D>::dummy);
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator&(const rbTree<K,D,C> &rbt) const {
+		// Ignores the trival case
+	if (!size || !rbt.size)
+		return rbTree<K,D,C>();
+
+		// If this tree is the smaller one, copies it and intersects the copy
+	if (size <= rbt.size) {
+		rbTree<K,D,C> rbtNew = *this;
+		rbtNew &= rbt;
+		return rbtNew;
+	}
+
+		// Else, only this tree's nodes that match the other tree's nodes are looked up, and copied
+	rbtNode<K,D> **rbtNodes, **IdxS, **IdxE, **IdxM, **runS;
+	IdxS = IdxM = rbtNodes = rbt.rbt_getAllNodes(); IdxE = IdxS + rbt.size;
+	while(IdxS != IdxE) {
+			// Finds the run of equal nodes in the other tree
+		runS = IdxS;
+		while(++IdxS != IdxE && keyDataEqual(*IdxS, *runS));
+
+			// Pairs each node in the run with one of this tree's equal nodes, in order
+		for(iterator it = rbt_lowerBound((*runS)->key, (*runS)->data); runS != IdxS && it != end() && keyDataEqual(&*it, *runS); ++it, ++runS)
+			*IdxM++ = &*it;
+	}
+
+		// Create a tree from the matched nodes
+	rbTree<K,D,C> rbtNew = rbTree<K,D,C>();
+	rbtNew.size = IdxM - rbtNodes;
+	if (rbtNew.size)
+		rbtNew.treeify(0, rbtNew.size - 1, rbtNodes, &rbtNew.root);
+
+		// Clears the accessed node array
+	delete [] rbtNodes;
+	return rbtNew;
 }
 					
 /*
@@ -1707,33 +1794,21 @@ rbTree<K,D> rbTree<K,D>::operator&(const rbTree<K,D> &rbt) const {
  *						For nodes with the same key/data pair between both trees, include them. Else
  *						skip them. Each node, from one tree, may only be paired with one other
  *						from another tree
+ *						Splits this tree around the other tree's runs and joins the kept pieces back. O(M*log(N/M + 1)),
+ *						for M nodes in the other tree and N nodes in this one, plus the dropped nodes. If this tree is
+ *						the smaller one, only the other tree's matching runs are looked up, in O(N*log(M))
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::operator&=(const rbTree<K,D> &rbt) {
-		// Calls the andI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
-			// Loops through both sections of the array
-		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
-				// Checks if both considered nodes have equal key/data
-				// If so, save it and move forward in both arrays
-				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
-					*IdxM = *IdxS1;
-					IdxM++; IdxS1++; IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data) {
-					delete *IdxS1;
-					IdxS1++;
-				} else
-					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key) {
-				delete *IdxS1;
-				IdxS1++;
-			} else
-				IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator&=(const rbTree<K,D,C> &rbt) {
+		// Ignores the trival case
+	if (&rbt == this)
+		return *this;
+
+		// Keeps as many of this tree's equal nodes as the other tree has, and drops unmatched nodes
+	mergeRunsI(rbt, false, false, andRunBase);
+	return *this;
 }
 
 /*
@@ -1741,8 +1816,8 @@ rbTree<K,D> rbTree<K,D>::operator&=(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_and(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_and(const rbTree<K,D,C> &rbt) const {
 	return (*this & rbt);
 }
 
@@ -1751,11 +1826,58 @@ inline rbTree<K,D> rbTree<K,D>::rbt_and(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree with compatible key and data to the current red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_andI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_andI(const rbTree<K,D,C> &rbt) {
 	return (*this &= rbt);
 }
 
+/*
+ * function_identifier: Intersects an expiring red-black tree into a new red-black tree
+ *						Reuses the expiring tree's nodes, so only the nodes needed from this tree are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::operator&(rbTree<K,D,C> &&rbt) const {
+	rbt &= *this;
+	return std::move(rbt);
+}
+
+/*
+ * function_identifier: Intersects an expiring red-black tree into the current tree
+ *						Keeps the nodes of whichever tree is larger, so only the smaller tree's nodes are copied
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::operator&=(rbTree<K,D,C> &&rbt) {
+		// Takes over the larger tree's nodes
+	if (rbt.size > size)
+		swapTree(rbt);
+
+	return *this &= rbt;
+}
+
+/*
+ * function_identifier: The alias for the & operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_and(rbTree<K,D,C> &&rbt) const {
+	return *this & std::move(rbt);
+}
+
+/*
+ * function_identifier: The alias for the &= operator, with an expiring red-black tree
+ * parameters: 			An expiring red-black tree with compatible key and data to the current red-black tree
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_andI(rbTree<K,D,C> &&rbt) {
+	return *this &= std::move(rbt);
+}
+
 /*
  * function_identifier: Takes all nodes from two rbTrees and process them into a new rbTree
  *						For nodes with the same key/data pair between both trees, include them. Else
@@ -1764,8 +1886,8 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the and template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1773,25 +1895,25 @@ rbTree<K,D> rbTree<K,D>::rbt_andLeast(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal key/data
 				// If so, save it and skip any following nodes similar key/data pairs
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Saves the first node
 					*IdxM++ = *IdxS1;
 
 						// Skips all following similar nodes
-					while(++IdxS2 < IdxE2 && (*IdxS2)->equal(*IdxS1));
+					while(++IdxS2 < IdxE2 && keyDataEqual(*IdxS2, *IdxS1));
 					IdxS2--;
-					while(++IdxS1 < IdxE1 && (*IdxS2)->equal(*IdxS1));
+					while(++IdxS1 < IdxE1 && keyDataEqual(*IdxS2, *IdxS1));
 					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					IdxS1++;
 				else
 					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -1802,35 +1924,35 @@ rbTree<K,D> rbTree<K,D>::rbt_andLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the andI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal key/data
 				// If so, save it and skip/delete any following nodes similar key/data pairs
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Saves the first node
 					*IdxM++ = *IdxS1;
 
 						// Skips/deletes all following similar nodes
-					while(++IdxS2 < IdxE2 && (*IdxS2)->equal(*IdxS1));
+					while(++IdxS2 < IdxE2 && keyDataEqual(*IdxS2, *IdxS1));
 					IdxS2--;
-					while(++IdxS1 < IdxE1 && (*IdxS2)->equal(*IdxS1))
-						delete *IdxS1;
+					while(++IdxS1 < IdxE1 && keyDataEqual(*IdxS2, *IdxS1))
+						freeNode(*IdxS1);
 					IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
-					delete *IdxS1++;
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
+					freeNode(*IdxS1++);
 				else
 					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				delete *IdxS1++;
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
+				freeNode(*IdxS1++);
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -1841,15 +1963,15 @@ rbTree<K,D> rbTree<K,D>::rbt_andLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the andMost template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				//
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Saves template information
 					K dupKey = (*IdxS1)->key; D dupData = (*IdxS1)->data;
 
@@ -1857,23 +1979,23 @@ rbTree<K,D> rbTree<K,D>::rbt_andMost(const rbTree<K,D> &rbt) const {
 					*IdxM++ = *IdxS1;
 
 						// Saves all following nodes so long as both nodes are the same as the template information
-					while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData)
+					while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0)
 						*IdxM++ = *IdxS1;
 						// Continues to save nodes in first tree if there are still yet unsaved nodes with similar information as the template information
-					while(IdxS1 < IdxE1 && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData)
+					while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0)
 						*IdxM++ = *IdxS1++;
 						// Continues to save nodes in second tree if there are still yet unsaved nodes with similar information as the template information
-					while(IdxS2 < IdxE2 && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData)
+					while(IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0)
 						*IdxM++ = *IdxS2++;
-				} else if ((*IdxS1)->data < (*IdxS2)->data)
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 					IdxS1++;
 				else
 					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy, false);
+    }, &rbTree<K,D,C>::dummy, false);
 }
 
 /*
@@ -1884,15 +2006,15 @@ rbTree<K,D> rbTree<K,D>::rbt_andMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the andMostI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				//
-			if ((*IdxS1)->key == (*IdxS2)->key) {
-				if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
+				if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 						// Saves template information
 					K dupKey = (*IdxS1)->key; D dupData = (*IdxS1)->data;
 
@@ -1900,25 +2022,25 @@ rbTree<K,D> rbTree<K,D>::rbt_andMostI(const rbTree<K,D> &rbt) {
 					*IdxM++ = *IdxS1;
 
 						// Saves all following nodes so long as both nodes are the same as the template information
-					while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData)
+					while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0)
 						*IdxM++ = *IdxS1;
 						// Continues to save nodes in first tree if there are still yet unsaved nodes with similar information as the template information
-					while(IdxS1 < IdxE1 && (*IdxS1)->key == dupKey && (*IdxS1)->data == dupData)
+					while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0 && C::data((*IdxS1)->data, dupData) == 0)
 						*IdxM++ = *IdxS1++;
 						// Continues to save nodes in second tree if there are still yet unsaved nodes with similar information as the template information
-					while(IdxS2 < IdxE2 && (*IdxS2)->key == dupKey && (*IdxS2)->data == dupData)
-						*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-				} else if ((*IdxS1)->data < (*IdxS2)->data) {
-					delete *IdxS1;
+					while(IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0 && C::data((*IdxS2)->data, dupData) == 0)
+						*IdxM++ = allocNode(*IdxS2++);
+				} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0) {
+					freeNode(*IdxS1);
 					IdxS1++;
 				} else
 					IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key) {
-				delete *IdxS1;
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0) {
+				freeNode(*IdxS1);
 				IdxS1++;
 			} else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy, false);
+    }, &rbTree<K,D,C>::dummy, false);
 }
 
 /*
@@ -1929,8 +2051,8 @@ rbTree<K,D> rbTree<K,D>::rbt_andMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_andKey(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_andKey(const rbTree<K,D,C> &rbt) const {
 		// Calls the and template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1938,15 +2060,15 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andKey(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, save it and move forward in both arrays
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				*IdxM = *IdxS1;
 				IdxM++; IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
 		}
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -1957,24 +2079,24 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andKey(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_andKeyI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_andKeyI(const rbTree<K,D,C> &rbt) {
 		// Calls the andI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it and move forward in both arrays
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 				*IdxM = *IdxS1;
 				IdxM++; IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key) {
-				delete *IdxS1;
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0) {
+				freeNode(*IdxS1);
 				IdxS1++;
 			} else
 				IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -1985,8 +2107,8 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andKeyI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andKeyLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andKeyLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the and template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -1994,20 +2116,20 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyLeast(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, save it and skip any following nodes similar keys
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Saves the first node
 				*IdxM++ = *IdxS1;
 
 					// Skips all following similar nodes
-				while(++IdxS2 < IdxE2 && (*IdxS2)->key == (*IdxS1)->key);
+				while(++IdxS2 < IdxE2 && C::key((*IdxS2)->key, (*IdxS1)->key) == 0);
 				IdxS2--;
-				while(++IdxS1 < IdxE1 && (*IdxS2)->key == (*IdxS1)->key);
+				while(++IdxS1 < IdxE1 && C::key((*IdxS2)->key, (*IdxS1)->key) == 0);
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -2018,30 +2140,30 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andKeyLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andKeyLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the andI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it and skip/delete any following nodes similar keys
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Saves the first node
 				*IdxM++ = *IdxS1;
 
 					// Skips/deletes all following similar nodes
-				while(++IdxS2 < IdxE2 && (*IdxS2)->key == (*IdxS1)->key);
+				while(++IdxS2 < IdxE2 && C::key((*IdxS2)->key, (*IdxS1)->key) == 0);
 				IdxS2--;
-				while(++IdxS1 < IdxE1 && (*IdxS2)->key == (*IdxS1)->key)
-					delete *IdxS1;
+				while(++IdxS1 < IdxE1 && C::key((*IdxS2)->key, (*IdxS1)->key) == 0)
+					freeNode(*IdxS1);
 				IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
-				delete *IdxS1++;
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
+				freeNode(*IdxS1++);
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -2052,8 +2174,8 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andKeyMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andKeyMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the andMost template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -2061,7 +2183,7 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal keys
 				// If so, save it and the most similar following nodes possible to find in either tree
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Saves template information
 				K dupKey = (*IdxS1)->key;
 
@@ -2069,19 +2191,19 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyMost(const rbTree<K,D> &rbt) const {
 				*IdxM++ = *IdxS1;
 
 					// Saves all following nodes so long as both nodes are the same as the template information
-				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS2)->key == dupKey)
+				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::key((*IdxS2)->key, dupKey) == 0)
 					*IdxM++ = *IdxS1;
 					// Continues to save nodes in first tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS1 < IdxE1 && (*IdxS1)->key == dupKey)
+				while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0)
 					*IdxM++ = *IdxS1++;
 					// Continues to save nodes in second tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS2 < IdxE2 && (*IdxS2)->key == dupKey)
+				while(IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0)
 					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->key < (*IdxS2)->key)
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy, false);
+    }, &rbTree<K,D,C>::dummy, false);
 }
 
 /*
@@ -2092,16 +2214,16 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andKeyMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andKeyMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the andMostI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal keys
 				// If so, save it and the most similar following nodes possible to find in either tree
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->key == (*IdxS2)->key) {
+			if (C::key((*IdxS1)->key, (*IdxS2)->key) == 0) {
 					// Saves template information
 				K dupKey = (*IdxS1)->key;
 
@@ -2109,20 +2231,20 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyMostI(const rbTree<K,D> &rbt) {
 				*IdxM++ = *IdxS1;
 
 					// Saves all following nodes so long as both nodes are the same as the template information
-				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->key == dupKey && (*IdxS2)->key == dupKey)
+				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::key((*IdxS1)->key, dupKey) == 0 && C::key((*IdxS2)->key, dupKey) == 0)
 					*IdxM++ = *IdxS1;
 					// Continues to save nodes in first tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS1 < IdxE1 && (*IdxS1)->key == dupKey)
+				while(IdxS1 < IdxE1 && C::key((*IdxS1)->key, dupKey) == 0)
 					*IdxM++ = *IdxS1++;
 					// Continues to save nodes in second tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS2 < IdxE2 && (*IdxS2)->key == dupKey)
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->key < (*IdxS2)->key) {
-				delete *IdxS1;
+				while(IdxS2 < IdxE2 && C::key((*IdxS2)->key, dupKey) == 0)
+					*IdxM++ = allocNode(*IdxS2++);
+			} else if (C::key((*IdxS1)->key, (*IdxS2)->key) < 0) {
+				freeNode(*IdxS1);
 				IdxS1++;
 			} else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy, false);
+    }, &rbTree<K,D,C>::dummy, false);
 }
 
 /*
@@ -2133,8 +2255,8 @@ rbTree<K,D> rbTree<K,D>::rbt_andKeyMostI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_andData(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> rbTree<K,D,C>::rbt_andData(const rbTree<K,D,C> &rbt) const {
 		// Calls the and template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -2142,15 +2264,15 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andData(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, save it and move forward in both arrays
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				*IdxM = *IdxS1;
 				IdxM++; IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
 		}
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -2161,24 +2283,24 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andData(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-inline rbTree<K,D> rbTree<K,D>::rbt_andDataI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+inline rbTree<K,D,C> &rbTree<K,D,C>::rbt_andDataI(const rbTree<K,D,C> &rbt) {
 		// Calls the andI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it and move forward in both arrays
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 				*IdxM = *IdxS1;
 				IdxM++; IdxS1++; IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data) {
-				delete *IdxS1;
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0) {
+				freeNode(*IdxS1);
 				IdxS1++;
 			} else
 				IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -2189,8 +2311,8 @@ inline rbTree<K,D> rbTree<K,D>::rbt_andDataI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andDataLeast(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andDataLeast(const rbTree<K,D,C> &rbt) const {
 		// Calls the and template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -2198,20 +2320,20 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataLeast(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, save it and skip any following nodes similar data
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Saves the first node
 				*IdxM++ = *IdxS1;
 
 					// Skips all following similar nodes
-				while(++IdxS2 < IdxE2 && (*IdxS2)->data == (*IdxS1)->data);
+				while(++IdxS2 < IdxE2 && C::data((*IdxS2)->data, (*IdxS1)->data) == 0);
 				IdxS2--;
-				while(++IdxS1 < IdxE1 && (*IdxS2)->data == (*IdxS1)->data);
+				while(++IdxS1 < IdxE1 && C::data((*IdxS2)->data, (*IdxS1)->data) == 0);
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy);
+    }, &rbTree<K,D,C>::dummy);
 }
 
 /*
@@ -2222,30 +2344,30 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataLeast(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andDataLeastI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andDataLeastI(const rbTree<K,D,C> &rbt) {
 		// Calls the andI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it and skip/delete any following nodes similar data
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Saves the first node
 				*IdxM++ = *IdxS1;
 
 					// Skips/deletes all following similar nodes
-				while(++IdxS2 < IdxE2 && (*IdxS2)->data == (*IdxS1)->data);
+				while(++IdxS2 < IdxE2 && C::data((*IdxS2)->data, (*IdxS1)->data) == 0);
 				IdxS2--;
-				while(++IdxS1 < IdxE1 && (*IdxS2)->data == (*IdxS1)->data)
-					delete *IdxS1;
+				while(++IdxS1 < IdxE1 && C::data((*IdxS2)->data, (*IdxS1)->data) == 0)
+					freeNode(*IdxS1);
 				IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
-				delete *IdxS1++;
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
+				freeNode(*IdxS1++);
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::rbt_removeDuplicates);
+    }, &rbTree<K,D,C>::rbt_removeDuplicates);
 }
 
 /*
@@ -2256,8 +2378,8 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataLeastI(const rbTree<K,D> &rbt) {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andDataMost(const rbTree<K,D> &rbt) const {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andDataMost(const rbTree<K,D,C> &rbt) const {
 		// Calls the andMost template function
 	return andBase(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
@@ -2265,7 +2387,7 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataMost(const rbTree<K,D> &rbt) const {
 				// Checks if both considered nodes have equal data
 				// If so, save it and the most similar following nodes possible to find in either tree
 				// If not, skip it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Saves template information
 				K dupData = (*IdxS1)->data;
 
@@ -2273,19 +2395,19 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataMost(const rbTree<K,D> &rbt) const {
 				*IdxM++ = *IdxS1;
 
 					// Saves all following nodes so long as both nodes are the same as the template information
-				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->data == dupData && (*IdxS2)->data == dupData)
+				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::data((*IdxS1)->data, dupData) == 0 && C::data((*IdxS2)->data, dupData) == 0)
 					*IdxM++ = *IdxS1;
 					// Continues to save nodes in first tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS1 < IdxE1 && (*IdxS1)->data == dupData)
+				while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, dupData) == 0)
 					*IdxM++ = *IdxS1++;
 					// Continues to save nodes in second tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS2 < IdxE2 && (*IdxS2)->data == dupData)
+				while(IdxS2 < IdxE2 && C::data((*IdxS2)->data, dupData) == 0)
 					*IdxM++ = *IdxS2++;
-			} else if ((*IdxS1)->data < (*IdxS2)->data)
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0)
 				IdxS1++;
 			else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy, false);
+    }, &rbTree<K,D,C>::dummy, false);
 }
 
 /*
@@ -2296,16 +2418,16 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataMost(const rbTree<K,D> &rbt) const {
  * parameters: 			A red-black tree
  * return value:		A red-black tree
 */
-template <typename K, typename D>
-rbTree<K,D> rbTree<K,D>::rbt_andDataMostI(const rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andDataMostI(const rbTree<K,D,C> &rbt) {
 		// Calls the andMostI template function
-	return andBaseI(rbt, [] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
+	return andBaseI(rbt, [this] (rbtNode<K,D> **&IdxS1, rbtNode<K,D> **&IdxS2, rbtNode<K,D> **&IdxE1, rbtNode<K,D> **&IdxE2, rbtNode<K,D> **&IdxM) -> void {
 			// Loops through both sections of the array
 		while(IdxS1 != IdxE1 && IdxS2 != IdxE2)
 				// Checks if both considered nodes have equal data
 				// If so, save it and the most similar following nodes possible to find in either tree
 				// If not, skip/delete it and move forward in one of the arrays
-			if ((*IdxS1)->data == (*IdxS2)->data) {
+			if (C::data((*IdxS1)->data, (*IdxS2)->data) == 0) {
 					// Saves template information
 				K dupData = (*IdxS1)->data;
 
@@ -2313,20 +2435,123 @@ rbTree<K,D> rbTree<K,D>::rbt_andDataMostI(const rbTree<K,D> &rbt) {
 				*IdxM++ = *IdxS1;
 
 					// Saves all following nodes so long as both nodes are the same as the template information
-				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && (*IdxS1)->data == dupData && (*IdxS2)->data == dupData)
+				while(((++IdxS1 < IdxE1) & (++IdxS2 < IdxE2)) && C::data((*IdxS1)->data, dupData) == 0 && C::data((*IdxS2)->data, dupData) == 0)
 					*IdxM++ = *IdxS1;
 					// Continues to save nodes in first tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS1 < IdxE1 && (*IdxS1)->data == dupData)
+				while(IdxS1 < IdxE1 && C::data((*IdxS1)->data, dupData) == 0)
 					*IdxM++ = *IdxS1++;
 					// Continues to save nodes in second tree if there are still yet unsaved nodes with similar information as the template information
-				while(IdxS2 < IdxE2 && (*IdxS2)->data == dupData)
-					*IdxM++ = new rbtNode<K,D>(*IdxS2++);
-			} else if ((*IdxS1)->data < (*IdxS2)->data) {
-				delete *IdxS1;
+				while(IdxS2 < IdxE2 && C::data((*IdxS2)->data, dupData) == 0)
+					*IdxM++ = allocNode(*IdxS2++);
+			} else if (C::data((*IdxS1)->data, (*IdxS2)->data) < 0) {
+				freeNode(*IdxS1);
 				IdxS1++;
 			} else
 				IdxS2++;
-    }, &rbTree<K,D>::dummy, false);
+    }, &rbTree<K,D,C>::dummy, false);
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                          PARALLEL SET OPERATIONS                           | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: The | operator, with both trees cut into even parts, and each part merged on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_orParallel(const rbTree<K,D,C> &rbt, size_t threads) const {
+		// Copies this tree, and merges the other tree into the copy
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew.rbt_orParallelI(rbt, threads);
+	return rbtNew;
+}
+
+/*
+ * function_identifier: The |= operator, with both trees cut into even parts, and each part merged on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_orParallelI(const rbTree<K,D,C> &rbt, size_t threads) {
+		// Ignores the trival case
+	if (&rbt == this)
+		return *this;
+
+	mergeRunsI(rbt, true, true, orRunBase, threads ? threads : std::thread::hardware_concurrency());
+	return *this;
+}
+
+/*
+ * function_identifier: The ^ operator, with both trees cut into even parts, and each part merged on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_xorParallel(const rbTree<K,D,C> &rbt, size_t threads) const {
+		// Copies this tree, and merges the other tree into the copy
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew.rbt_xorParallelI(rbt, threads);
+	return rbtNew;
+}
+
+/*
+ * function_identifier: The ^= operator, with both trees cut into even parts, and each part merged on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_xorParallelI(const rbTree<K,D,C> &rbt, size_t threads) {
+		// Ignores the trival case
+	if (&rbt == this) {
+		rbt_clear();
+		return *this;
+	}
+
+		// Uses the ^= operator when the trees will not be merged in parts, as its array merge is faster on one thread
+	threads = threads ? threads : std::thread::hardware_concurrency();
+	if (threads <= 1 || size + rbt.size < RBT_PARALLEL_CUTOFF)
+		return *this ^= rbt;
+
+	mergeRunsI(rbt, true, true, xorRunBase, threads);
+	return *this;
+}
+
+/*
+ * function_identifier: The & operator, with both trees cut into even parts, and each part merged on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		A red-black tree
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbTree<K,D,C>::rbt_andParallel(const rbTree<K,D,C> &rbt, size_t threads) const {
+		// Copies this tree, and intersects the copy with the other tree
+	rbTree<K,D,C> rbtNew = *this;
+	rbtNew.rbt_andParallelI(rbt, threads);
+	return rbtNew;
+}
+
+/*
+ * function_identifier: The &= operator, with both trees cut into even parts, and each part merged on its own thread
+ * parameters: 			A red-black tree with compatible key and data to the current red-black tree, and the number of
+ *						threads to use (or 0, for every hardware thread)
+ * return value:		This object
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> &rbTree<K,D,C>::rbt_andParallelI(const rbTree<K,D,C> &rbt, size_t threads) {
+		// Ignores the trival case
+	if (&rbt == this)
+		return *this;
+
+	mergeRunsI(rbt, false, false, andRunBase, threads ? threads : std::thread::hardware_concurrency());
+	return *this;
 }
 
 #endif /* _rbt_SET_OPERATIONS */
\ No newline at end of file
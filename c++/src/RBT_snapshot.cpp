@@ -0,0 +1,688 @@
+#ifndef _rbt_SNAPSHOT
+#define _rbt_SNAPSHOT
+#include	"RBT_main.h"
+#include	"RBT_snapshot.h"
+
+/*==============================================================================\
+ | Program:		Key-Data Red-Black Tree Implementation							|
+ | AUTHOR:		Xavier Alvarez 													|
+ | CREATE DATE:	15-January-2023 												|
+ | COPYRIGHT:	apache-2.0														|
+ | VERSION:		1.0																|
+ | DESCRIPTION:	A red-black semi-balanced binary search tree. Provides a		|
+ |				multitude of useful functions, including O(log(N)) lookup,		|
+ |				insert and delete operations.									|
+ \=============================================================================*/
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              CONSTRUCTORS                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Constructs an empty snapshot red-black tree
+ * parameters: 			The number of reader slots (the most readers that can be inside the tree at once)
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtSnapshotTree<K,D,C>::rbtSnapshotTree(size_t readers) : root(NULL), epoch(1), slotCount(readers ? readers : 1) {
+	slots.reset(new rbtEpochSlot[slotCount]);
+	for(size_t i = 0; i < slotCount; i++)
+		slots[i].epoch.store(0, std::memory_order_relaxed);
+}
+
+/*
+ * function_identifier: Destructs the snapshot red-black tree, and every retired node
+ *						No reader may still be inside the tree
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtSnapshotTree<K,D,C>::~rbtSnapshotTree() {
+	destroy(root.load(std::memory_order_relaxed));
+	for(auto &node : retired)
+		delete node.second;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                            EPOCH RECLAMATION                               | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Enters the tree as a reader, by announcing the current epoch in a free reader slot
+ *						Each thread keeps going back to the same slot, so slots do not bounce between threads
+ * parameters: 			N/A
+ * return value:		The index of the claimed reader slot
+*/
+template <typename K, typename D, typename C>
+size_t rbtSnapshotTree<K,D,C>::enter() const {
+	static thread_local size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+		// Claims the first free slot, starting from this thread's last one
+	for(size_t i = hint;; i++) {
+		std::atomic<uint64_t> &slot = slots[i % slotCount].epoch;
+		uint64_t expected = 0;
+		if (!slot.load(std::memory_order_relaxed) && slot.compare_exchange_strong(expected, epoch.load())) {
+			hint = i % slotCount;
+			return hint;
+		}
+	}
+}
+
+/*
+ * function_identifier: Leaves the tree as a reader, freeing the reader slot
+ * parameters: 			The index of the reader slot
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtSnapshotTree<K,D,C>::leave(size_t slot) const {
+	slots[slot].epoch.store(0, std::memory_order_release);
+}
+
+/*
+ * function_identifier: Enters the tree for the lifetime of the guard
+ * parameters: 			The snapshot tree to enter
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtSnapshotTree<K,D,C>::rbtEpochGuard::rbtEpochGuard(const rbtSnapshotTree<K,D,C> *tree) : owner(tree), slot(tree->enter()) {}
+
+/*
+ * function_identifier: Leaves the tree
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+rbtSnapshotTree<K,D,C>::rbtEpochGuard::~rbtEpochGuard() {
+	owner->leave(slot);
+}
+
+/*
+ * function_identifier: Publishes a new version of the tree, and retires the nodes it replaced
+ *						Must be called while holding the write lock
+ * parameters: 			The root of the new version
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtSnapshotTree<K,D,C>::publish(rbtSnapNode *newRoot) {
+		// Readers that enter from now on see the new version
+	root.store(newRoot);
+
+		// Readers that entered up to this epoch may still see the replaced nodes
+	uint64_t retiredAt = epoch.fetch_add(1);
+	for(rbtSnapNode *node : garbage)
+		retired.emplace_back(retiredAt, node);
+	garbage.clear();
+
+	reclaim();
+}
+
+/*
+ * function_identifier: Frees every retired node that no reader can still see
+ *						Must be called while holding the write lock
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtSnapshotTree<K,D,C>::reclaim() {
+		// Finds the oldest epoch any reader is still in
+	uint64_t oldest = UINT64_MAX;
+	for(size_t i = 0; i < slotCount; i++) {
+		uint64_t announced = slots[i].epoch.load();
+		if (announced && announced < oldest)
+			oldest = announced;
+	}
+
+		// Frees everything retired before it (retired is ordered by epoch)
+	auto curr = retired.begin();
+	for(; curr != retired.end() && curr->first < oldest; curr++)
+		delete curr->second;
+	retired.erase(retired.begin(), curr);
+}
+
+/*
+ * function_identifier: Frees a whole (unpublished or unreachable) subtree
+ * parameters: 			The root of the subtree
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtSnapshotTree<K,D,C>::destroy(rbtSnapNode *curr) {
+	if (!curr)
+		return;
+	destroy(curr->left);
+	destroy(curr->right);
+	delete curr;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                              PATH COPYING                                  | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Returns the number of nodes in a subtree
+ * parameters: 			The root of the subtree
+ * return value:		The size of the subtree
+*/
+template <typename K, typename D, typename C>
+inline size_t rbtSnapshotTree<K,D,C>::count(const rbtSnapNode *curr) {
+	return curr ? curr->descendants + 1 : 0;
+}
+
+/*
+ * function_identifier: Checks if a node is red
+ * parameters: 			The node to check
+ * return value:		True if the node exists and is red
+*/
+template <typename K, typename D, typename C>
+inline bool rbtSnapshotTree<K,D,C>::isRed(const rbtSnapNode *curr) {
+	return curr && curr->color;
+}
+
+/*
+ * function_identifier: Checks if a node is black
+ * parameters: 			The node to check
+ * return value:		True if the node exists and is black
+*/
+template <typename K, typename D, typename C>
+inline bool rbtSnapshotTree<K,D,C>::isBlack(const rbtSnapNode *curr) {
+	return curr && !curr->color;
+}
+
+/*
+ * function_identifier: Allocates a new node of the next version
+ * parameters: 			The color, left subtree, key, data and right subtree of the new node
+ * return value:		The new node
+*/
+template <typename K, typename D, typename C>
+inline typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::make(bool color, rbtSnapNode *left, const K &key, const D &data, rbtSnapNode *right) {
+	return new rbtSnapNode{left, right, key, data, count(left) + count(right), color};
+}
+
+/*
+ * function_identifier: Marks a node as replaced in the next version. It is freed once no reader can see it
+ *						The node's values may still be read until the next version is published
+ * parameters: 			The replaced node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+inline void rbtSnapshotTree<K,D,C>::retire(rbtSnapNode *curr) {
+	garbage.push_back(curr);
+}
+
+/*
+ * function_identifier: Rebuilds a black node, fixing a red node with a red child directly below it
+ * parameters: 			The left subtree, key, data and right subtree of the node
+ * return value:		The rebuilt subtree
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::balance(rbtSnapNode *left, const K &key, const D &data, rbtSnapNode *right) {
+	if (isRed(left) && isRed(right)) {
+		retire(left);
+		retire(right);
+		return make(true, make(false, left->left, left->key, left->data, left->right), key, data,
+					make(false, right->left, right->key, right->data, right->right));
+	}
+
+	if (isRed(left) && isRed(left->left)) {
+		rbtSnapNode *lower = left->left;
+		retire(left);
+		retire(lower);
+		return make(true, make(false, lower->left, lower->key, lower->data, lower->right), left->key, left->data,
+					make(false, left->right, key, data, right));
+	}
+
+	if (isRed(left) && isRed(left->right)) {
+		rbtSnapNode *lower = left->right;
+		retire(left);
+		retire(lower);
+		return make(true, make(false, left->left, left->key, left->data, lower->left), lower->key, lower->data,
+					make(false, lower->right, key, data, right));
+	}
+
+	if (isRed(right) && isRed(right->right)) {
+		rbtSnapNode *lower = right->right;
+		retire(right);
+		retire(lower);
+		return make(true, make(false, left, key, data, right->left), right->key, right->data,
+					make(false, lower->left, lower->key, lower->data, lower->right));
+	}
+
+	if (isRed(right) && isRed(right->left)) {
+		rbtSnapNode *lower = right->left;
+		retire(right);
+		retire(lower);
+		return make(true, make(false, left, key, data, lower->left), lower->key, lower->data,
+					make(false, lower->right, right->key, right->data, right->right));
+	}
+
+	return make(false, left, key, data, right);
+}
+
+/*
+ * function_identifier: Rebuilds a node whose left subtree lost a black level in a delete
+ * parameters: 			The (shortened) left subtree, key, data and right subtree of the node
+ * return value:		The rebuilt subtree
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::balanceLeft(rbtSnapNode *left, const K &key, const D &data, rbtSnapNode *right) {
+		// Restores the lost level by blackening the left subtree
+	if (isRed(left)) {
+		retire(left);
+		return make(true, make(false, left->left, left->key, left->data, left->right), key, data, right);
+	}
+
+		// Otherwise, shortens the right subtree to match
+	if (isBlack(right))
+		return balance(left, key, data, redden(right));
+
+		// Otherwise, the right subtree is red with a black left child
+	rbtSnapNode *lower = right->left;
+	retire(right);
+	retire(lower);
+	return make(true, make(false, left, key, data, lower->left), lower->key, lower->data,
+				balance(lower->right, right->key, right->data, redden(right->right)));
+}
+
+/*
+ * function_identifier: Rebuilds a node whose right subtree lost a black level in a delete
+ * parameters: 			The left subtree, key, data and (shortened) right subtree of the node
+ * return value:		The rebuilt subtree
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::balanceRight(rbtSnapNode *left, const K &key, const D &data, rbtSnapNode *right) {
+		// Restores the lost level by blackening the right subtree
+	if (isRed(right)) {
+		retire(right);
+		return make(true, left, key, data, make(false, right->left, right->key, right->data, right->right));
+	}
+
+		// Otherwise, shortens the left subtree to match
+	if (isBlack(left))
+		return balance(redden(left), key, data, right);
+
+		// Otherwise, the left subtree is red with a black right child
+	rbtSnapNode *lower = left->right;
+	retire(left);
+	retire(lower);
+	return make(true, balance(redden(left->left), left->key, left->data, lower->left), lower->key, lower->data,
+				make(false, lower->right, key, data, right));
+}
+
+/*
+ * function_identifier: Copies a black node as red
+ * parameters: 			The black node
+ * return value:		The red copy
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::redden(rbtSnapNode *curr) {
+	retire(curr);
+	return make(true, curr->left, curr->key, curr->data, curr->right);
+}
+
+/*
+ * function_identifier: Copies a red root as black (black roots are kept as is)
+ * parameters: 			The root of the next version
+ * return value:		The black root
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::blacken(rbtSnapNode *curr) {
+	if (!isRed(curr))
+		return curr;
+
+	retire(curr);
+	return make(false, curr->left, curr->key, curr->data, curr->right);
+}
+
+/*
+ * function_identifier: Joins the two subtrees of a deleted node into one
+ * parameters: 			The left and right subtrees of the deleted node
+ * return value:		The joined subtree
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::append(rbtSnapNode *left, rbtSnapNode *right) {
+	if (!left)
+		return right;
+	if (!right)
+		return left;
+
+		// Joins two red or two black subtrees through their inner children
+	if (left->color == right->color) {
+		rbtSnapNode *inner = append(left->right, right->left);
+		bool color = left->color;
+		retire(left);
+		retire(right);
+
+			// Lifts a red inner join above both subtrees
+		if (isRed(inner)) {
+			retire(inner);
+			return make(true, make(color, left->left, left->key, left->data, inner->left), inner->key, inner->data,
+						make(color, inner->right, right->key, right->data, right->right));
+		}
+
+		if (color)
+			return make(true, left->left, left->key, left->data, make(true, inner, right->key, right->data, right->right));
+		return balanceLeft(left->left, left->key, left->data, make(false, inner, right->key, right->data, right->right));
+	}
+
+		// Otherwise, pushes the join below the red subtree
+	if (right->color) {
+		retire(right);
+		return make(true, append(left, right->left), right->key, right->data, right->right);
+	}
+	retire(left);
+	return make(true, left->left, left->key, left->data, append(left->right, right));
+}
+
+/*
+ * function_identifier: Copies the search path of a new node, rebalancing on the way back up
+ *						Equal nodes are placed to the right, so duplicates are kept
+ * parameters: 			The root of the subtree, and the key and data of the new node
+ * return value:		The new subtree
+*/
+template <typename K, typename D, typename C>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::insertBase(rbtSnapNode *curr, const K &key, const D &data) {
+	if (!curr)
+		return make(true, NULL, key, data, NULL);
+
+	retire(curr);
+	int cmp = C::key(key, curr->key);
+	bool goLeft = cmp < 0 || (!cmp && C::data(data, curr->data) < 0);
+
+	if (!curr->color)
+		return goLeft ? balance(insertBase(curr->left, key, data), curr->key, curr->data, curr->right)
+					  : balance(curr->left, curr->key, curr->data, insertBase(curr->right, key, data));
+	return goLeft ? make(true, insertBase(curr->left, key, data), curr->key, curr->data, curr->right)
+				  : make(true, curr->left, curr->key, curr->data, insertBase(curr->right, key, data));
+}
+
+/*
+ * function_identifier: Copies the search path of a node being deleted, rebalancing on the way back up
+ *						The node must be in the subtree
+ * parameters: 			The root of the subtree, and a function that compares the searched values with a node
+ *						(negative if they are to its left, positive if to its right, and 0 on a match)
+ * return value:		The new subtree
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::deleteBase(rbtSnapNode *curr, F compare) {
+	if (!curr)
+		return NULL;
+
+	retire(curr);
+	int direction = compare(curr);
+
+	if (direction < 0)
+		return isBlack(curr->left) ? balanceLeft(deleteBase(curr->left, compare), curr->key, curr->data, curr->right)
+								   : make(true, deleteBase(curr->left, compare), curr->key, curr->data, curr->right);
+	if (direction > 0)
+		return isBlack(curr->right) ? balanceRight(curr->left, curr->key, curr->data, deleteBase(curr->right, compare))
+									: make(true, curr->left, curr->key, curr->data, deleteBase(curr->right, compare));
+	return append(curr->left, curr->right);
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                           LOCK-FREE OPERATIONS                             | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Finds a node in a subtree
+ * parameters: 			The root of the subtree, and a function that compares the searched values with a node
+ * return value:		The found node, or NULL
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+const typename rbtSnapshotTree<K,D,C>::rbtSnapNode *rbtSnapshotTree<K,D,C>::find(const rbtSnapNode *curr, F compare) {
+	while(curr) {
+		int direction = compare(curr);
+		if (!direction)
+			break;
+		curr = direction < 0 ? curr->left : curr->right;
+	}
+
+	return curr;
+}
+
+/*
+ * function_identifier: Calls a function on every node of a subtree with a key in the given range, in order
+ * parameters: 			The root of the subtree, the lowest and highest keys, and the function
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+void rbtSnapshotTree<K,D,C>::rangeBase(const rbtSnapNode *curr, const K &low, const K &high, F &foo) {
+	if (!curr)
+		return;
+
+	bool aboveLow = C::key(curr->key, low) >= 0, belowHigh = C::key(high, curr->key) >= 0;
+	if (aboveLow)
+		rangeBase(curr->left, low, high, foo);
+	if (aboveLow && belowHigh)
+		foo(curr->key, curr->data);
+	if (belowHigh)
+		rangeBase(curr->right, low, high, foo);
+}
+
+/*
+ * function_identifier: Returns the number of nodes in the current version
+ * parameters: 			N/A
+ * return value:		The size of the red-black tree
+*/
+template <typename K, typename D, typename C>
+size_t rbtSnapshotTree<K,D,C>::rbt_getSize() const {
+	rbtEpochGuard guard(this);
+	return count(root.load());
+}
+
+/*
+ * function_identifier: Finds a node with the given key and copies out its data
+ * parameters: 			The key to search for and a data value to write the result into (return by reference)
+ * return value:		True if a node with the given key was found
+*/
+template <typename K, typename D, typename C>
+bool rbtSnapshotTree<K,D,C>::rbt_searchKey(K key, D &data) const {
+	rbtEpochGuard guard(this);
+
+	const rbtSnapNode *curr = find(root.load(), [&key] (const rbtSnapNode *node) -> int {
+		return C::key(key, node->key);
+	});
+	if (!curr)
+		return false;
+
+	data = curr->data;
+	return true;
+}
+
+/*
+ * function_identifier: Checks if a node with the given key and data exists
+ * parameters: 			The key and data values to search for
+ * return value:		True if such a node was found
+*/
+template <typename K, typename D, typename C>
+bool rbtSnapshotTree<K,D,C>::rbt_search(K key, D data) const {
+	rbtEpochGuard guard(this);
+
+	return find(root.load(), [&key, &data] (const rbtSnapNode *node) -> int {
+		int cmp = C::key(key, node->key);
+		return cmp ? cmp : C::data(data, node->data);
+	}) != NULL;
+}
+
+/*
+ * function_identifier: Copies out the key and data of the node at the given index
+ * parameters: 			The index to look up and a key and data value to write the result into (return by reference)
+ * return value:		True if the index was in the red-black tree
+*/
+template <typename K, typename D, typename C>
+bool rbtSnapshotTree<K,D,C>::rbt_nodeAt(size_t idx, K &key, D &data) const {
+	rbtEpochGuard guard(this);
+
+	const rbtSnapNode *curr = root.load();
+	if (idx >= count(curr))
+		return false;
+
+		// Walks down by subtree sizes
+	while(idx != count(curr->left)) {
+		if (idx < count(curr->left))
+			curr = curr->left;
+		else {
+			idx -= count(curr->left) + 1;
+			curr = curr->right;
+		}
+	}
+
+	key = curr->key;
+	data = curr->data;
+	return true;
+}
+
+/*
+ * function_identifier: Calls a function, in order, on every node with a key in the given range
+ *						All calls see the same version of the tree, even while writers publish new ones
+ * parameters: 			The lowest and highest keys, and a function that takes a const key and data
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+template <typename F>
+void rbtSnapshotTree<K,D,C>::rbt_forRange(K low, K high, F foo) const {
+	rbtEpochGuard guard(this);
+	rangeBase(root.load(), low, high, foo);
+}
+
+/*
+ * function_identifier: Returns a copy of the current version, as a red-black tree
+ * parameters: 			N/A
+ * return value:		A red-black tree with every node of the current version
+*/
+template <typename K, typename D, typename C>
+rbTree<K,D,C> rbtSnapshotTree<K,D,C>::rbt_snapshot() const {
+	rbtEpochGuard guard(this);
+	const rbtSnapNode *curr = root.load();
+
+		// Copies out the values, in order
+	size_t size = count(curr), i = 0;
+	K *keys = new K[size];
+	D *data = new D[size];
+	std::vector<const rbtSnapNode *> path;
+	while(curr || !path.empty()) {
+		for(; curr; curr = curr->left)
+			path.push_back(curr);
+		curr = path.back();
+		path.pop_back();
+		keys[i] = curr->key;
+		data[i++] = curr->data;
+		curr = curr->right;
+	}
+
+	rbTree<K,D,C> rbt;
+	rbt.rbt_repInsert(size, keys, data);
+
+		// Clears the value arrays
+	delete [] keys;
+	delete [] data;
+	return rbt;
+}
+
+/*	============================================================================  */
+/* |                                                                            | */
+/* |                          SERIALIZED OPERATIONS                             | */
+/* |                                                                            | */
+/*	============================================================================  */
+
+/*
+ * function_identifier: Inserts a node into a new version of the red-black tree
+ * parameters: 			The key and data values of the new node
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtSnapshotTree<K,D,C>::rbt_insert(K key, D data) {
+	std::lock_guard<std::mutex> serialized(writeLock);
+	publish(blacken(insertBase(root.load(std::memory_order_relaxed), key, data)));
+}
+
+/*
+ * function_identifier: Deletes a node, with the given key and data, from a new version of the red-black tree
+ * parameters: 			The key and data values to delete
+ * return value:		True if such a node was found and deleted
+*/
+template <typename K, typename D, typename C>
+bool rbtSnapshotTree<K,D,C>::rbt_delete(K key, D data) {
+	std::lock_guard<std::mutex> serialized(writeLock);
+	auto compare = [&key, &data] (const rbtSnapNode *node) -> int {
+		int cmp = C::key(key, node->key);
+		return cmp ? cmp : C::data(data, node->data);
+	};
+
+		// Leaves the current version alone if there is nothing to delete
+	rbtSnapNode *curr = root.load(std::memory_order_relaxed);
+	if (!find(curr, compare))
+		return false;
+
+	publish(blacken(deleteBase(curr, compare)));
+	return true;
+}
+
+/*
+ * function_identifier: Deletes a node, with the given key, from a new version of the red-black tree
+ * parameters: 			The key to delete
+ * return value:		True if such a node was found and deleted
+*/
+template <typename K, typename D, typename C>
+bool rbtSnapshotTree<K,D,C>::rbt_deleteKey(K key) {
+	std::lock_guard<std::mutex> serialized(writeLock);
+	auto compare = [&key] (const rbtSnapNode *node) -> int {
+		return C::key(key, node->key);
+	};
+
+		// Leaves the current version alone if there is nothing to delete
+	rbtSnapNode *curr = root.load(std::memory_order_relaxed);
+	if (!find(curr, compare))
+		return false;
+
+	publish(blacken(deleteBase(curr, compare)));
+	return true;
+}
+
+/*
+ * function_identifier: Publishes an empty version of the red-black tree
+ * parameters: 			N/A
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbtSnapshotTree<K,D,C>::rbt_clear() {
+	std::lock_guard<std::mutex> serialized(writeLock);
+
+		// Retires every node of the current version
+	std::vector<rbtSnapNode *> path(1, root.load(std::memory_order_relaxed));
+	while(!path.empty()) {
+		rbtSnapNode *curr = path.back();
+		path.pop_back();
+		if (!curr)
+			continue;
+		retire(curr);
+		path.push_back(curr->left);
+		path.push_back(curr->right);
+	}
+
+	publish(NULL);
+}
+
+/*
+ * function_identifier: Frees what it can, and returns the number of retired nodes still waiting on readers
+ * parameters: 			N/A
+ * return value:		The number of retired but not yet freed nodes
+*/
+template <typename K, typename D, typename C>
+size_t rbtSnapshotTree<K,D,C>::rbt_getRetired() {
+	std::lock_guard<std::mutex> serialized(writeLock);
+	reclaim();
+	return retired.size();
+}
+
+#endif /* _rbt_SNAPSHOT */
\ No newline at end of file
@@ -13,12 +13,6 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-	template <typename K, typename D>
-	inline bool(*fooPtr)(rbtNode<K,D> *, rbtNode<K,D> *);
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                                QUICK SORT                                  | */
@@ -41,11 +35,12 @@ namespace {
 	/*
 	 * function_identifier: The partition step of quickSortPair(). Ensures to keep the values in both arrays in
 	 *						the same relative order
-	 * parameters: 			Two arrays of same length, as well as the start and end indexes that should be considered in the lists
+	 * parameters: 			Two arrays of same length, the start and end indexes that should be considered in the lists, and
+	 *						a function that checks if one value of the first array can go before another
 	 * return value:		The partition index
 	*/
-	template <typename T, typename U>
-	inline size_t partitionPair(T *type1, U *type2, size_t st, size_t ed) {
+	template <typename T, typename U, typename F>
+	inline size_t partitionPair(T *type1, U *type2, size_t st, size_t ed, F foo) {
 			// Sets up the pivot
 		T pivot = *(type1 + ed), *temp;
 		size_t i = st;
@@ -53,7 +48,7 @@ namespace {
 			// Loops through the array and sorts
 		for(size_t j = st; j < ed; j++) {
 			temp = type1 + j;
-			if(*temp <= pivot) {
+			if(foo(*temp, pivot)) {
 				swap((type1 + i), temp);
 				swap((type2 + i), (type2 + j));
 				i++;
@@ -68,31 +63,34 @@ namespace {
 
 	/*
 	 * function_identifier: Sorts two array, while preserving their relative order, in ascending order, via the quick sort algorithm
-	 * parameters: 			Two arrays of same length, as well as the start and end indexes that should be considered in the lists
+	 * parameters: 			Two arrays of same length, the start and end indexes that should be considered in the lists, and
+	 *						a function that checks if one value of the first array can go before another
 	 * return value:		N/A
 	*/
-	template <typename T, typename U>
-	inline void quickSortPair(T *type1, U *type2, size_t st, size_t ed) {
+	template <typename T, typename U, typename F>
+	inline void quickSortPair(T *type1, U *type2, size_t st, size_t ed, F foo) {
 		if(st < ed) {
-			size_t p = partitionPair(type1, type2, st, ed);
-			quickSortPair(type1, type2, st, p - 1);
-			quickSortPair(type1, type2, p + 1, ed);
+			size_t p = partitionPair(type1, type2, st, ed, foo);
+				// The index is unsigned, so the lower part is skipped when the pivot lands first
+			if (p > st)
+				quickSortPair(type1, type2, st, p - 1, foo);
+			quickSortPair(type1, type2, p + 1, ed, foo);
 		}
 	}
 
 	/*
 	 * function_identifier: The partition step of quickSort().
-	 * parameters: 			The start and end pointers of a singular array
+	 * parameters: 			The start and end pointers of a singular array, and a function that checks if one value can go before another
 	 * return value:		The partition pointer
 	*/
-	template <typename T>
-	inline T *partition(T *st, T *ed) {
+	template <typename T, typename F>
+	inline T *partition(T *st, T *ed, F foo) {
 			// Sets up the pivot
 		T pivot = *ed, *mi = st;
 
 			// Loops through the array and sorts
 		while(st != ed) {
-			if(*st <= pivot)
+			if(foo(*st, pivot))
 				swap(mi++, st);
 			st++;
 		}
@@ -104,15 +102,15 @@ namespace {
 
 	/*
 	 * function_identifier: Sorts an array in ascending order, via the quick sort algorithm
-	 * parameters: 			The start and end pointers of a singular array
+	 * parameters: 			The start and end pointers of a singular array, and a function that checks if one value can go before another
 	 * return value:		N/A
 	*/
-	template <typename T>
-	inline void quickSort(T *st, T *ed) {
+	template <typename T, typename F>
+	inline void quickSort(T *st, T *ed, F foo) {
 		if(st < ed) {
-			T *p = partition(st, ed);
-			quickSort(st, p - 1);
-			quickSort(p + 1, ed);
+			T *p = partition(st, ed, foo);
+			quickSort(st, p - 1, foo);
+			quickSort(p + 1, ed, foo);
 		}
 	}
 }
@@ -128,9 +126,9 @@ namespace {
  * parameters: 			Two node pointers
  * return value:		A boolean (True only if the first node has key less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::keyCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return (IdxS->key < IdxM->key);
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::keyCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	return (C::key(IdxS->key, IdxM->key) < 0);
 }
 
 /*
@@ -138,9 +136,9 @@ bool rbTree<K,D>::keyCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * parameters: 			Two node pointers
  * return value:		A boolean (True only if the first node has key less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::keyCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return (IdxS->key > IdxM->key);
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::keyCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	return (C::key(IdxS->key, IdxM->key) > 0);
 }
 
 /*
@@ -148,9 +146,9 @@ bool rbTree<K,D>::keyCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * parameters: 			Two node pointers
  * return value:		A boolean (True only if the first node has data less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::dataCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return (IdxS->data < IdxM->data);
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::dataCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	return (C::data(IdxS->data, IdxM->data) < 0);
 }
 
 /*
@@ -158,9 +156,9 @@ bool rbTree<K,D>::dataCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * parameters: 			Two node pointers
  * return value:		A boolean (True only if the first node has data less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::dataCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return (IdxS->data > IdxM->data);
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::dataCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	return (C::data(IdxS->data, IdxM->data) > 0);
 }
 
 /*
@@ -169,9 +167,10 @@ bool rbTree<K,D>::dataCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * return value:		A boolean (True only if the first node has key less than second node or if nodes have equal keys and
  *						first node has data less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::keyDataCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return ((IdxS->key < IdxM->key) || ((IdxS->key == IdxM->key) && (IdxS->data < IdxM->data)));
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::keyDataCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	int cmp = C::key(IdxS->key, IdxM->key);
+	return (cmp < 0 || (!cmp && C::data(IdxS->data, IdxM->data) < 0));
 }
 
 /*
@@ -180,9 +179,10 @@ bool rbTree<K,D>::keyDataCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * return value:		A boolean (True only if the first node has key less than second node or if nodes have equal keys and
  *						first node has data less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::keyDataCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return ((IdxS->key > IdxM->key) || ((IdxS->key == IdxM->key) && (IdxS->data > IdxM->data)));
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::keyDataCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	int cmp = C::key(IdxS->key, IdxM->key);
+	return (cmp > 0 || (!cmp && C::data(IdxS->data, IdxM->data) > 0));
 }
 
 /*
@@ -191,9 +191,10 @@ bool rbTree<K,D>::keyDataCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * return value:		A boolean (True only if the first node has data less than second node or if nodes have equal data and
  *						first node has key less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::dataKeyCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return ((IdxS->data < IdxM->data) || ((IdxS->data == IdxM->data) && (IdxS->key < IdxM->key)));
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::dataKeyCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	int cmp = C::data(IdxS->data, IdxM->data);
+	return (cmp < 0 || (!cmp && C::key(IdxS->key, IdxM->key) < 0));
 }
 
 /*
@@ -202,9 +203,41 @@ bool rbTree<K,D>::dataKeyCompair(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
  * return value:		A boolean (True only if the first node has data less than second node or if nodes have equal data and
  *						first node has key less than second node)
 */
-template <typename K, typename D>
-bool rbTree<K,D>::dataKeyCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
-	return ((IdxS->data > IdxM->data) || ((IdxS->data == IdxM->data) && (IdxS->key > IdxM->key)));
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::dataKeyCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	int cmp = C::data(IdxS->data, IdxM->data);
+	return (cmp > 0 || (!cmp && C::key(IdxS->key, IdxM->key) > 0));
+}
+
+/*
+ * function_identifier: Checks if two given node pointers have equivalent keys and data, under the tree's ordering
+ * parameters: 			Two node pointers
+ * return value:		A boolean (True only if neither node orders before the other)
+*/
+template <typename K, typename D, typename C>
+bool rbTree<K,D,C>::keyDataEqual(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
+	return (!C::key(IdxS->key, IdxM->key) && !C::data(IdxS->data, IdxM->data));
+}
+
+/*
+ * function_identifier: Compairs two given node pointers by the sort type. The sort type is fixed at compile time,
+ *						so the sorts can inline the comparison instead of calling through a function pointer
+ * parameters: 			Two node pointers
+ * return value:		A boolean (True only if the first node goes before the second node)
+*/
+template <typename K, typename D, enum rbtsort sort, typename C>
+inline bool rbtNodeCompair<K,D,sort,C>::operator()(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) const {
+	switch(sort) {
+		case KEY: 			return rbTree<K,D,C>::keyCompair(IdxS, IdxM);
+		case KEY_R:			return rbTree<K,D,C>::keyCompairR(IdxS, IdxM);
+		case DATA:			return rbTree<K,D,C>::dataCompair(IdxS, IdxM);
+		case DATA_R:		return rbTree<K,D,C>::dataCompairR(IdxS, IdxM);
+		case KEYDATA:		return rbTree<K,D,C>::keyDataCompair(IdxS, IdxM);
+		case KEYDATA_R:		return rbTree<K,D,C>::keyDataCompairR(IdxS, IdxM);
+		case DATAKEY:		return rbTree<K,D,C>::dataKeyCompair(IdxS, IdxM);
+		case DATAKEY_R:		return rbTree<K,D,C>::dataKeyCompairR(IdxS, IdxM);
+		default:			return false;
+	}
 }
 
 
@@ -216,61 +249,240 @@ bool rbTree<K,D>::dataKeyCompairR(rbtNode<K,D> *IdxS, rbtNode<K,D> *IdxM) {
 /*	============================================================================  */
 
 namespace {
+		// Runs shorter than this are insertion sorted before any merging
+	constexpr size_t insertionRun = 16;
+
 	/*
-	 * function_identifier: Merges two sections in a list, using the provided function (called be "mergeSortCallerBase()")
-	 * parameters: 			An array of node pointers, the start pos of the section, the middle pos of the section, the end pos of the section, and
-	 *						the comparison function
+	 * function_identifier: Stably sorts a short run of node pointers in place, via insertion sort
+	 * parameters: 			The start and end of the run, and the comparison function
 	 * return value:		N/A
 	*/
-	template <typename K, typename D>
-	inline void mergeSortBase(rbtNode<K,D> **nodes, size_t st, size_t mi, size_t ed) {
-			// Sets up the needed arrays and pointers
-		rbtNode<K,D> **memo = new rbtNode<K,D> *[ed-st];
-		rbtNode<K,D> **IdxS = nodes + st, **IdxE1 = nodes + mi + 1;
-		rbtNode<K,D> **IdxM = IdxE1, **IdxE2 = nodes + ed;
+	template <typename K, typename D, typename F>
+	inline void insertionSortBase(rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE, F foo) {
+		for(rbtNode<K,D> **IdxM = IdxS + 1; IdxM < IdxE; IdxM++) {
+				// Shifts every strictly greater node up by one
+			rbtNode<K,D> *curr = *IdxM, **hole = IdxM;
+			for(; hole != IdxS && foo(curr, *(hole - 1)); hole--)
+				*hole = *(hole - 1);
+			*hole = curr;
+		}
+	}
 
+	/*
+	 * function_identifier: Stably merges two sorted, back to back sections of a list into another list
+	 *						(equal nodes are taken from the first section first)
+	 * parameters: 			The start of the first section, the end of the first section (the start of the second),
+	 *						the end of the second section, the list to write into, and the comparison function
+	 * return value:		N/A
+	*/
+	template <typename K, typename D, typename F>
+	inline void mergeBase(rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE1, rbtNode<K,D> **IdxM, rbtNode<K,D> **IdxE2, rbtNode<K,D> **memo, F foo) {
 			// Sorts through the lists
 		while(IdxS < IdxE1 && IdxM < IdxE2)
-			if (fooPtr<K,D>(*IdxS, *IdxM))
-				(*memo++) = (*IdxS++);
-			else
+			if (foo(*IdxM, *IdxS))
 				(*memo++) = (*IdxM++);
+			else
+				(*memo++) = (*IdxS++);
 
 			// Include any remaining nodes not yet accounted for
 		while(IdxS < IdxE1)
 			(*memo++) = (*IdxS++);
 		while(IdxM < IdxE2)
 			(*memo++) = (*IdxM++);
+	}
 
-			// Reinserts the sorted nodes
-		IdxS = nodes + st;
-		memo -= (ed - st);
-		while(IdxS != IdxE2)
-			(*IdxS++) = (*memo++);
+	/*
+	 * function_identifier: Sorts a section from one list into the other. Both lists hold the same nodes in the
+	 *						section, and each level of recursion merges back the other way, so there is no copying
+	 *						between merges. Recursing (rather than merging bottom up over the whole list) keeps
+	 *						small sections in cache while they are merged
+	 * parameters: 			The list to read from, the list to sort into, the length of the section, and the
+	 *						comparison function
+	 * return value:		N/A
+	*/
+	template <typename K, typename D, typename F>
+	void mergeSortSplit(rbtNode<K,D> **src, rbtNode<K,D> **dst, size_t len, F foo) {
+			// Sorts short runs in place
+		if (len <= insertionRun) {
+			insertionSortBase(dst, dst + len, foo);
+			return;
+		}
 
-			// Deletes the previously allocated memory
-		delete [] (memo + st - ed);
+			// Sorts both halves into the source, then merges them into the destination
+		size_t mi = len >> 1;
+		mergeSortSplit(dst, src, mi, foo);
+		mergeSortSplit(dst + mi, src + mi, len - mi, foo);
+		mergeBase(src, src + mi, src + mi, src + len, dst, foo);
 	}
 
 	/*
-	 * function_identifier: Sorts an array of tree node pointers, using the provided function (called be "rbt_nodeSort()")
+	 * function_identifier: Sorts a list, using a scratch list of the same length
+	 * parameters: 			An array of node pointers, a scratch array, the length of both, and the comparison function
+	 * return value:		N/A
+	*/
+	template <typename K, typename D, typename F>
+	inline void mergeSortRuns(rbtNode<K,D> **nodes, rbtNode<K,D> **memo, size_t len, F foo) {
+		std::copy(nodes, nodes + len, memo);
+		mergeSortSplit(memo, nodes, len, foo);
+	}
+
+	/*
+	 * function_identifier: Finds how many nodes of the first section land among the first outputs of a stable
+	 *						merge, so a merge can be split into independent pieces (merge path)
+	 * parameters: 			The first section and its length, the second section and its length, the number of
+	 *						outputs, and the comparison function
+	 * return value:		The number of those outputs that come from the first section
+	*/
+	template <typename K, typename D, typename F>
+	inline size_t mergeSplit(rbtNode<K,D> **IdxS, size_t len1, rbtNode<K,D> **IdxM, size_t len2, size_t diag, F foo) {
+		size_t lo = diag > len2 ? diag - len2 : 0, hi = std::min(diag, len1);
+
+			// Binary searches the diagonal, with ties going to the first section
+		while(lo < hi) {
+			size_t mi = lo + ((hi - lo) >> 1);
+			if (foo(IdxM[diag - mi - 1], IdxS[mi]))
+				hi = mi;
+			else
+				lo = mi + 1;
+		}
+
+		return lo;
+	}
+
+	/*
+	 * function_identifier: Writes one piece of the stable merge of two sorted sections, independently of the rest
+	 * parameters: 			The first section and its length, the second section and its length, the list the whole
+	 *						merge is written into, the first and last (exclusive) outputs of the piece, and the
+	 *						comparison function
+	 * return value:		N/A
+	*/
+	template <typename K, typename D, typename F>
+	inline void mergePiece(rbtNode<K,D> **IdxS, size_t len1, rbtNode<K,D> **IdxM, size_t len2, rbtNode<K,D> **memo, size_t lo, size_t hi, F foo) {
+			// Splits both sections at the ends of the piece
+		size_t loS = mergeSplit(IdxS, len1, IdxM, len2, lo, foo);
+		size_t hiS = mergeSplit(IdxS, len1, IdxM, len2, hi, foo);
+
+			// Merges just that piece
+		mergeBase(IdxS + loS, IdxS + hiS, IdxM + (lo - loS), IdxM + (hi - hiS), memo + lo, foo);
+	}
+
+	/*
+	 * function_identifier: Sorts a list on several threads. Each thread first sorts its own chunk, then pairs of
+	 *						sorted chunks are merged, with every merge split evenly over the threads, until one
+	 *						sorted list is left
+	 * parameters: 			An array of node pointers, a scratch array, the length of both, the number of threads
+	 *						(a power of two), and the comparison function
+	 * return value:		N/A
+	*/
+	template <typename K, typename D, typename F>
+	void mergeSortParallel(rbtNode<K,D> **nodes, rbtNode<K,D> **memo, size_t len, size_t parts, F foo) {
+		std::vector<std::thread> workers;
+
+			// Sorts every chunk on its own thread, leaving the results in the list
+		for(size_t i = 0; i < parts; i++)
+			workers.emplace_back([=] () -> void {
+				size_t st = len * i / parts, ed = len * (i + 1) / parts;
+				mergeSortRuns(nodes + st, memo + st, ed - st, foo);
+			});
+		for(auto &worker : workers)
+			worker.join();
+
+			// Merges pairs of sorted groups, giving each pair an even share of the threads
+		rbtNode<K,D> **src = nodes, **dst = memo;
+		for(size_t group = 1; group < parts; group <<= 1) {
+			workers.clear();
+			for(size_t i = 0; i < parts; i++)
+				workers.emplace_back([=] () -> void {
+						// Finds the pair this thread works on, and its share of the output
+					size_t pair = i / (group << 1), share = i % (group << 1);
+					size_t st = len * (pair * (group << 1)) / parts;
+					size_t mi = std::min(len * (pair * (group << 1) + group) / parts, len);
+					size_t ed = std::min(len * ((pair + 1) * (group << 1)) / parts, len);
+					size_t lo = (ed - st) * share / (group << 1), hi = (ed - st) * (share + 1) / (group << 1);
+
+					mergePiece(src + st, mi - st, src + mi, ed - mi, dst + st, lo, hi, foo);
+				});
+			for(auto &worker : workers)
+				worker.join();
+			std::swap(src, dst);
+		}
+
+			// Moves the result back into the list, if needed
+		if (src != nodes)
+			std::copy(src, src + len, nodes);
+	}
+
+	/*
+	 * function_identifier: Picks how many threads to sort or merge a list with
+	 * parameters: 			The length of the list
+	 * return value:		A power of two number of threads (1 below the parallel cutoff)
+	*/
+	inline size_t mergeThreads(size_t len) {
+		size_t parts = 1, threads = std::thread::hardware_concurrency();
+		if (len >= RBT_PARALLEL_CUTOFF)
+			for(; (parts << 1) <= threads; parts <<= 1);
+		return parts;
+	}
+
+	/*
+	 * function_identifier: Stably merges two sorted, back to back sections of a list, in place
+	 * parameters: 			An array of node pointers, the start pos of the first section, the end pos of the first
+	 *						section, the end pos (exclusive) of the second section, and the comparison function
+	 * return value:		N/A
+	*/
+	template <typename K, typename D, typename F>
+	inline void mergeSortBase(rbtNode<K,D> **nodes, size_t st, size_t mi, size_t ed, F foo) {
+			// Sets up the sections and the scratch array
+		size_t len = ed - st, len1 = std::min(mi + 1, ed) - st, parts = mergeThreads(len);
+		rbtNode<K,D> **memo = new rbtNode<K,D> *[len];
+		nodes += st;
+
+			// Merges into the scratch array, in even pieces over the threads
+		if (parts > 1) {
+			std::vector<std::thread> workers;
+			for(size_t i = 0; i < parts; i++)
+				workers.emplace_back(mergePiece<K,D,F>, nodes, len1, nodes + len1, len - len1, memo, len * i / parts, len * (i + 1) / parts, foo);
+			for(auto &worker : workers)
+				worker.join();
+		} else
+			mergeBase(nodes, nodes + len1, nodes + len1, nodes + len, memo, foo);
+
+			// Reinserts the merged nodes, and deletes the scratch array
+		std::copy(memo, memo + len, nodes);
+		delete [] memo;
+	}
+
+	/*
+	 * function_identifier: Stably sorts an array of tree node pointers, using the provided function (called be "rbt_nodeSort()")
+	 *						Uses a single scratch array for the whole sort, and several threads for large arrays
 	 * parameters: 			An array of node pointers, the pos to start the sort, the pos to end the sort, and
 	 *						the comparison function
 	 * return value:		N/A
 	*/
-	template <typename K, typename D>
-	inline void mergeSortCallerBase(rbtNode<K,D> **nodes, size_t si, size_t ed) {
-			// Checks if there is still more to sort
-			// If so, recursively call this function again, with subdivided arrays
-		if(si < ed) {
-				// Calculates the mid point
-			size_t mi = si + ((ed - si) >> 1);
-				// Recursively call this function again for subdivisions of the given array
-			mergeSortCallerBase(nodes, si, mi);
-			mergeSortCallerBase(nodes, mi + 1, ed);
-				// Merges the two sorted subdivided of the given arrays
-			mergeSortBase(nodes, si, mi, ed + 1);
-		} 
+	template <typename K, typename D, typename F>
+	inline void mergeSortCallerBase(rbtNode<K,D> **nodes, size_t si, size_t ed, F foo) {
+			// Returns if there is nothing to sort
+		if(si >= ed)
+			return;
+		size_t len = ed - si + 1;
+		nodes += si;
+
+			// Short lists need no scratch array
+		if (len <= insertionRun) {
+			insertionSortBase(nodes, nodes + len, foo);
+			return;
+		}
+
+			// Sorts with one scratch array, on several threads for large lists
+		size_t parts = mergeThreads(len);
+		rbtNode<K,D> **memo = new rbtNode<K,D> *[len];
+		if (parts > 1)
+			mergeSortParallel(nodes, memo, len, parts, foo);
+		else
+			mergeSortRuns(nodes, memo, len, foo);
+
+			// Deletes the scratch array
+		delete [] memo;
 	}
 }
 
@@ -284,34 +496,35 @@ void rbt_nodeSort(rbtNode<K,D> **nodes, size_t si, size_t ed, enum rbtsort sort
 		// Returns if there is nothing to do
 	if(!nodes || ed <= si + 1) return;
 
-		// Sort the nodes in the way requested
+		// Sort the nodes in the way requested, with an inlined comparison for each sort type
 	switch(sort) {
-		case KEY: 			fooPtr<K,D> = rbTree<K,D>::keyCompair; break;
-		case KEY_R:			fooPtr<K,D> = rbTree<K,D>::keyCompairR; break;
-		case DATA:			fooPtr<K,D> = rbTree<K,D>::dataCompair; break;
-		case DATA_R:		fooPtr<K,D> = rbTree<K,D>::dataCompairR; break;
-		case KEYDATA:		fooPtr<K,D> = rbTree<K,D>::keyDataCompair; break;
-		case KEYDATA_R:		fooPtr<K,D> = rbTree<K,D>::keyDataCompairR; break;
-		case DATAKEY:		fooPtr<K,D> = rbTree<K,D>::dataKeyCompair; break;
-		case DATAKEY_R:		fooPtr<K,D> = rbTree<K,D>::dataKeyCompairR; break;
+		case KEY: 			mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,KEY>()); break;
+		case KEY_R:			mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,KEY_R>()); break;
+		case DATA:			mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,DATA>()); break;
+		case DATA_R:		mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,DATA_R>()); break;
+		case KEYDATA:		mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,KEYDATA>()); break;
+		case KEYDATA_R:		mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,KEYDATA_R>()); break;
+		case DATAKEY:		mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,DATAKEY>()); break;
+		case DATAKEY_R:		mergeSortCallerBase(nodes, si, ed - 1, rbtNodeCompair<K,D,DATAKEY_R>()); break;
 		case NONE:			return;
 	}
-	mergeSortCallerBase(nodes, si, ed - 1);
 }
 
 /*
- * function_identifier: 
- * parameters: 			
- * return value:		
+ * function_identifier: User's interface to sort with their own comparison
+ *						Large arrays are sorted on several threads, so the comparison must be safe to call concurrently
+ * parameters: 			A node array, any callable that takes two node pointers and returns true if the first goes
+ *						before the second (function, functor or lambda, with or without captures), the start index
+ *						of the array, and the end index of the array
+ * return value:		N/A
 */
-template <typename K, typename D>
-void rbt_nodeSortCustom(rbtNode<K,D> **nodes, bool (*foo)(rbtNode<K,D> *, rbtNode<K,D> *), size_t si, size_t ed) {
+template <typename K, typename D, typename F>
+void rbt_nodeSortCustom(rbtNode<K,D> **nodes, F foo, size_t si, size_t ed) {
 		// Returns if there is nothing to do
 	if(!nodes || ed <= si + 1) return;
 
 		// Sort the nodes in the way requested
-	fooPtr<K,D> = foo;
-	mergeSortCallerBase(nodes, si, ed - 1);
+	mergeSortCallerBase(nodes, si, ed - 1, foo);
 }
 
 /*	============================================================================  */
@@ -321,96 +534,139 @@ void rbt_nodeSortCustom(rbtNode<K,D> **nodes, bool (*foo)(rbtNode<K,D> *, rbtNod
 /*	============================================================================  */
 
 /*
- * function_identifier: Converts an array of sorted nodes (primarily sorted by key, then by data) into a red-black tree.
- *						Deep copies the given nodes
- * parameters: 			The start and end indexes to consider, an array of nodes, and the current parent to branch from
- * return value:		Number of descendants the given parent has
+ * function_identifier: Works out how a tree of the given size is built. The tree is as balanced as can be,
+ *						so every level but the deepest is full; coloring only the deepest level red gives
+ *						every path the same number of black nodes
+ * parameters: 			The number of nodes, the level to color red (return by reference), and the number
+ *						of levels to build on separate threads (return by reference)
+ * return value:		N/A
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::treeify(size_t st, size_t ed, rbtNode<K,D> **rbtNodes, rbtNode<K,D> **curr) {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::treeifyLevels(size_t len, size_t &redLevel, size_t &forks) {
+		// Finds the deepest level (a lone root stays black)
+	redLevel = 0;
+	for(size_t i = len; i > 1; i >>= 1)
+		redLevel++;
+	if (!redLevel)
+		redLevel = SIZE_MAX;
+
+		// Forks just enough levels to keep every hardware thread busy
+	size_t threads = std::thread::hardware_concurrency();
+	forks = 0;
+	if (len >= RBT_PARALLEL_CUTOFF)
+		for(; ((size_t)1 << forks) < threads; forks++);
+}
+
+/*
+ * function_identifier: Builds a red-black tree out of an array of sorted nodes. Each subtree only depends on
+ *						its range of the array, so large left subtrees are built on their own thread
+ * parameters: 			The start and end indexes to consider, an array of nodes, the storage for node copies
+ *						(or NULL to link the given nodes themselves), the current parent to branch from, the
+ *						current level, the level to color red, and the number of levels left to fork
+ * return value:		N/A
+*/
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::treeifyBase(
+	size_t st,
+	size_t ed,
+	rbtNode<K,D> **rbtNodes,
+	void **storage,
+	rbtNode<K,D> **curr,
+	size_t level,
+	size_t redLevel,
+	size_t forks)
+{
 		// Calculates the average of midpoint, without overflow
 	size_t mid = st + ((ed - st + 1) >> 1);
 
-		// Sets up the new node
-	*curr = new rbtNode<K,D>(rbtNodes[mid]);
-	(*curr)->color = false;
+		// Sets up the current node, whose descendants and color follow from its range alone
+	rbtNode<K,D> *node = *curr = storage ? new (storage[mid]) rbtNode<K,D>(rbtNodes[mid]) : rbtNodes[mid];
+	node->parent = node->left = node->right = NULL;
+	node->descendants = ed - st;
+	node->setColor(level == redLevel);
 
-		// Check if a left child needs to be created
+		// Builds the left subtree on its own thread, if it is big enough to be worth it
+	std::thread leftThread;
+	bool fork = forks && ed - st + 1 >= RBT_PARALLEL_CUTOFF;
 	if (st < mid) {
-			// Creates a left child, adds it's descendants to the current node, and corrects the color
-		(*curr)->descendants += treeify(st, mid-1, rbtNodes, &(*curr)->left);
-		(*curr)->left->parent = *curr;
-		(*curr)->color ^= true;
+		if (fork)
+			leftThread = std::thread(treeifyBase, st, mid - 1, rbtNodes, storage, &node->left, level + 1, redLevel, forks - 1);
+		else
+			treeifyBase(st, mid - 1, rbtNodes, storage, &node->left, level + 1, redLevel, 0);
 	}
 
-		// Check if a right child needs to be created
-	if (mid < ed) {
-			// Creates a right child, adds it's descendants to the current node, and corrects the color
-		(*curr)->descendants += treeify(mid+1, ed, rbtNodes, &(*curr)->right);
-		(*curr)->right->parent = *curr;
-		(*curr)->color ^= true;
-	}
+		// Builds the right subtree
+	if (mid < ed)
+		treeifyBase(mid + 1, ed, rbtNodes, storage, &node->right, level + 1, redLevel, fork ? forks - 1 : 0);
+
+		// Links both subtrees back to the current node
+	if (leftThread.joinable())
+		leftThread.join();
+	if (node->left)
+		node->left->parent = node;
+	if (node->right)
+		node->right->parent = node;
+	augmentBase(node);
+}
 
-		// Returns the current node's number of descendants
-	return (*curr)->descendants + 1;
+/*
+ * function_identifier: Converts an array of sorted nodes (primarily sorted by key, then by data) into a red-black tree.
+ *						Deep copies the given nodes
+ * parameters: 			The start and end indexes to consider, an array of nodes, and the current parent to branch from
+ * return value:		Number of nodes in the new tree
+*/
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::treeify(size_t st, size_t ed, rbtNode<K,D> **rbtNodes, rbtNode<K,D> **curr) {
+	size_t len = ed - st + 1, redLevel, forks;
+	treeifyLevels(len, redLevel, forks);
+
+		// Takes storage for every copy up front, as the pool is not shared between threads
+	if (!pool)
+		pool = std::make_shared<rbtPool<K,D>>();
+	void **storage = new void *[len];
+	for(size_t i = 0; i < len; i++)
+		storage[i] = pool->allocate();
+
+		// Builds the tree, and the data index, out of copies
+	treeifyBase(0, len - 1, rbtNodes + st, storage, curr, 0, redLevel, forks);
+	dataIndexBase(len, [storage] (size_t i) -> rbtNode<K,D> * {return (rbtNode<K,D> *)storage[i];});
+
+		// Clears the storage array
+	delete [] storage;
+	return len;
 }
 
 /*
  * function_identifier: Converts an array of sorted nodes (primarily sorted by key, then by data) into a red-black tree.
  *						Shallow copies the given nodes
  * parameters: 			The start and end indexes to consider, an array of nodes, and the current parent to branch from
- * return value:		Number of descendants the given parent has
+ * return value:		Number of nodes in the new tree
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::treeifyShallow(size_t st, size_t ed, rbtNode<K,D> **rbtNodes, rbtNode<K,D> **curr) {
-		// Calculates the average of midpoint, without overflow
-	size_t mid = st + ((ed - st + 1) >> 1);
-
-		// Sets up the current node
-	*curr = rbtNodes[mid];
-	(*curr)->color = false;
-	(*curr)->descendants = 0;
-
-		// Check if a left child needs to be created
-	if (st < mid) {
-			// Creates a left child, adds it's descendants to the current node, and corrects the color
-		(*curr)->descendants += treeifyShallow(st, mid-1, rbtNodes, &(*curr)->left);
-		(*curr)->left->parent = *curr;
-		(*curr)->color ^= true;
-	} else
-			// If not, set it to be NULL
-		(*curr)->left = NULL;
-
-		// Check if a right child needs to be created
-	if (mid < ed) {
-			// Creates a right child, adds it's descendants to the current node, and corrects the color
-		(*curr)->descendants += treeifyShallow(mid+1, ed, rbtNodes, &(*curr)->right);
-		(*curr)->right->parent = *curr;
-		(*curr)->color ^= true;
-	} else
-			// If not, set it to be NULL
-		(*curr)->right = NULL;
-
-		// Returns the current node's number of descendants
-	return (*curr)->descendants + 1;
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::treeifyShallow(size_t st, size_t ed, rbtNode<K,D> **rbtNodes, rbtNode<K,D> **curr) {
+	size_t len = ed - st + 1, redLevel, forks;
+	treeifyLevels(len, redLevel, forks);
+
+		// Builds the tree, and the data index, out of the given nodes
+	treeifyBase(0, len - 1, rbtNodes + st, NULL, curr, 0, redLevel, forks);
+	dataIndexBase(len, [rbtNodes, st] (size_t i) -> rbtNode<K,D> * {return rbtNodes[st + i];});
+	return len;
 }
 
-
 /*
  * function_identifier: Allows the user to convert an array of nodes into a red-black tree 
  * parameters: 			The length of the array, and the array of nodes
  * return value:		N/A
 */
-template <typename K, typename D> 
-void rbTree<K,D>::rbt_treeify(size_t len, rbtNode<K,D> **rbtNodes) {
+template <typename K, typename D, typename C> 
+void rbTree<K,D,C>::rbt_treeify(size_t len, rbtNode<K,D> **rbtNodes) {
 		// Resets the tree
 	rbt_free();
 	size = len;
 
 	if (len) {
 			// If we are inserting nodes, sort and treeify them
-		fooPtr<K,D> = keyDataCompair;
-		mergeSortCallerBase(rbtNodes, 0, len - 1);
+		mergeSortCallerBase(rbtNodes, 0, len - 1, compair<KEYDATA>());
 		treeify(0, len-1, rbtNodes, &root);
 	} else
 			// If no nodes to insert, set the root to be NULL
@@ -422,15 +678,14 @@ void rbTree<K,D>::rbt_treeify(size_t len, rbtNode<K,D> **rbtNodes) {
  * parameters: 			The length of an array, and the node array
  * return value:		N/A
 */
-template <typename K, typename D> 
-rbTree<K,D>::rbTree(size_t len, rbtNode<K,D> **&rbtNodes) {
+template <typename K, typename D, typename C> 
+rbTree<K,D,C>::rbTree(size_t len, rbtNode<K,D> **&rbtNodes) {
 		// Sets the length of the tree
 	size = len;
 
 	if (len) {
 			// If we are inserting nodes, sort and treeify them
-		fooPtr<K,D> = keyDataCompair;
-		mergeSortCallerBase(rbtNodes, 0, len - 1);
+		mergeSortCallerBase(rbtNodes, 0, len - 1, compair<KEYDATA>());
 		treeify(0, len-1, rbtNodes, &root);
 	} else
 			// If no nodes to insert, set the root to be NULL
@@ -14,11 +14,6 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-	inline std::ostringstream traverseStr;
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                     	       TRAVERSALS                                   | */
@@ -29,13 +24,13 @@ namespace {
 
 /*
  * function_identifier: Prints out the structure of the given red-black tree (called by rbt_string())
- * parameters: 			A node pointer to process through a preorder traversal fashion
+ * parameters: 			A node pointer to process through a preorder traversal fashion and the string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::testOrder(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::testOrder(rbtNode<K,D> *curr, std::ostringstream &traverseStr) const {
 		// Prints curr's color
-	if(curr->color) traverseStr << "R ";
+	if(curr->getColor()) traverseStr << "R ";
 	else traverseStr << "B ";
 
 		// Check if current node has a parent
@@ -64,52 +59,52 @@ void rbTree<K,D>::testOrder(rbtNode<K,D> *curr) const {
 
 
 		// Performs preorder traversal
-	if(curr->left) testOrder(curr->left);
-	if(curr->right) testOrder(curr->right);
+	if(curr->left) testOrder(curr->left, traverseStr);
+	if(curr->right) testOrder(curr->right, traverseStr);
 }
 
 	/* PRE ORDER */
 
 /*
  * function_identifier: Prints the red-black-tree in an preorder traversal fashion (called by rbt_string())
- * parameters: 			A node pointer to process through a preorder traversal fashion
+ * parameters: 			A node pointer to process through a preorder traversal fashion and the string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::preOrder(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::preOrder(rbtNode<K,D> *curr, std::ostringstream &traverseStr) const {
 		// Performs preorder traversal
 	traverseStr << curr->data << ' ';
-	if(curr->left) preOrder(curr->left);
-	if(curr->right) preOrder(curr->right);
+	if(curr->left) preOrder(curr->left, traverseStr);
+	if(curr->right) preOrder(curr->right, traverseStr);
 }
 
 	/* IN ORDER */
 
 /*
  * function_identifier: Prints the red-black-tree in an inorder traversal fashion (called by rbt_string())
- * parameters: 			A node pointer to process through a inorder traversal fashion
+ * parameters: 			A node pointer to process through a inorder traversal fashion and the string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::inOrder(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::inOrder(rbtNode<K,D> *curr, std::ostringstream &traverseStr) const {
 		// Performs inorder traversal
-	if(curr->left) inOrder(curr->left);
+	if(curr->left) inOrder(curr->left, traverseStr);
 	traverseStr << curr->data << ' ';
-	if(curr->right) inOrder(curr->right);
+	if(curr->right) inOrder(curr->right, traverseStr);
 }
 
 	/* POST ORDER */
 
 /*
  * function_identifier: Prints the red-black-tree in an postorder traversal fashion (called by rbt_string())
- * parameters: 			A node pointer to process through a postorder traversal fashion
+ * parameters: 			A node pointer to process through a postorder traversal fashion and the string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::postOrder(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::postOrder(rbtNode<K,D> *curr, std::ostringstream &traverseStr) const {
 		// Performs postorder traversal
-	if(curr->left) postOrder(curr->left);
-	if(curr->right) postOrder(curr->right);
+	if(curr->left) postOrder(curr->left, traverseStr);
+	if(curr->right) postOrder(curr->right, traverseStr);
 	traverseStr << curr->data << ' ';
 }
 
@@ -117,26 +112,26 @@ void rbTree<K,D>::postOrder(rbtNode<K,D> *curr) const {
 
 /*
  * function_identifier: Prints the keys and data values of the red-black-tree in an inorder traversal fashion (called by rbt_string())
- * parameters: 			A node pointer to process through a inorder traversal fashion
+ * parameters: 			A node pointer to process through a inorder traversal fashion and the string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::keyAndData(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::keyAndData(rbtNode<K,D> *curr, std::ostringstream &traverseStr) const {
 		// Performs inorder traversal
-	if(curr->left) keyAndData(curr->left);
+	if(curr->left) keyAndData(curr->left, traverseStr);
 	traverseStr << '(' << curr->key << ", " << curr->data << ") ";
-	if(curr->right) keyAndData(curr->right);
+	if(curr->right) keyAndData(curr->right, traverseStr);
 }
 
 	/* LEVEL ORDER */
 
 /*
  * function_identifier: Prints the red-black-tree in an levelorder traversal fashion (called by rbt_string())
- * parameters: 			N/A
+ * parameters: 			The string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::levelOrder() const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::levelOrder(std::ostringstream &traverseStr) const {
 		// Initializes starting values
 	rbtNode<K,D> *nodes[size], **startPtr = nodes, **endPtr = nodes + 1;
 
@@ -165,11 +160,11 @@ void rbTree<K,D>::levelOrder() const {
 
 /*
  * function_identifier: Prints a single level of node values in the red-black tree (called by rbt_string())
- * parameters: 			A root node pointer and the level to print
+ * parameters: 			A root node pointer, the level to print, and the string buffer to write to
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::printLevel(rbtNode<K,D> *curr, size_t level) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::printLevel(rbtNode<K,D> *curr, size_t level, std::ostringstream &traverseStr) const {
 		// Returns if no more levels to explore
 	if(curr == NULL) return;
 
@@ -178,8 +173,8 @@ void rbTree<K,D>::printLevel(rbtNode<K,D> *curr, size_t level) const {
 		traverseStr << curr->data << ' ';
 	else {
 			// Performs perorder traversal (node that left is first visted branch)
-		printLevel(curr->left, level-1);
-		printLevel(curr->right, level-1);
+		printLevel(curr->left, level-1, traverseStr);
+		printLevel(curr->right, level-1, traverseStr);
 	}
 }
 
@@ -190,30 +185,30 @@ void rbTree<K,D>::printLevel(rbtNode<K,D> *curr, size_t level) const {
  * parameters: 			The traversal type and an optional level operator (used only for PRINT_LEVEL)
  * return value:		N/A
 */
-template <typename K, typename D>
-std::string rbTree<K,D>::rbt_string(enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+std::string rbTree<K,D,C>::rbt_string(enum rbtraversal traversal, size_t level) const {
 		// Returns empty string if red-black tree is empty
 	if (!root)
 		return "";
 
-		// Clears string buffer
-	traverseStr.str(std::string());
+		// Creates a string buffer for this call
+	std::ostringstream traverseStr;
 		// Calls the appropriate function depending on the given traversal argument
 	switch(traversal) { 
-		case TEST_ORDER:		testOrder(root); break;
-		case PRE_ORDER:			preOrder(root); break;
-		case IN_ORDER:			inOrder(root); break;
-		case POST_ORDER:		postOrder(root); break;
-		case KEYDATA:			keyAndData(root); break;
-		case LEVEL_ORDER:		levelOrder(); break;
-		case PRINT_LEVEL:		printLevel(root, level); break;
+		case TEST_ORDER:		testOrder(root, traverseStr); break;
+		case PRE_ORDER:			preOrder(root, traverseStr); break;
+		case IN_ORDER:			inOrder(root, traverseStr); break;
+		case POST_ORDER:		postOrder(root, traverseStr); break;
+		case KEYDATA:			keyAndData(root, traverseStr); break;
+		case LEVEL_ORDER:		levelOrder(traverseStr); break;
+		case PRINT_LEVEL:		printLevel(root, level, traverseStr); break;
 	}
 		// Returns output of string buffer
 	return traverseStr.str();
 }
 
-template <typename K, typename D>
-std::ostream& operator<<(std::ostream &out, rbTree<K,D> &rbt) {
+template <typename K, typename D, typename C>
+std::ostream& operator<<(std::ostream &out, rbTree<K,D,C> &rbt) {
 	out << rbt.rbt_string();
 	return out;
 }
@@ -1,9 +1,36 @@
 #include	<iostream>
 #include	"RBT_main.h"
 #include	<sstream>
+#include	<thread>
+#include	<vector>
+#include	<atomic>
 
 using namespace std;
 
+	// Custom orderings for rbTree's third template parameter
+struct rbtReverse {
+	static int key(const int &key1, const int &key2) {return key2 - key1;}
+	static int data(const int &data1, const int &data2) {return data2 - data1;}
+};
+
+struct rbtNoCase {
+	static int key(const string &key1, const string &key2) {
+		for(size_t i=0; i<key1.size() && i<key2.size(); i++)
+			if (tolower(key1[i]) != tolower(key2[i]))
+				return tolower(key1[i]) - tolower(key2[i]);
+		return (key1.size() > key2.size()) - (key1.size() < key2.size());
+	}
+	static int data(const int &data1, const int &data2) {return (data1 > data2) - (data1 < data2);}
+};
+
+	// Concatenates the data in key order, which only comes out right if subtrees are combined in order
+template <> struct rbtAggregate<int, string> {
+	typedef string type;
+	static type identity() {return "";}
+	static type lift(const int &, const string &data) {return data;}
+	static type combine(const type &left, const type &right) {return left + right;}
+};
+
 void rbt_main_test() {
 	cout << endl << "TESTING 'RBT_main.cpp'!" << endl << endl;
 
@@ -54,6 +81,52 @@ void rbt_main_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_insert with a hint..." << endl;
+		rbTree<int, int> rbt2, rbt3;
+
+			// Ascending and descending streams without a hint
+		for(int i=0; i<1000; i++)
+			rbt2.rbt_insert(i, i);
+		for(int i=-1; i>=-1000; i--)
+			rbt2.rbt_insert(i, i);
+
+			// Each new node is the hint for the next one
+		rbtNode<int, int> *hint = NULL;
+		for(int i=1000; i<2000; i++)
+			hint = rbt2.rbt_insert(hint, i, i);
+
+			// Equal nodes go after each other, and hints that are far off or NULL still insert correctly
+		rbtNode<int, int> *equal = rbt2.rbt_insert(rbt2.rbt_searchKey(500), 500, 500);
+		rbt2.rbt_insert(rbt2.rbt_searchKey(-900), 1500, 7);
+		rbt2.rbt_insert(rbt2.rbt_searchKey(7), 3, 3);
+		rbt2.rbt_insert(NULL, -2000, 0);
+
+			// Hints from another tree are refused
+		rbt3.rbt_insert(0, 0);
+		bool thrown = false;
+		try {
+			rbt2.rbt_insert(rbt3.rbt_getRoot(), 3, 3);
+		} catch (std::invalid_argument &) {
+			thrown = true;
+		}
+		if (!thrown)
+			throw;
+
+		rbtNode<int, int> *prev = NULL;
+		for(auto &curr : rbt2) {
+			if (prev && (curr.rbt_getKey() < prev->rbt_getKey() || (curr.rbt_getKey() == prev->rbt_getKey() && curr.rbt_getData() < prev->rbt_getData())))
+				throw;
+			if (&curr == equal && (prev->rbt_getKey() != 500 || prev == equal))
+				throw;
+			prev = &curr;
+		}
+		if (rbt2.rbt_getSize() != 3004 || rbt3.rbt_getSize() != 1 || rbt2.rbt_getHeight() > 24 || rbt2.rbt_nodeAt(0)->rbt_getKey() != -2000)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	try {
 		cout << "testing rbt_getAllNodes, delete..." << endl;
 		rbtNode<int, int>** nodes = rbt1.rbt_getAllNodes(LEVEL_ORDER);
@@ -110,6 +183,20 @@ void rbt_main_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing move constructor, move assignment..." << endl;
+		auto rbt2 = rbTree<int, int>(rbt1);
+		auto str = rbt2.rbt_string(TEST_ORDER);
+		auto rbt3 = std::move(rbt2);
+		if (rbt3.rbt_string(TEST_ORDER) != str || !rbt2.rbt_isEmpty())
+			throw;
+		rbt2 = std::move(rbt3);
+		if (rbt2.rbt_string(TEST_ORDER) != str || !rbt3.rbt_isEmpty())
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	try {
 		cout << "testing copy, rbt_string..." << endl;
 		auto rbt2 = rbt1.rbt_copy();
@@ -119,6 +206,154 @@ void rbt_main_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing a custom ordering (reversed keys and data)..." << endl;
+		rbTree<int, int, rbtReverse> rbt2, rbt3;
+		for(int i=0; i<100; i++) {
+			rbt2.rbt_insert(i, -i);
+			rbt3.rbt_insert(i << 1, -(i << 1));
+		}
+		if (rbt2.rbt_nodeAt(0)->rbt_getKey() != 99 || rbt2.rbt_minKey()->rbt_getKey() != 99 || rbt2.rbt_maxKey()->rbt_getKey() != 0)
+			throw;
+		if (!rbt2.rbt_search(42, -42) || rbt2.rbt_searchKey(100))
+			throw;
+		rbt3 &= rbt2;
+		if (rbt3.rbt_getSize() != 50 || rbt3.rbt_nodeAt(0)->rbt_getKey() != 98)
+			throw;
+		int keys[3] = {10, 90, 50};
+		rbt2.rbt_repDeleteKey(3, keys);
+		rbt2.rbt_clampKey(80, 20);
+		if (rbt2.rbt_getSize() != 60 || rbt2.rbt_nodeAt(0)->rbt_getKey() != 80 || rbt2.rbt_searchKey(50))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing a custom ordering (case-insensitive keys)..." << endl;
+		rbTree<string, int, rbtNoCase> rbt2;
+		rbt2.rbt_insert("banana", 1);
+		rbt2.rbt_insert("Apple", 1);
+		rbt2.rbt_insert("cherry", 1);
+		rbt2.rbt_insert("APPLE", 1);
+		if (rbt2.rbt_nodeAt(0)->rbt_getKey() != "Apple" || !rbt2.rbt_search("apple", 1) || !rbt2.rbt_searchKey("BANANA"))
+			throw;
+		rbt2.rbt_removeDuplicates();
+		if (rbt2.rbt_getSize() != 3 || rbt2.rbt_nodeAt(1)->rbt_getKey() != "banana")
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	cout << endl << "========================" << endl;
+}
+
+void rbt_pool_test() {
+	cout << endl << "TESTING 'RBT_pool.cpp'!" << endl << endl;
+
+	rbTree<int, int> rbt1;
+
+	try {
+		cout << "testing pool allocation, rbt_getPool..." << endl;
+		for(int i=-500; i<=500; i++)
+			rbt1.rbt_insert(i, -i);
+		if (!rbt1.rbt_getPool() || rbt1.rbt_getPool()->rbt_getLive() != rbt1.rbt_getSize())
+			throw;
+		for(int i=0; i<100; i++)
+			rbt1.rbt_pop();
+		if (rbt1.rbt_getPool()->rbt_getLive() != rbt1.rbt_getSize())
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing pool bulk release, rbt_clear..." << endl;
+		rbt1.rbt_clear();
+		if (rbt1.rbt_getPool()->rbt_getLive() != 0 || rbt1.rbt_getPool()->rbt_getSlabCount() != 1)
+			throw;
+		for(int i=0; i<10; i++)
+			rbt1.rbt_insert(i, i);
+		if (rbt1.rbt_string() != "0 1 2 3 4 5 6 7 8 9 ")
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing shared pool constructor..." << endl;
+		auto pool = make_shared<rbtPool<int, int>>(8, 64);
+		{
+			rbTree<int, int> rbt2(pool), rbt3(pool);
+			for(int i=0; i<100; i++) {
+				rbt2.rbt_insert(i, i);
+				rbt3.rbt_insert(-i, i);
+			}
+			if (pool->rbt_getLive() != 200)
+				throw;
+			rbt2.rbt_clear();
+			if (pool->rbt_getLive() != 100 || rbt3.rbt_getSize() != 100)
+				throw;
+		}
+		if (pool->rbt_getLive() != 0)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	cout << endl << "========================" << endl;
+}
+
+void rbt_iterator_test() {
+	cout << endl << "TESTING 'RBT_iterator.cpp'!" << endl << endl;
+
+	rbTree<int, int> rbt1;
+	for(int i=0; i<1000; i++)
+		rbt1.rbt_insert((i * 37) % 500, i);
+
+	try {
+		cout << "testing begin, end, rbegin, rend..." << endl;
+		rbtNode<int, int> **rbtNodes = rbt1.rbt_getAllNodes();
+		size_t idx = 0;
+		for(auto &node : rbt1)
+			if (&node != rbtNodes[idx++])
+				throw;
+		if (idx != rbt1.rbt_getSize())
+			throw;
+		for(auto it = rbt1.rbegin(); it != rbt1.rend(); it++)
+			if (&*it != rbtNodes[--idx])
+				throw;
+		if (idx || (--rbt1.end())->rbt_getKey() != 499 || (--rbt1.cend()) != --rbt1.end())
+			throw;
+		delete [] rbtNodes;
+
+		rbTree<int, int> rbt2;
+		if (rbt2.begin() != rbt2.end() || rbt2.rbegin() != rbt2.rend() || --rbt2.end() != rbt2.end())
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing const iterators, and stopping early..." << endl;
+		const rbTree<int, int> &rbt2 = rbt1;
+		int last = -1;
+		size_t count = 0;
+		for(rbTree<int, int>::const_iterator it = rbt2.begin(); it != rbt2.end() && it->rbt_getKey() < 10; ++it, count++) {
+			if (it->rbt_getKey() < last)
+				throw;
+			last = it->rbt_getKey();
+		}
+		if (count != 20)
+			throw;
+		rbTree<int, int>::iterator it = rbt1.begin();
+		rbt1.rbt_remove(&*++it);
+		if (rbt1.rbt_getSize() != 999 || rbt2.begin()->rbt_getKey() != 0)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	cout << endl << "========================" << endl;
 }
 
@@ -315,6 +550,74 @@ void rbt_traversal_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_countKey, rbt_countKeyData, rbt_countRange against a full scan..." << endl;
+		rbTree<int, int> rbt2, rbt3;
+		for(int i=0; i<3000; i++)
+			rbt2.rbt_insert((i * 11) % 400, i % 3);
+		for(int i=0; i<500; i++)
+			rbt2.rbt_delete(rbt2.rbt_searchKey((i * 13) % 400));
+		int keys[200], data[200];
+		for(int i=0; i<200; i++) {
+			keys[i] = i * 2;
+			data[i] = i % 4;
+		}
+		rbt3.rbt_repInsert(200, keys, data);
+		rbt2 += rbt3;
+
+		size_t countsKey[401] = {0}, countsKeyData[401][4] = {{0}};
+		rbtNode<int, int> **rbtNodes = rbt2.rbt_getAllNodes();
+		for(size_t idx = 0; idx < rbt2.rbt_getSize(); idx++) {
+			countsKey[rbtNodes[idx]->rbt_getKey()]++;
+			countsKeyData[rbtNodes[idx]->rbt_getKey()][rbtNodes[idx]->rbt_getData()]++;
+		}
+		delete [] rbtNodes;
+
+		for(int key=0; key<400; key++) {
+			if (rbt2.rbt_countKey(key) != countsKey[key])
+				throw;
+			for(int datum=0; datum<4; datum++)
+				if (rbt2.rbt_countKeyData(key, datum) != countsKeyData[key][datum])
+					throw;
+		}
+		size_t inRange = 0;
+		for(int key=50; key<=150; key++)
+			inRange += countsKey[key];
+		if (rbt2.rbt_countRange(50, 150) != inRange || rbt2.rbt_countRange(150, 50) || rbt2.rbt_countRange(-10, 1000) != rbt2.rbt_getSize())
+			throw;
+		if (rbt2.rbt_countRange(50, 1, 150, 0) != inRange - countsKeyData[50][0] - countsKeyData[150][1] - countsKeyData[150][2] - countsKeyData[150][3])
+			throw;
+		if (rbt2.rbt_countRange(50, 1, 50, 0))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing concurrent const traversals from multiple threads..." << endl;
+		std::string expected = rbt1.rbt_string(TEST_ORDER);
+		size_t counts = rbt1.rbt_countKey(8), width = rbt1.rbt_getWidthExact();
+		enum rbtraversal orders[4] = {PRE_ORDER, IN_ORDER, POST_ORDER, LEVEL_ORDER};
+		std::atomic<bool> failed(false);
+		std::vector<std::thread> workers;
+		for(size_t t=0; t<4; t++)
+			workers.emplace_back([&] () -> void {
+				for(size_t i=0; i<200; i++) {
+					size_t found[4];
+					for(size_t j=0; j<4; j++)
+						delete [] rbt1.rbt_getAllNodesWithKey(8, found[j], orders[j]);
+					if (found[0] != counts || found[1] != counts || found[2] != counts || found[3] != counts ||
+						rbt1.rbt_countKey(8) != counts || rbt1.rbt_getWidthExact() != width || rbt1.rbt_string(TEST_ORDER) != expected)
+						failed = true;
+				}
+			});
+		for(auto &worker : workers)
+			worker.join();
+		if (failed) throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	delete [] nodes;
 
 	cout << endl << "========================" << endl;
@@ -496,6 +799,174 @@ void rbt_access_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing the data lookups through inserts, deletes, copies and inversions..." << endl;
+
+			// Compares the data lookups with a full walk of the tree
+		auto dataLookups = [] (const rbTree<int, int> &rbt) -> bool {
+			const rbtNode<int, int> *minFirst = NULL, *minLast = NULL, *maxFirst = NULL, *maxLast = NULL;
+			bool found[211] = {};
+			for(auto &node : rbt) {
+				found[node.rbt_getData()] = true;
+				if (!minFirst || node.rbt_getData() < minFirst->rbt_getData())
+					minFirst = &node;
+				if (node.rbt_getData() <= minFirst->rbt_getData())
+					minLast = &node;
+				if (!maxFirst || node.rbt_getData() > maxFirst->rbt_getData())
+					maxFirst = &node;
+				if (node.rbt_getData() >= maxFirst->rbt_getData())
+					maxLast = &node;
+			}
+			if (rbt.rbt_minData_minKey() != minFirst || rbt.rbt_minData_maxKey() != minLast)
+				return false;
+			if (rbt.rbt_maxData_minKey() != maxFirst || rbt.rbt_maxData_maxKey() != maxLast)
+				return false;
+			if (rbt.rbt_minData()->rbt_getData() != minFirst->rbt_getData() || rbt.rbt_maxData()->rbt_getData() != maxFirst->rbt_getData())
+				return false;
+			for(int data=-1; data<=211; data++) {
+				rbtNode<int, int> *temp = rbt.rbt_searchData(data);
+				if (data < 0 || data == 211 ? temp != NULL : (temp ? temp->rbt_getData() != data : found[data]))
+					return false;
+			}
+			return true;
+		};
+
+		rbTree<int, int> rbt2;
+		for(int i=0; i<1500; i++) {
+			rbt2.rbt_insert((i * 13) % 97, (i * 31) % 211);
+			if (i % 3 == 2)
+				rbt2.rbt_delete(rbt2.rbt_nodeAt((i * 7) % rbt2.rbt_getSize()));
+			if (i % 100 == 99 && !dataLookups(rbt2))
+				throw;
+		}
+
+		rbTree<int, int> rbt3 = rbt2;
+		if (!dataLookups(rbt3))
+			throw;
+		rbt3.rbt_invertI();
+		if (!dataLookups(rbt3))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing rbt_lowerBound, rbt_upperBound, rbt_equalRange, and the key-filtered traversals..." << endl;
+		rbTree<int, int> rbt2;
+		for(int i=0; i<2000; i++)
+			rbt2.rbt_insert((i * 7) % 300, i % 7);
+		rbtNode<int, int> **rbtNodes = rbt2.rbt_getAllNodes();
+
+		for(int key=-1; key<=300; key++) {
+				// Finds the bounds by brute force
+			size_t lo = 0, hi;
+			while(lo < rbt2.rbt_getSize() && rbtNodes[lo]->rbt_getKey() < key) lo++;
+			for(hi = lo; hi < rbt2.rbt_getSize() && rbtNodes[hi]->rbt_getKey() == key; hi++);
+			auto range = rbt2.rbt_equalRange(key);
+			if (range.first != rbt2.rbt_lowerBound(key) || range.second != rbt2.rbt_upperBound(key))
+				throw;
+			if ((lo == rbt2.rbt_getSize() ? range.first != rbt2.end() : &*range.first != rbtNodes[lo]))
+				throw;
+			if ((hi == rbt2.rbt_getSize() ? range.second != rbt2.end() : &*range.second != rbtNodes[hi]))
+				throw;
+
+			size_t nodes, count = 0;
+			rbtNode<int, int> **keyNodes = rbt2.rbt_getAllNodesWithKey(key, nodes, IN_ORDER);
+			for(; range.first != range.second; ++range.first)
+				if (keyNodes[count++] != &*range.first)
+					throw;
+			if (nodes != hi - lo || count != nodes)
+				throw;
+			delete [] keyNodes;
+		}
+
+		auto range = rbt2.rbt_equalRange(14, 3);
+		size_t nodes;
+		rbtNode<int, int> **keyNodes = rbt2.rbt_getAllNodesWithDataKey(3, 14, nodes, LEVEL_ORDER);
+		for(size_t idx = 0; range.first != range.second; ++range.first, idx++)
+			if (range.first->rbt_getKey() != 14 || range.first->rbt_getData() != 3 || idx >= nodes)
+				throw;
+		if (!nodes || rbt2.rbt_lowerBound(14, 3) == rbt2.rbt_upperBound(14, 3) || (--rbt2.rbt_lowerBound(14, 3))->rbt_getData() >= 3)
+			throw;
+		delete [] keyNodes;
+		delete [] rbtNodes;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing rbt_rank, rbt_quantile, rbt_median, rbt_quantiles..." << endl;
+		rbTree<int, int> rbt2;
+		for(int i=0; i<1000; i++)
+			rbt2.rbt_insert((i * 17) % 250, i);
+		rbtNode<int, int> **rbtNodes = rbt2.rbt_getAllNodes();
+
+		if (rbt2.rbt_rank(0) != 0 || rbt2.rbt_rank(100) != 400 || rbt2.rbt_rank(1000) != 1000 || rbt2.rbt_rank(100, rbtNodes[401]->rbt_getData()) != 401)
+			throw;
+		if (rbt2.rbt_quantile(0) != rbtNodes[0] || rbt2.rbt_quantile(1) != rbtNodes[999] || rbt2.rbt_quantile(0.99) != rbtNodes[989])
+			throw;
+		if (rbt2.rbt_median() != rbtNodes[499] || rbt2.rbt_quantile(0.0001) != rbtNodes[0])
+			throw;
+
+		double quantiles[7] = {0, 0.1, 0.5, 0.5, 0.9, 0.99, 1};
+		rbtNode<int, int> *found[7];
+		rbt2.rbt_quantiles(7, quantiles, found);
+		for(size_t i=0; i<7; i++)
+			if (found[i] != rbt2.rbt_quantile(quantiles[i]))
+				throw;
+
+		bool thrown = false;
+		try {
+			double unsorted[2] = {0.9, 0.1};
+			rbt2.rbt_quantiles(2, unsorted, found);
+		} catch (std::invalid_argument &) {
+			thrown = true;
+		}
+		if (!thrown)
+			throw;
+		delete [] rbtNodes;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing rbt_aggregate through inserts, deletes, copies and repositions..." << endl;
+		rbTree<int, string> rbt1;
+		auto walk = [] (const rbTree<int, string> &rbt, int st, int ed) -> string {
+			string out;
+			for(auto &node : rbt)
+				if (node.rbt_getKey() >= st && node.rbt_getKey() <= ed)
+					out += node.rbt_getData();
+			return out;
+		};
+		auto check = [&walk] (const rbTree<int, string> &rbt) -> bool {
+			if (rbt.rbt_aggregate() != walk(rbt, -1000, 1000))
+				return false;
+			for(int st=-3; st<65; st+=5)
+				for(int ed=st-2; ed<70; ed+=7)
+					if (rbt.rbt_aggregate(st, ed) != walk(rbt, st, ed))
+						return false;
+			return true;
+		};
+		if (rbt1.rbt_aggregate() != "" || rbt1.rbt_aggregate(0, 10) != "")
+			throw;
+		for(int i=0; i<60; i++)
+			rbt1.rbt_insert((i*37)%60, string(1, 'a' + i%26));
+		rbt1.rbt_insert(20, "Z");
+		if (!check(rbt1))
+			throw;
+		for(int i=0; i<60; i+=3)
+			rbt1.rbt_delete(rbt1.rbt_searchKey(i));
+		if (!check(rbt1))
+			throw;
+		rbTree<int, string> rbt2(rbt1);
+		rbt2.rbt_setData(rbt2.rbt_searchKey(31), "long");
+		if (!check(rbt2) || !check(rbt1) || rbt2.rbt_aggregate(31, 31) != "long")
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	cout << endl << "========================" << endl;
 }
 
@@ -542,6 +1013,41 @@ void rbt_sort_test() {
 		exit(0);
 	}
 	
+	try {
+		cout << "testing rbt_nodeSortCustom with a capturing lambda..." << endl;
+		rbTree<int, int> rbt2;
+		for(int i=0; i<50; i++)
+			rbt2.rbt_insert(i, i);
+		rbtNode<int, int> **lambdaNodes = rbt2.rbt_getAllNodes(IN_ORDER);
+			// Sorts by distance from a captured pivot, ties kept in key order
+		int pivot = 20;
+		rbt_nodeSortCustom(lambdaNodes, [pivot] (rbtNode<int, int> *a, rbtNode<int, int> *b) -> bool {
+			return abs(a->rbt_getKey() - pivot) < abs(b->rbt_getKey() - pivot);
+		}, 0, 50);
+		if (lambdaNodes[0]->rbt_getKey() != 20 || lambdaNodes[1]->rbt_getKey() != 19 || lambdaNodes[2]->rbt_getKey() != 21 || lambdaNodes[49]->rbt_getKey() != 49)
+			throw;
+		delete [] lambdaNodes;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing rbt_nodeSort stability..." << endl;
+		rbTree<int, int> rbt2;
+		for(int i=0; i<40; i++)
+			rbt2.rbt_insert(i % 4, i);
+		rbtNode<int, int> **stableNodes = rbt2.rbt_getAllNodes(IN_ORDER);
+			// Sorting by key after sorting by descending data keeps each key's data descending
+		rbt_nodeSort(stableNodes, 0, 40, DATA_R);
+		rbt_nodeSort(stableNodes, 0, 40, KEY);
+		for(int i=0; i<40; i++)
+			if (stableNodes[i]->rbt_getKey() != i / 10 || stableNodes[i]->rbt_getData() != 36 + i / 10 - (i % 10) * 4)
+				throw;
+		delete [] stableNodes;
+	} catch (...) {
+		exit(0);
+	}
+
 	try {
 		cout << "testing treeify constructor..." << endl;
 		rbTree<int, int> rbt2(rbt1.rbt_getSize(), nodes);
@@ -557,6 +1063,25 @@ void rbt_sort_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_treeify coloring..." << endl;
+		rbTree<int, int> rbt2, rbt3;
+		for(int i=0; i<6; i++)
+			rbt2.rbt_insert(i, i);
+		rbtNode<int, int> **sixNodes = rbt2.rbt_getAllNodes(IN_ORDER);
+		rbt3.rbt_treeify(6, sixNodes);
+		delete [] sixNodes;
+			// Only the deepest level (keys 0, 2 and 4) is red, so every path has two black nodes
+		string colors = rbt3.rbt_string(TEST_ORDER);
+		size_t reds = 0;
+		for(size_t i = colors.find("R key"); i != string::npos; i = colors.find("R key", i + 1))
+			reds++;
+		if (colors.find("B key: 3") != 0 || reds != 3 || colors.find("R key: 5") != string::npos)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	delete [] nodes;
 
 	cout << endl << "========================" << endl;
@@ -615,6 +1140,44 @@ void rbt_indel_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_repInsert by descents, joins and rebuilds, in order..." << endl;
+
+		rbTree<int, int> rbtLarge, rbtSmall;
+		int keys[3] = {9001, 7, 3};
+		rbtNode<int, int> *prev = NULL;
+		for(int i = 0; i < 5000; i++)
+			rbtLarge.rbt_insert(i * 2, 0);
+		rbtNode<int, int> *kept = rbtLarge.rbt_search(998, 0);
+
+			// A small batch descends, a large clustered one is joined in at either end
+		rbtLarge.rbt_repInsert(3, keys);
+		rbtLarge.rbt_repInsertInc(RBT_BULK_JOIN, 20000, 1);
+		rbtLarge.rbt_repInsertDec(RBT_BULK_JOIN, -1, 1);
+		for(auto &node : rbtLarge) {
+			if (prev && node.rbt_getKey() < prev->rbt_getKey())
+				throw;
+			prev = &node;
+		}
+		if (rbtLarge.rbt_getSize() != 5003 + 2 * RBT_BULK_JOIN || rbtLarge.rbt_search(998, 0) != kept || rbtLarge.rbt_getHeightExact() > 2 * 14)
+			throw;
+
+			// A batch larger than the tree rebuilds it, with stepped batches sorted first
+		rbtSmall.rbt_insert(5, 0);
+		rbtSmall.rbt_repInsertInc(3, 0, 1);
+		rbtSmall.rbt_repInsertDec(3, 9, 1);
+		prev = NULL;
+		for(auto &node : rbtSmall) {
+			if (prev && node.rbt_getKey() < prev->rbt_getKey())
+				throw;
+			prev = &node;
+		}
+		if (rbtSmall.rbt_getSize() != 7 || !rbtSmall.rbt_search(8, 0))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	try {
 		cout << "testing rbt_repDelete, rbt_repDeleteKey, rbt_repDeleteData..." << endl;
 
@@ -640,6 +1203,29 @@ void rbt_indel_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_repDelete keeps the nodes after the last match..." << endl;
+
+		rbTree<int, int> rbt3;
+		for(int i=1; i<=5; i++)
+			rbt3.rbt_insert(i, 0);
+
+			// Nothing matches, so every node stays
+		int keys[2] = {1, 3}, data[2] = {9, 0};
+		rbt3.rbt_repDelete(1, keys, data);
+		rbt3.rbt_repDeleteKey(1, data);
+		if (rbt3.rbt_getSize() != 5 || rbt3.rbt_maxKey()->rbt_getKey() != 5)
+			throw;
+
+			// The last match comes before the tail
+		rbt3.rbt_repDelete(2, keys, data);
+		rbt3.rbt_repDeleteKey(1, keys);
+		if (rbt3.rbt_getSize() != 3 || rbt3.rbt_searchKey(3) || rbt3.rbt_nodeAt(0)->rbt_getKey() != 2 || rbt3.rbt_maxKey()->rbt_getKey() != 5)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	rbt2.rbt_repInsert(8, values, values);
 	rbt2.rbt_repInsert(8, NULL, values);
 	rbt2.rbt_repInsert(8, values);
@@ -921,6 +1507,102 @@ void rbt_limit_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing the data removals and limits against a walk of the tree..." << endl;
+
+			// Checks that a tree holds, in order, exactly the pairs (i, (i * 37) % 100) whose data passes a filter
+		auto holds = [] (const rbTree<int, int> &rbt, bool (*keep)(int)) -> bool {
+			size_t count = 0;
+			auto it = rbt.begin();
+			for(int i=0; i<3000; i++) {
+				if (!keep((i * 37) % 100))
+					continue;
+				if (it == rbt.end() || it->rbt_getKey() != i || it->rbt_getData() != (i * 37) % 100)
+					return false;
+				it++; count++;
+			}
+			return it == rbt.end() && count == rbt.rbt_getSize();
+		};
+
+		rbTree<int, int> rbt4;
+		for(int i=0; i<3000; i++)
+			rbt4.rbt_insert(i, (i * 37) % 100);
+		if (rbt4.rbt_countData(42) != 30 || rbt4.rbt_searchData(42)->rbt_getData() != 42 || rbt4.rbt_searchData(100))
+			throw;
+
+		rbt4.rbt_removeData(42);
+		int key = rbt4.rbt_searchData(43)->rbt_getKey();
+		if (rbt4.rbt_deleteData(43) != 43 || rbt4.rbt_countData(43) != 29)
+			throw;
+		rbt4.rbt_insert(key, 43);
+		if (rbt4.rbt_countData(42) || rbt4.rbt_searchData(42) || rbt4.rbt_countData(43) != 30)
+			throw;
+		if (!holds(rbt4, [] (int data) -> bool {return data != 42;}))
+			throw;
+
+		rbt4.rbt_clampData(1, 98);
+		rbt4.rbt_upperLimitData(96);
+		rbt4.rbt_lowerLimitData(3);
+		rbt4.rbt_excludeData(50, 50);
+		if (!holds(rbt4, [] (int data) -> bool {return data >= 3 && data <= 96 && data != 42 && data != 50;}))
+			throw;
+
+		rbt4.rbt_clampData(20, 80);
+		rbt4.rbt_excludeData(30, 69);
+		if (!holds(rbt4, [] (int data) -> bool {return data >= 20 && data <= 80 && (data < 30 || data > 69) && data != 42 && data != 50;}))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing the key limits against a walk of the tree, without moving kept nodes..." << endl;
+
+			// Checks that a tree holds, in order, the pairs (i, 0) and (i, 1) whose key passes a filter
+		auto holds = [] (const rbTree<int, int> &rbt, bool (*keep)(int)) -> bool {
+			size_t count = 0;
+			auto it = rbt.begin();
+			for(int i=0; i<3000; i++)
+				for(int j=0; j<2 && keep(i); j++) {
+					if (it == rbt.end() || it->rbt_getKey() != i || it->rbt_getData() != j)
+						return false;
+					it++; count++;
+				}
+			return it == rbt.end() && count == rbt.rbt_getSize() && rbt.rbt_getHeightExact() <= 2 * 13;
+		};
+
+		rbTree<int, int> rbt4;
+		for(int j=0; j<2; j++)
+			for(int i=0; i<3000; i++)
+				rbt4.rbt_insert(i, j);
+		rbtNode<int, int> *kept = rbt4.rbt_search(1500, 1);
+
+		rbt4.rbt_deleteLowestKey(21);
+		rbt4.rbt_removeLowestKey(2);
+		rbt4.rbt_deleteHighestKey(3);
+		rbt4.rbt_removeHighestKey(3);
+		if (!holds(rbt4, [] (int key) -> bool {return key >= 12 && key <= 2995;}))
+			throw;
+
+		rbt4.rbt_upperLimitKey(2900);
+		rbt4.rbt_lowerLimitKey(100);
+		rbt4.rbt_clampKey(50, 2800);
+		rbt4.rbt_excludeKey(1000, 1099);
+		if (!holds(rbt4, [] (int key) -> bool {return key >= 100 && key <= 2800 && (key < 1000 || key > 1099);}))
+			throw;
+
+		int stK[3] = {2000, 90, 1400}, edK[3] = {2100, 1200, 1600};
+		rbt4.rbt_clampKey(3, stK, edK);
+		int stX[2] = {1550, 150}, edX[2] = {1560, 199};
+		rbt4.rbt_excludeKey(2, stX, edX);
+		if (!holds(rbt4, [] (int key) -> bool {
+			return ((key >= 100 && key < 150) || (key > 199 && key < 1000) || (key > 1099 && key <= 1200) || (key >= 1400 && key < 1550) || (key > 1560 && key <= 1600) || (key >= 2000 && key <= 2100));
+		}) || rbt4.rbt_search(1500, 1) != kept)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	cout << endl << "========================" << endl;
 }
 
@@ -981,6 +1663,39 @@ void rbt_value_test() {
 		exit(0);
 	}	
 
+	try {
+		cout << "testing rbt_set, rbt_setKey and rbt_delete keep the nodes in place..." << endl;
+
+		rbTree<int, int> rbt4, rbt5;
+		for(int i=0; i<1000; i++)
+			rbt4.rbt_insert(i * 2, 0);
+		rbt5.rbt_insert(1, 0);
+		rbtNode<int, int> *moved = rbt4.rbt_searchKey(500), *stays = rbt4.rbt_searchKey(502), *other = rbt5.rbt_getRoot();
+
+			// Moves a node across the tree and back, and nudges one in place
+		rbt4.rbt_setKey(moved, 1999);
+		if (rbt4.rbt_nodeAt(999) != moved || rbt4.rbt_searchKey(1999) != moved)
+			throw;
+		rbt4.rbt_set(moved, -1, 3);
+		rbt4.rbt_setKey(stays, 503);
+		if (rbt4.rbt_nodeAt(0) != moved || rbt4.rbt_searchKey(503) != stays || rbt4.rbt_nodeAt(251) != stays)
+			throw;
+
+			// Leaves nodes from other trees alone, and deletes only the given node
+		rbt4.rbt_setKey(other, 7);
+		rbt4.rbt_delete(rbt4.rbt_getRoot());
+		if (other->rbt_getKey() != 1 || rbt4.rbt_getSize() != 999 || rbt4.rbt_searchKey(503) != stays || rbt4.rbt_nodeAt(0) != moved)
+			throw;
+		int prev = -2;
+		for(auto &node : rbt4) {
+			if (node.rbt_getKey() <= prev)
+				throw;
+			prev = node.rbt_getKey();
+		}
+	} catch (...) {
+		exit(0);
+	}
+
 	try {
 		cout << "testing rbt_setAllKeys, rbt_funcAllKeys, rbt_funcAllKeysK, rbt_funcAllKeysD..." << endl;
 
@@ -1007,6 +1722,34 @@ void rbt_value_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_funcAllKeysK and rbt_funcAllDataD keep the tree's shape when the order holds..." << endl;
+
+		rbTree<int, int> rbt4;
+		for(int i=0; i<1000; i++)
+			rbt4.rbt_insert(i * 2, i);
+		rbtNode<int, int> *root = rbt4.rbt_getRoot(), *node = rbt4.rbt_searchKey(500);
+
+			// Shifting every key, or scaling every data, keeps the order
+		rbt4.rbt_funcAllKeysK([] (int K) -> int {return K + 5;});
+		rbt4.rbt_funcAllDataD([] (int D) -> int {return D * 3;});
+		if (rbt4.rbt_getRoot() != root || rbt4.rbt_searchKey(505) != node || node->rbt_getData() != 750 || rbt4.rbt_maxData()->rbt_getData() != 2997)
+			throw;
+
+			// Negating every key reverses it, so the tree is rebuilt
+		rbt4.rbt_funcAllKeysK([] (int K) -> int {return -K;});
+		rbtNode<int, int> *prev = NULL;
+		for(auto &curr : rbt4) {
+			if (prev && curr.rbt_getKey() <= prev->rbt_getKey())
+				throw;
+			prev = &curr;
+		}
+		if (rbt4.rbt_searchKey(-505) != node || rbt4.rbt_getSize() != 1000)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	cout << endl << "========================" << endl;
 }
 
@@ -1150,6 +1893,77 @@ void rbt_ops_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing rbt_split, rbt_join and rbt_concat..." << endl;
+
+		rbTree<int, int> rbt1;
+		for(int i=0; i<500; i++)
+			rbt1.rbt_insert((i*7)%100, i);
+		string all = rbt1.rbt_string();
+		size_t below = rbt1.rbt_rank(40);
+
+			// Splitting moves the nodes, and concatenating them back gives the same tree
+		auto halves = rbt1.rbt_split(40);
+		if (!rbt1.rbt_isEmpty() || halves.first.rbt_getSize() != below || halves.second.rbt_getSize() != 500 - below)
+			throw;
+		if (halves.first.rbt_maxKey()->rbt_getKey() != 39 || halves.second.rbt_minKey()->rbt_getKey() != 40)
+			throw;
+		if (halves.first.rbt_getHeightExact() > (size_t)(2 * log2(below + 1)) || halves.first.rbt_getPool() != halves.second.rbt_getPool())
+			throw;
+		rbt1 = rbTree<int, int>::rbt_concat(std::move(halves.first), std::move(halves.second));
+		if (rbt1.rbt_string() != all || rbt1.rbt_nodeAt(below)->rbt_getKey() != 40)
+			throw;
+
+			// Joining around a new node, and overlapping trees are refused
+		halves = rbt1.rbt_split(40);
+		rbt1 = rbTree<int, int>::rbt_join(std::move(halves.first), 40, -1, std::move(halves.second));
+		if (rbt1.rbt_getSize() != 501 || rbt1.rbt_nodeAt(below)->rbt_getData() != -1)
+			throw;
+		bool thrown = false;
+		try {
+			halves = rbt1.rbt_split(50);
+			rbTree<int, int>::rbt_concat(std::move(halves.second), std::move(halves.first));
+		} catch (std::invalid_argument &) {
+			thrown = true;
+		}
+		if (!thrown)
+			throw;
+
+			// Shards sliced in order, and trees from other pools, concatenate back together
+		rbt1.rbt_clear();
+		for(int i=0; i<300; i++)
+			rbt1.rbt_insert(i, i);
+		all = rbt1.rbt_string();
+		rbTree<int, int> *shards = rbt1.rbt_distribute_shallow(3, IN_ORDER);
+		rbt1 = rbTree<int, int>::rbt_concat(std::move(shards[0]), std::move(shards[1]));
+		rbt1 = rbTree<int, int>::rbt_concat(std::move(rbt1), std::move(shards[2]));
+		delete [] shards;
+		rbTree<int, int> rbt2;
+		rbt2.rbt_insert(1000, 0);
+		rbt1 = rbTree<int, int>::rbt_concat(std::move(rbt1), std::move(rbt2));
+		if (rbt1.rbt_getSize() != 301 || rbt1.rbt_maxKey()->rbt_getKey() != 1000 || rbt1.rbt_nodeAt(299)->rbt_getKey() != 299)
+			throw;
+		rbt1.rbt_delete(rbt1.rbt_maxKey());
+		if (rbt1.rbt_string() != all)
+			throw;
+
+			// An emptied tree joined to a tree from another pool takes that tree's pool
+		rbTree<int, int> rbt3;
+		for(int i=0; i<10; i++)
+			rbt3.rbt_insert(i, i);
+		halves = rbt3.rbt_split(-5);
+		{
+			rbTree<int, int> rbt4;
+			for(int i=100; i<200; i++)
+				rbt4.rbt_insert(i, i);
+			rbt3 = rbTree<int, int>::rbt_join(std::move(halves.first), 50, 50, std::move(rbt4));
+		}
+		if (rbt3.rbt_getSize() != 101 || rbt3.rbt_searchKey(150)->rbt_getData() != 150 || rbt3.rbt_minKey()->rbt_getKey() != 50)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	cout << endl << "========================" << endl;
 }
 
@@ -1185,6 +1999,31 @@ void rbt_setops_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing |, |=, &, &=, ^, ^=, + and += operations with expiring trees..." << endl;
+
+		if ((rbt4 | rbTree<int, int>(rbt5)).rbt_string(KEY_DATA) != (rbt4 | rbt5).rbt_string(KEY_DATA))
+			throw;
+		if ((rbt4 & rbTree<int, int>(rbt5)).rbt_string(KEY_DATA) != (rbt4 & rbt5).rbt_string(KEY_DATA))
+			throw;
+		if ((rbt4 ^ rbTree<int, int>(rbt5)).rbt_string(KEY_DATA) != (rbt4 ^ rbt5).rbt_string(KEY_DATA))
+			throw;
+		if ((rbt4 + rbTree<int, int>(rbt5)).rbt_string(KEY_DATA) != (rbt4 + rbt5).rbt_string(KEY_DATA))
+			throw;
+
+		rbTree<int, int> rbt6 = rbt5, rbt7 = rbt5;
+		rbt6 |= rbTree<int, int>(rbt4);
+		rbt7 |= rbt4;
+		if (rbt6.rbt_string(KEY_DATA) != rbt7.rbt_string(KEY_DATA))
+			throw;
+		(rbt6 += rbTree<int, int>(rbt4)) &= rbTree<int, int>(rbt5);
+		(rbt7 += rbt4) &= rbt5;
+		if (rbt6.rbt_string(KEY_DATA) != rbt7.rbt_string(KEY_DATA))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	try {
 		cout << "testing rbt_orLeast, rbt_orLeastI operations..." << endl;
 
@@ -1477,11 +2316,261 @@ void rbt_setops_test() {
 		exit(0);
 	}
 
+	try {
+		cout << "testing |=, &=, -= and rbt_orMostI of a small tree into a large one..." << endl;
+
+		rbTree<int, int> rbtLarge, rbtSmall, rbtAll, rbtNone;
+		for(int i = 0; i < 1000; i++)
+			rbtLarge.rbt_insert(i * 2, 0);
+		rbtSmall.rbt_insert(10, 0);
+		rbtSmall.rbt_insert(10, 0);
+		rbtSmall.rbt_insert(11, 0);
+		rbtSmall.rbt_insert(500, 1);
+		rbtSmall.rbt_insert(5000, 0);
+		rbtNode<int, int> *kept = rbtLarge.rbt_search(998, 0), *matched = rbtLarge.rbt_search(10, 0);
+
+			// Union keeps the one (10, 0), and copies the rest
+		rbtLarge |= rbtSmall;
+		if (rbtLarge.rbt_getSize() != 1003 || rbtLarge.rbt_countKey(10) != 1 || rbtLarge.rbt_search(998, 0) != kept || rbtLarge.rbt_search(10, 0) != matched)
+			throw;
+
+			// Union by most copies the second (10, 0)
+		rbtLarge.rbt_orMostI(rbtSmall);
+		if (rbtLarge.rbt_getSize() != 1004 || rbtLarge.rbt_countKey(10) != 2 || rbtLarge.rbt_search(998, 0) != kept)
+			throw;
+
+			// Difference drops only the matched nodes
+		rbtLarge -= rbtSmall;
+		if (rbtLarge.rbt_getSize() != 999 || rbtLarge.rbt_countKey(10) || rbtLarge.rbt_countKey(500) != 1 || rbtLarge.rbt_search(998, 0) != kept)
+			throw;
+		rbtAll = rbtLarge | rbtSmall;
+		if (rbtAll.rbt_getSize() != 1004 || rbtAll.rbt_getHeightExact() > 2 * 10)
+			throw;
+
+			// Intersection keeps only the matched nodes
+		rbtNone = rbtLarge & rbtSmall;
+		rbtAll &= rbtSmall;
+		if (rbtNone.rbt_getSize() || rbtAll.rbt_getSize() != 5 || rbtAll.rbt_countKey(10) != 2 || (rbtAll & rbtLarge).rbt_getSize())
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing rbt_orParallel, rbt_andParallel, rbt_xorParallel and rbt_subParallel..." << endl;
+
+			// Large enough to be cut into parts, with duplicates on both sides
+		rbTree<int, int> rbtEven, rbtThird;
+		for(int i = 0; i < 40000; i++)
+			rbtEven.rbt_insert(i * 2 % 50000, i % 3);
+		for(int i = 0; i < 30000; i++)
+			rbtThird.rbt_insert(i * 3 % 50000, i % 3);
+
+		auto sameNodes = [] (const rbTree<int, int> &rbt1, const rbTree<int, int> &rbt2) -> bool {
+			if (rbt1.rbt_getSize() != rbt2.rbt_getSize())
+				return false;
+			for(auto it1 = rbt1.begin(), it2 = rbt2.begin(); it1 != rbt1.end(); ++it1, ++it2)
+				if (it1->rbt_getKey() != it2->rbt_getKey() || it1->rbt_getData() != it2->rbt_getData())
+					return false;
+			return true;
+		};
+
+		if (!sameNodes(rbtEven.rbt_orParallel(rbtThird, 4), rbtEven | rbtThird) || !sameNodes(rbtEven.rbt_andParallel(rbtThird, 4), rbtEven & rbtThird))
+			throw;
+		if (!sameNodes(rbtEven.rbt_xorParallel(rbtThird, 4), rbtEven ^ rbtThird) || !sameNodes(rbtEven.rbt_subParallel(rbtThird, 4), rbtEven - rbtThird))
+			throw;
+
+			// A smaller tree only looks up the larger tree's matching runs, and the larger tree's side agrees with it
+		if (!sameNodes(rbtThird.rbt_andParallel(rbtEven, 4), rbtEven & rbtThird) || !sameNodes(rbtThird & rbtEven, rbtEven & rbtThird))
+			throw;
+		if (!sameNodes(rbtThird.rbt_subParallel(rbtEven, 4) + (rbtEven & rbtThird), rbtThird) || !sameNodes((rbtThird - rbtEven) + (rbtEven & rbtThird), rbtThird))
+			throw;
+
+			// Nodes taken over from the parts' pools are reused afterwards
+		rbtEven.rbt_orParallelI(rbtThird, 3);
+		rbtEven.rbt_subParallelI(rbtThird, 3);
+		rbtEven.rbt_orParallelI(rbtThird, 0);
+		if (rbtEven.rbt_getPool()->rbt_getLive() != rbtEven.rbt_getSize() || !sameNodes(rbtEven.rbt_andParallel(rbtEven, 2), rbtEven))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
 	cout << endl << "========================" << endl;
 }
 
+void rbt_concurrent_test() {
+	cout << endl << "TESTING 'RBT_concurrent.cpp'!" << endl << endl;
+
+	rbtConcurrentTree<int, int> rbt1;
+
+	try {
+		cout << "testing concurrent rbt_insert, rbt_searchKey, rbt_getSize..." << endl;
+		std::atomic<bool> failed(false);
+		std::vector<std::thread> workers;
+		for(int t=0; t<4; t++)
+			workers.emplace_back([&, t] () -> void {
+				int data;
+				for(int i=0; i<500; i++) {
+					rbt1.rbt_insert(t * 500 + i, -(t * 500 + i));
+					if (!rbt1.rbt_searchKey(t * 500 + i, data) || data != -(t * 500 + i))
+						failed = true;
+				}
+			});
+		for(int t=0; t<2; t++)
+			workers.emplace_back([&] () -> void {
+				int data;
+				for(int i=0; i<2000; i++)
+					if (rbt1.rbt_searchKey(i, data) && data != -i)
+						failed = true;
+			});
+		for(auto &worker : workers)
+			worker.join();
+		if (failed || rbt1.rbt_getSize() != 2000)
+			throw;
+		for(int i=0; i<2000; i++) {
+			int key, data;
+			if (!rbt1.rbt_nodeAt(i, key, data) || key != i || data != -i || rbt1.rbt_findIdxKey(i) != (size_t)i)
+				throw;
+		}
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing concurrent rbt_delete, rbt_deleteKey, rbt_repInsert, rbt_repDelete..." << endl;
+		std::vector<std::thread> workers;
+		for(int t=0; t<4; t++)
+			workers.emplace_back([&, t] () -> void {
+				for(int i=t; i<2000; i+=8)
+					if (t & 1)
+						rbt1.rbt_deleteKey(i);
+					else
+						rbt1.rbt_delete(i, -i);
+			});
+		workers.emplace_back([&] () -> void {
+			int keys[100], data[100];
+			for(int i=0; i<100; i++) {
+				keys[i] = 5000 + i;
+				data[i] = i;
+			}
+			rbt1.rbt_repInsert(100, keys, data);
+			rbt1.rbt_repDelete(50, keys, data);
+		});
+		for(auto &worker : workers)
+			worker.join();
+		if (rbt1.rbt_getSize() != 1050 || rbt1.rbt_search(0, 0) || !rbt1.rbt_search(4, -4) || !rbt1.rbt_search(5099, 99) || rbt1.rbt_search(5000, 0))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing rbt_read, rbt_write, rbt_snapshot..." << endl;
+		size_t between = rbt1.rbt_read([] (const rbTree<int, int> &rbt) -> size_t {
+			return rbt.rbt_findIdxKey(5050) - rbt.rbt_findIdxKey(1999);
+		});
+		rbt1.rbt_write([] (rbTree<int, int> &rbt) -> void {
+			rbt.rbt_clampKey(0, 1999);
+		});
+		rbTree<int, int> rbt2 = rbt1.rbt_snapshot();
+		if (between != 1 || rbt2.rbt_getSize() != 1000 || rbt1.rbt_countKey(5050) != 0 || rbt1.rbt_countRange(0, 999) != rbt2.rbt_countRange(0, 999))
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	cout << endl << "========================" << endl;
+}
+
+void rbt_snapshot_test() {
+	cout << endl << "TESTING 'RBT_snapshot.cpp'!" << endl << endl;
+
+	rbtSnapshotTree<int, int> rbt1;
+
+	try {
+		cout << "testing snapshot rbt_insert, rbt_delete, rbt_deleteKey, rbt_nodeAt, rbt_getRetired..." << endl;
+		for(int i=0; i<1000; i++)
+			rbt1.rbt_insert((i * 37) % 1000, i % 3);
+		rbt1.rbt_insert(500, 7);
+		if (rbt1.rbt_getSize() != 1001 || !rbt1.rbt_search(500, 7) || rbt1.rbt_search(500, 8))
+			throw;
+		if (!rbt1.rbt_delete(500, 7) || rbt1.rbt_delete(500, 7) || !rbt1.rbt_deleteKey(0) || rbt1.rbt_deleteKey(0))
+			throw;
+		for(int i=1; i<1000; i++) {
+			int key, data;
+			if (!rbt1.rbt_nodeAt(i - 1, key, data) || key != i || !rbt1.rbt_searchKey(i, data) || data != (i * 973) % 1000 % 3)
+				throw;
+		}
+		if (rbt1.rbt_getSize() != 999 || rbt1.rbt_getRetired() != 0)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing snapshot readers during concurrent writes..." << endl;
+		std::atomic<bool> failed(false), inside(false), written(false);
+		std::vector<std::thread> workers;
+		for(int t=0; t<2; t++)
+			workers.emplace_back([&, t] () -> void {
+				for(int i=0; i<500; i++) {
+					rbt1.rbt_insert(1000 + t * 500 + i, 0);
+					rbt1.rbt_deleteKey(1 + t * 500 + i % 499);
+				}
+			});
+		for(int t=0; t<2; t++)
+			workers.emplace_back([&] () -> void {
+				for(int i=0; i<50; i++) {
+					int last = -1;
+					rbt1.rbt_forRange(0, 2000, [&] (const int &key, const int &) -> void {
+						if (key < last)
+							failed = true;
+						last = key;
+					});
+				}
+			});
+		for(auto &worker : workers)
+			worker.join();
+
+			// A reader that stays inside keeps its version alive until it leaves
+		size_t seen = 0;
+		std::thread reader([&] () -> void {
+			rbt1.rbt_forRange(0, 2000, [&] (const int &, const int &) -> void {
+				if (!seen++) {
+					inside = true;
+					while(!written);
+				}
+			});
+		});
+		while(!inside);
+		rbt1.rbt_clear();
+		size_t held = rbt1.rbt_getRetired();
+		written = true;
+		reader.join();
+		if (failed || seen != 1001 || held != 1001 || rbt1.rbt_getRetired() != 0 || rbt1.rbt_getSize() != 0)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+
+	try {
+		cout << "testing snapshot rbt_snapshot..." << endl;
+		for(int i=0; i<100; i++)
+			rbt1.rbt_insert(i, -i);
+		rbTree<int, int> rbt2 = rbt1.rbt_snapshot();
+		rbt1.rbt_deleteKey(50);
+		if (rbt2.rbt_getSize() != 100 || rbt2.rbt_searchKey(50)->rbt_getData() != -50 || rbt1.rbt_getSize() != 99)
+			throw;
+	} catch (...) {
+		exit(0);
+	}
+}
+
 int main() {
 	rbt_main_test();
+	rbt_pool_test();
+	rbt_iterator_test();
 	rbt_string_test();
 	rbt_traversal_test();
 	rbt_access_test();
@@ -1491,6 +2580,8 @@ int main() {
 	rbt_value_test();
 	rbt_ops_test();
 	rbt_setops_test();
+	rbt_concurrent_test();
+	rbt_snapshot_test();
 
 	return 0;
 }
\ No newline at end of file
@@ -14,12 +14,6 @@
  |				insert and delete operations.									|
  \=============================================================================*/
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-	inline void **nodePtr;
-	inline std::byte *basePtr;
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                     	         PRE ORDER                                  | */
@@ -28,79 +22,84 @@ namespace {
 
 /*
  * function_identifier: Returns an array of all rbtNodes, in the given red-black tree, via a preorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPre(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPre(rbtNode<K,D> *curr, rbtNode<K,D> **&nodePtr) const {
 		// Saves the node at the current index
 	*nodePtr = curr;
-		// Increments the global pointer index
+		// Increments the pointer index
 	nodePtr++;
 
 		// Performs preorder traversal
-	if(curr->left) nodesPre(curr->left);
-	if(curr->right) nodesPre(curr->right);
+	if(curr->left) nodesPre(curr->left, nodePtr);
+	if(curr->right) nodesPre(curr->right, nodePtr);
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given key, in the given red-black tree, via an preorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given key (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given key (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPreWithKey(rbtNode<K,D> *curr, K key) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPreWithKey(rbtNode<K,D> *curr, K key, rbtNode<K,D> **&nodePtr) const {
+		// Compares once, and skips the branches that can not hold the key
+	int cmp = C::key(key, curr->key);
 		// Checks if the current tree has the correct key
-	if (key == curr->key) {
+	if (!cmp) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
 
 		// Performs preorder traversal
-	if(curr->left) nodesPreWithKey(curr->left, key);
-	if(curr->right) nodesPreWithKey(curr->right, key);
+	if(curr->left && cmp <= 0) nodesPreWithKey(curr->left, key, nodePtr);
+	if(curr->right && cmp >= 0) nodesPreWithKey(curr->right, key, nodePtr);
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data, in the given red-black tree, via an preorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given data (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given data (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPreWithData(rbtNode<K,D> *curr, D data) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPreWithData(rbtNode<K,D> *curr, D data, rbtNode<K,D> **&nodePtr) const {
 		// Checks if the current tree has the correct data
-	if (data == curr->data) {
+	if (C::data(data, curr->data) == 0) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
 
 		// Performs preorder traversal
-	if(curr->left) nodesPreWithData(curr->left, data);
-	if(curr->right) nodesPreWithData(curr->right, data);
+	if(curr->left) nodesPreWithData(curr->left, data, nodePtr);
+	if(curr->right) nodesPreWithData(curr->right, data, nodePtr);
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data and key, in the given red-black tree, via an preorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given data (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given data (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPreWithDataKey(rbtNode<K,D> *curr, D data, K key) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPreWithDataKey(rbtNode<K,D> *curr, D data, K key, rbtNode<K,D> **&nodePtr) const {
+		// Compares once, by key and then data, and skips the branches that can not hold the pair
+	int cmp = C::key(key, curr->key);
+	if (!cmp) cmp = C::data(data, curr->data);
 		// Checks if the current tree has the correct data
-	if (data == curr->data) {
+	if (!cmp) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
 
-		// Performs preorder traversal on nodes with the correct key
-	if(curr->left && curr->left->key == key) nodesPreWithDataKey(curr->left, data, key);
-	if(curr->right && curr->right->key == key) nodesPreWithDataKey(curr->right, data, key);
+		// Performs preorder traversal on the branches that can hold the key and data
+	if(curr->left && cmp <= 0) nodesPreWithDataKey(curr->left, data, key, nodePtr);
+	if(curr->right && cmp >= 0) nodesPreWithDataKey(curr->right, data, key, nodePtr);
 }
 
 /*	============================================================================  */
@@ -111,75 +110,82 @@ void rbTree<K,D>::nodesPreWithDataKey(rbtNode<K,D> *curr, D data, K key) const {
 
 /*
  * function_identifier: Returns an array of all rbtNodes, in the given red-black tree, via an inorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesIn(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesIn(rbtNode<K,D> *curr, rbtNode<K,D> **&nodePtr) const {
 		// Performs inorder traversal
-	if(curr->left) nodesIn(curr->left);
+	if(curr->left) nodesIn(curr->left, nodePtr);
 		// Saves the node at the current index
 	*nodePtr = curr;
-		// Increments the global pointer index
+		// Increments the pointer index
 	nodePtr++;
-	if(curr->right) nodesIn(curr->right);
+	if(curr->right) nodesIn(curr->right, nodePtr);
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given key, in the given red-black tree, via an inorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given key (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given key (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesInWithKey(rbtNode<K,D> *curr, K key) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesInWithKey(rbtNode<K,D> *curr, K key, rbtNode<K,D> **&nodePtr) const {
+		// Compares once, and skips the branches that can not hold the key
+	int cmp = C::key(key, curr->key);
+
 		// Performs inorder traversal
-	if(curr->left) nodesInWithKey(curr->left, key);
+	if(curr->left && cmp <= 0) nodesInWithKey(curr->left, key, nodePtr);
 		// Checks if the current tree has the correct kay
-	if (key == curr->key) {
+	if (!cmp) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
-	if(curr->right) nodesInWithKey(curr->right, key);
+	if(curr->right && cmp >= 0) nodesInWithKey(curr->right, key, nodePtr);
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data, in the given red-black tree, via an inorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given data (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given data (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesInWithData(rbtNode<K,D> *curr, D data) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesInWithData(rbtNode<K,D> *curr, D data, rbtNode<K,D> **&nodePtr) const {
 		// Performs inorder traversal
-	if(curr->left) nodesInWithData(curr->left, data);
+	if(curr->left) nodesInWithData(curr->left, data, nodePtr);
 		// Checks if the current tree has the correct data
-	if (data == curr->data) {
+	if (C::data(data, curr->data) == 0) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
-	if(curr->right) nodesInWithData(curr->right, data);
+	if(curr->right) nodesInWithData(curr->right, data, nodePtr);
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data and key, in the given red-black tree, via an inorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given data (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given data (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesInWithDataKey(rbtNode<K,D> *curr, D data, K key) const {
-		// Performs inorder traversal on nodes with the correct key
-	if(curr->left && curr->left->key == key) nodesInWithDataKey(curr->left, data, key);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesInWithDataKey(rbtNode<K,D> *curr, D data, K key, rbtNode<K,D> **&nodePtr) const {
+		// Compares once, by key and then data, and skips the branches that can not hold the pair
+	int cmp = C::key(key, curr->key);
+	if (!cmp) cmp = C::data(data, curr->data);
+
+		// Performs inorder traversal on the branches that can hold the key and data
+	if(curr->left && cmp <= 0) nodesInWithDataKey(curr->left, data, key, nodePtr);
 		// Checks if the current tree has the correct data
-	if (data == curr->data) {
+	if (!cmp) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
-	if(curr->right && curr->right->key == key) nodesInWithDataKey(curr->right, data, key);
+	if(curr->right && cmp >= 0) nodesInWithDataKey(curr->right, data, key, nodePtr);
 }
 
 /*	============================================================================  */
@@ -191,72 +197,79 @@ void rbTree<K,D>::nodesInWithDataKey(rbtNode<K,D> *curr, D data, K key) const {
 /*
  * function_identifier: Returns an array of all rbtNodes, in the given red-black tree, via a postorder traversal
  * parameters: 			A pointer to a red-black tree
- * return value:		An array of rbtNodes (return by reference [global variable])
+ * return value:		An array of rbtNodes (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPost(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPost(rbtNode<K,D> *curr, rbtNode<K,D> **&nodePtr) const {
 		// Performs postorder traversal
-	if(curr->left) nodesPost(curr->left);
-	if(curr->right) nodesPost(curr->right);
+	if(curr->left) nodesPost(curr->left, nodePtr);
+	if(curr->right) nodesPost(curr->right, nodePtr);
 		// Saves the node at the current index
 	*nodePtr = curr;
-		// Increments the global pointer index
+		// Increments the pointer index
 	nodePtr++;
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given key, in the given red-black tree, via an postorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given key (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given key (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPostWithKey(rbtNode<K,D> *curr, K key) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPostWithKey(rbtNode<K,D> *curr, K key, rbtNode<K,D> **&nodePtr) const {
+		// Compares once, and skips the branches that can not hold the key
+	int cmp = C::key(key, curr->key);
+
 		// Performs postorder traversal
-	if(curr->left) nodesPostWithKey(curr->left, key);
-	if(curr->right) nodesPostWithKey(curr->right, key);
+	if(curr->left && cmp <= 0) nodesPostWithKey(curr->left, key, nodePtr);
+	if(curr->right && cmp >= 0) nodesPostWithKey(curr->right, key, nodePtr);
 		// Checks if the current tree has the correct key
-	if (key == curr->key) {
+	if (!cmp) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data, in the given red-black tree, via an postorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given data (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given data (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPostWithData(rbtNode<K,D> *curr, D data) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPostWithData(rbtNode<K,D> *curr, D data, rbtNode<K,D> **&nodePtr) const {
 		// Performs postorder traversal
-	if(curr->left) nodesPostWithData(curr->left, data);
-	if(curr->right) nodesPostWithData(curr->right, data);
+	if(curr->left) nodesPostWithData(curr->left, data, nodePtr);
+	if(curr->right) nodesPostWithData(curr->right, data, nodePtr);
 		// Checks if the current tree has the correct data
-	if (data == curr->data) {
+	if (C::data(data, curr->data) == 0) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data and key, in the given red-black tree, via an postorder traversal
- * parameters: 			A pointer to a node in the red-black tree
- * return value:		An array of rbtNodes that have the given data (return by reference [global variable])
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given data (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesPostWithDataKey(rbtNode<K,D> *curr, D data, K key) const {
-		// Performs postorder traversal on nodes with the correct key
-	if(curr->left && curr->left->key == key) nodesPostWithDataKey(curr->left, data, key);
-	if(curr->right && curr->right->key == key) nodesPostWithDataKey(curr->right, data, key);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesPostWithDataKey(rbtNode<K,D> *curr, D data, K key, rbtNode<K,D> **&nodePtr) const {
+		// Compares once, by key and then data, and skips the branches that can not hold the pair
+	int cmp = C::key(key, curr->key);
+	if (!cmp) cmp = C::data(data, curr->data);
+
+		// Performs postorder traversal on the branches that can hold the key and data
+	if(curr->left && cmp <= 0) nodesPostWithDataKey(curr->left, data, key, nodePtr);
+	if(curr->right && cmp >= 0) nodesPostWithDataKey(curr->right, data, key, nodePtr);
 		// Checks if the current tree has the correct data
-	if (data == curr->data) {
+	if (!cmp) {
 			// Saves the node at the current index
 		*nodePtr = curr;
-			// Increments the global pointer index
+			// Increments the pointer index
 		nodePtr++;
 	}
 }
@@ -269,14 +282,14 @@ void rbTree<K,D>::nodesPostWithDataKey(rbtNode<K,D> *curr, D data, K key) const
 
 /*
  * function_identifier: Returns an array of all rbtNodes, in the given red-black tree, via a levelorder traversal
- * parameters: 			N/A
- * return value:		An array of rbtNodes (return by reference [global variable])
+ * parameters: 			The array position to write to (return by reference)
+ * return value:		An array of rbtNodes (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesLevel() const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesLevel(rbtNode<K,D> **&nodePtr) const {
 		// Initializes values
 	rbtNode<K,D> **startPtr, **endPtr;
-	startPtr = endPtr = (rbtNode<K,D> **)nodePtr;
+	startPtr = endPtr = nodePtr;
 
 		// Places the root in the queue
 	*startPtr = root; endPtr++;
@@ -292,33 +305,36 @@ void rbTree<K,D>::nodesLevel() const {
 			// Moves forward in queue
 		startPtr++;
 	}
+		// Moves the pointer index past the copied nodes
+	nodePtr = endPtr;
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given key, in the given red-black tree, via a levelorder traversal
- * parameters: 			N/A
- * return value:		An array of rbtNodes that have the given key (return by reference [global variable])
+ * parameters: 			The array position to write to (return by reference)
+ * return value:		An array of rbtNodes that have the given key (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesLevelWithKey(K key) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesLevelWithKey(K key, rbtNode<K,D> **&nodePtr) const {
 		// Initializes the queue and shift values
-	rbtNode<K,D> **queue = new rbtNode<K,D>*[size], **queueNext = queue + 1, **startPtr = (rbtNode<K,D> **)nodePtr;
+	rbtNode<K,D> **queue = new rbtNode<K,D>*[size], **queueNext = queue + 1;
 	rbtNode<K,D> **queueSt = queue;
 
 		// Places all nodes into queue
 		// Only places nodes, with requested key, into the return array
 	for(*queue = root; queueNext != queue; queue++) {
 			// Checks if node has requested key
-		if((*queue)->key == key)
+		int cmp = C::key(key, (*queue)->key);
+		if(!cmp)
 				// If so, place it in the return array
-			*startPtr++ = *queue;
+			*nodePtr++ = *queue;
 
-			// Checks if left branch exists
-		if((*queue)->left)
+			// Checks if left branch exists, and can hold the key
+		if((*queue)->left && cmp <= 0)
 				// If so, place left child at next position in queue and update the next available position
 			*queueNext++ = (*queue)->left;
-			// Checks if right branch exists
-		if((*queue)->right)
+			// Checks if right branch exists, and can hold the key
+		if((*queue)->right && cmp >= 0)
 				// If so, place left child at next position in queue
 			*queueNext++ = (*queue)->right;
 	}
@@ -329,22 +345,22 @@ void rbTree<K,D>::nodesLevelWithKey(K key) const {
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data, in the given red-black tree, via a levelorder traversal
- * parameters: 			N/A
- * return value:		An array of rbtNodes (return by reference [global variable])
+ * parameters: 			The array position to write to (return by reference)
+ * return value:		An array of rbtNodes (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesLevelWithData(D data) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesLevelWithData(D data, rbtNode<K,D> **&nodePtr) const {
 		// Initializes the queue and shift values
-	rbtNode<K,D> **queue = new rbtNode<K,D>*[size], **queueNext = queue + 1, **startPtr = (rbtNode<K,D> **)nodePtr;
+	rbtNode<K,D> **queue = new rbtNode<K,D>*[size], **queueNext = queue + 1;
 	rbtNode<K,D> **queueSt = queue;
 
 		// Places all nodes into queue
 		// Only places nodes, with requested data, into the return array
 	for(*queue = root; queueNext != queue; queue++) {
 			// Checks if node has requested data
-		if((*queue)->data == data)
+		if(C::data((*queue)->data, data) == 0)
 				// If so, place it in the return array
-			*startPtr++ = *queue;
+			*nodePtr++ = *queue;
 
 			// Checks if left branch exists
 		if((*queue)->left)
@@ -362,29 +378,31 @@ void rbTree<K,D>::nodesLevelWithData(D data) const {
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data and key, in the given red-black tree, via a levelorder traversal
- * parameters: 			N/A
- * return value:		An array of rbtNodes (return by reference [global variable])
+ * parameters: 			The array position to write to (return by reference)
+ * return value:		An array of rbtNodes (return by reference)
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodesLevelWithDataKey(D data, K key) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::nodesLevelWithDataKey(D data, K key, rbtNode<K,D> **&nodePtr) const {
 		// Initializes the queue and shift values
-	rbtNode<K,D> **queue = new rbtNode<K,D>*[size], **queueNext = queue + 1, **startPtr = (rbtNode<K,D> **)nodePtr;
+	rbtNode<K,D> **queue = new rbtNode<K,D>*[size], **queueNext = queue + 1;
 	rbtNode<K,D> **queueSt = queue;
 
 		// Places all nodes into queue
 		// Only places nodes, with requested key and data pair, into the return array
 	for(*queue = root; queueNext != queue; queue++) {
 			// Checks if node has requested key and data pair
-		if((*queue)->key == key && (*queue)->data == data)
+		int cmp = C::key(key, (*queue)->key);
+		if (!cmp) cmp = C::data(data, (*queue)->data);
+		if(!cmp)
 				// If so, place it in the return array
-			*startPtr++ = *queue;
+			*nodePtr++ = *queue;
 
-			// Checks if left branch exists
-		if((*queue)->left)
+			// Checks if left branch exists, and can hold the pair
+		if((*queue)->left && cmp <= 0)
 				// If so, place left child at next position in queue and update the next available position
 			*queueNext++ = (*queue)->left;
-			// Checks if right branch exists
-		if((*queue)->right)
+			// Checks if right branch exists, and can hold the pair
+		if((*queue)->right && cmp >= 0)
 				// If so, place left child at next position in queue
 			*queueNext++ = (*queue)->right;
 	}
@@ -401,14 +419,14 @@ void rbTree<K,D>::nodesLevelWithDataKey(D data, K key) const {
 
 /*
  * function_identifier: The base template for PRINT_LEVEL node access traversing
- * parameters: 			The level to access, a rbtNode with a key/data pair criteria, and a function to filter the level's nodes with
- * return value:		An array of rbtNodes (return by reference [global variable]) and the number of nodes (return by value)
+ * parameters: 			An array to write the rbtNodes into, the level to access, a rbtNode with a key/data pair criteria, and a function to filter the level's nodes with
+ * return value:		An array of rbtNodes (return by reference) and the number of nodes (return by value)
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-inline size_t rbTree<K,D>::nodesSpecifiedLevelBase(size_t level, rbtNode<K,D> filter, F foo) const {
+inline size_t rbTree<K,D,C>::nodesSpecifiedLevelBase(rbtNode<K,D> **nodeArray, size_t level, rbtNode<K,D> filter, F foo) const {
 		// Initializes the need variables
-	rbtNode<K,D> **nodeE, **nodeS, **nodeM, **nodeArray = (rbtNode<K,D> **)nodePtr, *temp;
+	rbtNode<K,D> **nodeE, **nodeS, **nodeM, *temp;
 	size_t nodes = (1 << level), offset = (nodes >> 1), shift = 0;
 	*nodeArray = root; nodeE = nodeArray + nodes;
 
@@ -445,28 +463,28 @@ inline size_t rbTree<K,D>::nodesSpecifiedLevelBase(size_t level, rbtNode<K,D> fi
 
 /*
  * function_identifier: Returns an array of all rbtNodes, in the given red-black tree, at a specified level
- * parameters: 			The level to extract rbtNodes from
- * return value:		An array of rbtNodes (return by reference [global variable]) and the number of nodes (return by value)
+ * parameters: 			An array to write the rbtNodes into and the level to extract rbtNodes from
+ * return value:		An array of rbtNodes (return by reference) and the number of nodes (return by value)
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::nodesSpecifiedLevel(size_t level) const {
-	return nodesSpecifiedLevelBase(level, rbtNode<K,D>(K(), D()), [] (...) -> void {});
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::nodesSpecifiedLevel(rbtNode<K,D> **nodeArray, size_t level) const {
+	return nodesSpecifiedLevelBase(nodeArray, level, rbtNode<K,D>(K(), D()), [] (...) -> void {});
 }
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given key, in the given red-black tree, at a specified level
- * parameters: 			The level to extract nodes from and a key criteria
- * return value:		An array of rbtNodes (return by reference [global variable]) and the number of nodes (return by value)
+ * parameters: 			An array to write the rbtNodes into, the level to extract nodes from and a key criteria
+ * return value:		An array of rbtNodes (return by reference) and the number of nodes (return by value)
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::nodesSpecifiedLevelWithKey(size_t level, K key) const {
-	return nodesSpecifiedLevelBase(level, rbtNode<K,D>(key, D()), [] (rbtNode<K,D> **&nodeE, rbtNode<K,D> **nodeS, rbtNode<K,D> filter) -> void {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::nodesSpecifiedLevelWithKey(rbtNode<K,D> **nodeArray, size_t level, K key) const {
+	return nodesSpecifiedLevelBase(nodeArray, level, rbtNode<K,D>(key, D()), [] (rbtNode<K,D> **&nodeE, rbtNode<K,D> **nodeS, rbtNode<K,D> filter) -> void {
 			// Initializes the need variables
 		rbtNode<K,D> **nodeM = nodeS;
 			// Cycles through all nodes in the current level
 		while(nodeS < nodeE) {
 				// If node exists and is of the desired key, place it in the next available spot
-			if ((*nodeS) && (*nodeS)->key == filter.key)
+			if ((*nodeS) && C::key((*nodeS)->key, filter.key) == 0)
 				*nodeM++ = (*nodeS);
 				// Increment the node index
 			nodeS++;
@@ -478,18 +496,18 @@ size_t rbTree<K,D>::nodesSpecifiedLevelWithKey(size_t level, K key) const {
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data, in the given red-black tree, at a specified level
- * parameters: 			The level to extract rbtNodes from and a data criteria
- * return value:		An array of rbtNodes (return by reference [global variable]) and the number of nodes (return by value)
+ * parameters: 			An array to write the rbtNodes into, the level to extract rbtNodes from and a data criteria
+ * return value:		An array of rbtNodes (return by reference) and the number of nodes (return by value)
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::nodesSpecifiedLevelWithData(size_t level, D data) const {
-	return nodesSpecifiedLevelBase(level, rbtNode<K,D>(K(), data), [] (rbtNode<K,D> **&nodeE, rbtNode<K,D> **nodeS, rbtNode<K,D> filter) -> void {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::nodesSpecifiedLevelWithData(rbtNode<K,D> **nodeArray, size_t level, D data) const {
+	return nodesSpecifiedLevelBase(nodeArray, level, rbtNode<K,D>(K(), data), [] (rbtNode<K,D> **&nodeE, rbtNode<K,D> **nodeS, rbtNode<K,D> filter) -> void {
 			// Initializes the need variables
 		rbtNode<K,D> **nodeM = nodeS;
 			// Cycles through all nodes in the current level
 		while(nodeS < nodeE) {
 				// If node exists and is of the desired key, place it in the next available spot
-			if ((*nodeS) && (*nodeS)->data == filter.data)
+			if ((*nodeS) && C::data((*nodeS)->data, filter.data) == 0)
 				*nodeM++ = (*nodeS);
 				// Increment the node index
 			nodeS++;
@@ -501,18 +519,18 @@ size_t rbTree<K,D>::nodesSpecifiedLevelWithData(size_t level, D data) const {
 
 /*
  * function_identifier: Returns an array of all rbtNodes that have the given data/key pair, in the given red-black tree, at a specified level
- * parameters: 			The level to extract rbtNodes from and a data/key pair criteria
- * return value:		An array of rbtNodes (return by reference [global variable]) and the number of nodes (return by value)
+ * parameters: 			An array to write the rbtNodes into, the level to extract rbtNodes from and a data/key pair criteria
+ * return value:		An array of rbtNodes (return by reference) and the number of nodes (return by value)
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::nodesSpecifiedLevelWithDataKey(size_t level, D data, K key) const {
-	return nodesSpecifiedLevelBase(level, rbtNode<K,D>(key, data), [] (rbtNode<K,D> **&nodeE, rbtNode<K,D> **nodeS, rbtNode<K,D> filter) -> void {
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::nodesSpecifiedLevelWithDataKey(rbtNode<K,D> **nodeArray, size_t level, D data, K key) const {
+	return nodesSpecifiedLevelBase(nodeArray, level, rbtNode<K,D>(key, data), [] (rbtNode<K,D> **&nodeE, rbtNode<K,D> **nodeS, rbtNode<K,D> filter) -> void {
 			// Initializes the need variables
 		rbtNode<K,D> **nodeM = nodeS;
 			// Cycles through all nodes in the current level
 		while(nodeS < nodeE) {
 				// If node exists and is of the desired key, place it in the next available spot
-			if ((*nodeS) && (*nodeS)->key == filter.key && (*nodeS)->data == filter.data)
+			if ((*nodeS) && C::key((*nodeS)->key, filter.key) == 0 && C::data((*nodeS)->data, filter.data) == 0)
 				*nodeM++ = (*nodeS);
 				// Increment the node index
 			nodeS++;
@@ -535,8 +553,8 @@ size_t rbTree<K,D>::nodesSpecifiedLevelWithDataKey(size_t level, D data, K key)
  * parameters: 			An array of rbtNodes and the expected length
  * return value:		The resized array of rbtNodes
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::resize_helper(rbtNode<K,D> **nodeArray, size_t nodes) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::resize_helper(rbtNode<K,D> **nodeArray, size_t nodes) const {
 		// Allocates new memory
 	rbtNode<K,D> **tempPlace = nodeArray, **endArray;
 	nodeArray = new rbtNode<K,D>*[nodes]; endArray = nodeArray + nodes;
@@ -544,7 +562,7 @@ rbtNode<K,D> **rbTree<K,D>::resize_helper(rbtNode<K,D> **nodeArray, size_t nodes
 	while(nodeArray != endArray)
 		*nodeArray++ = *tempPlace++;
 		// Deletes old array
-	delete [] (rbtNode<K,D> **)(nodePtr - nodes);
+	delete [] (tempPlace - nodes);
 		// Returns new array's address
 	return nodeArray - nodes;
 }
@@ -556,20 +574,19 @@ rbtNode<K,D> **rbTree<K,D>::resize_helper(rbtNode<K,D> **nodeArray, size_t nodes
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodes(enum rbtraversal traversal) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodes(enum rbtraversal traversal) const {
 		// Returns NULL if invaild
 	if(!root || traversal == TEST_ORDER || traversal == PRINT_LEVEL)
 		return NULL;
 		// Allocates enough memory to hold all nodes in
-	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[size];
-	nodePtr = (void **)nodeArray;
+	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[size], **nodePtr = nodeArray;
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPre(root); break;
-		case IN_ORDER:			nodesIn(root); break;
-		case POST_ORDER:		nodesPost(root); break;
-		case LEVEL_ORDER:		nodesLevel(); break;
+		case PRE_ORDER:			nodesPre(root, nodePtr); break;
+		case IN_ORDER:			nodesIn(root, nodePtr); break;
+		case POST_ORDER:		nodesPost(root, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevel(nodePtr); break;
 		default:;
 	}
 		// Returns the nodeArray
@@ -582,19 +599,19 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodes(enum rbtraversal traversal) const {
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodes(rbtNode<K,D> **nodeArray, enum rbtraversal traversal) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodes(rbtNode<K,D> **nodeArray, enum rbtraversal traversal) const {
 		// Returns NULL if invaild
 	if(!root || traversal == TEST_ORDER || traversal == PRINT_LEVEL)
 		return NULL;
-		// Coverts the array into void pointer
-	nodePtr = (void **)nodeArray;
+		// Starts the pointer index at the front of the array
+	rbtNode<K,D> **nodePtr = nodeArray;
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPre(root); break;
-		case IN_ORDER:			nodesIn(root); break;
-		case POST_ORDER:		nodesPost(root); break;
-		case LEVEL_ORDER:		nodesLevel(); break;
+		case PRE_ORDER:			nodesPre(root, nodePtr); break;
+		case IN_ORDER:			nodesIn(root, nodePtr); break;
+		case POST_ORDER:		nodesPost(root, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevel(nodePtr); break;
 		default:;
 	}
 		// Returns the nodeArray
@@ -606,15 +623,14 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodes(rbtNode<K,D> **nodeArray, enum rbtra
  * parameters: 			The level to extract data from and an address to return the number of nodes copied (return by reference)
  * return value:		An array of rbtNodes (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesAtLevel(size_t &nodes, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesAtLevel(size_t &nodes, size_t level) const {
 		// Returns NULL if invaild
 	if(!root) return NULL;
 		// Allocates enough memory to hold all nodes in
 	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[1 << level];
-	nodePtr = (void **)nodeArray;
 		// Writes all the nodes into nodeArray
-	nodes = nodesSpecifiedLevel(level);
+	nodes = nodesSpecifiedLevel(nodeArray, level);
 
 		// Checks if resize is needed, if so, resize array to match nodes copied
 	if (nodes < ((size_t)1 << level))
@@ -630,15 +646,12 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesAtLevel(size_t &nodes, size_t level)
  * parameters: 			The level to extract data from and an address to return the number of nodes copied (return by reference)
  * return value:		An array of rbtNodes (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesAtLevel(rbtNode<K,D> **nodeArray, size_t &nodes, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesAtLevel(rbtNode<K,D> **nodeArray, size_t &nodes, size_t level) const {
 		// Returns NULL if invaild
 	if(!root) return 0;
-		// Coverts the array into void pointer
-	nodePtr = (void **)nodeArray;
 		// Writes all the nodes into nodeArray
-
-	nodes = nodesSpecifiedLevel(level);
+	nodes = nodesSpecifiedLevel(nodeArray, level);
 
 		// Returns the nodeArray
 	return nodeArray;
@@ -651,8 +664,8 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesAtLevel(rbtNode<K,D> **nodeArray, siz
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes that have the given key (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithKey(K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesWithKey(K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
 		// Returns NULL if invaild
 	if(!root || traversal == TEST_ORDER)
 		return NULL;
@@ -660,31 +673,27 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithKey(K key, size_t &nodes, enum rb
 	if (traversal == PRINT_LEVEL) {
 			// Allocates enough memory to hold all nodes in
 		rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[1 << level];
-		nodePtr = (void **)nodeArray;
 			// Writes all the nodes into nodeArray
-		nodes = nodesSpecifiedLevelWithKey(level, key);
+		nodes = nodesSpecifiedLevelWithKey(nodeArray, level, key);
 			// Checks if resize is needed, if so, resize array to match nodes copied
 		if (nodes < ((size_t)1 << level))
 			return resize_helper(nodeArray, nodes);
 			// Returns the nodeArray
 		return nodeArray;
 	}
+		// Counts the nodes with the key (they are all in one in-order range), so the array is only as large as needed
+	auto range = rbt_equalRange(key);
+	for(nodes = 0; range.first != range.second; ++range.first) nodes++;
 		// Allocates enough memory to hold all nodes in
-	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[size];
-	nodePtr = (void **)nodeArray;
+	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[nodes], **nodePtr = nodeArray;
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPreWithKey(root, key); break;
-		case IN_ORDER:			nodesInWithKey(root, key); break;
-		case POST_ORDER:		nodesPostWithKey(root, key); break;
-		case LEVEL_ORDER:		nodesLevelWithKey(key); break;
+		case PRE_ORDER:			nodesPreWithKey(root, key, nodePtr); break;
+		case IN_ORDER:			nodesInWithKey(root, key, nodePtr); break;
+		case POST_ORDER:		nodesPostWithKey(root, key, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevelWithKey(key, nodePtr); break;
 		default:;
 	}
-		// Calculate the number of nodes put into the return array
-	nodes = (nodePtr - (void **)nodeArray);
-		// Checks if resize is needed, if so, resize array to match nodes copied
-	if (nodes < size)
-		return resize_helper(nodeArray, nodes);
 		// Returns the nodeArray
 	return nodeArray;
 }
@@ -695,30 +704,30 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithKey(K key, size_t &nodes, enum rb
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes that have the given key (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithKey(rbtNode<K,D> **nodeArray, K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesWithKey(rbtNode<K,D> **nodeArray, K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
 		// Returns NULL if invaild
 	if(!root || traversal == TEST_ORDER)
 		return NULL;
-		// Coverts the array into void pointer
-	nodePtr = (void **)nodeArray;
+		// Starts the pointer index at the front of the array
+	rbtNode<K,D> **nodePtr = nodeArray;
 		// Branches off if PRINT_LEVEL
 	if (traversal == PRINT_LEVEL) {
 			// Writes all the nodes into nodeArray
-		nodes = nodesSpecifiedLevelWithKey(level, key);
+		nodes = nodesSpecifiedLevelWithKey(nodeArray, level, key);
 			// Returns the nodeArray
 		return nodeArray;
 	}
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPreWithKey(root, key); break;
-		case IN_ORDER:			nodesInWithKey(root, key); break;
-		case POST_ORDER:		nodesPostWithKey(root, key); break;
-		case LEVEL_ORDER:		nodesLevelWithKey(key); break;
+		case PRE_ORDER:			nodesPreWithKey(root, key, nodePtr); break;
+		case IN_ORDER:			nodesInWithKey(root, key, nodePtr); break;
+		case POST_ORDER:		nodesPostWithKey(root, key, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevelWithKey(key, nodePtr); break;
 		default:;
 	}
 		// Calculate the number of nodes put into the return array
-	nodes = (nodePtr - (void **)nodeArray);
+	nodes = (nodePtr - nodeArray);
 		// Returns the nodeArray
 	return nodeArray;
 }
@@ -730,8 +739,8 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithKey(rbtNode<K,D> **nodeArray, K k
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes that have the given data (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithData(D data, size_t &nodes, enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesWithData(D data, size_t &nodes, enum rbtraversal traversal, size_t level) const {
 		// Returns NULL if invaild
 	if(!root || traversal == TEST_ORDER)
 		return NULL;
@@ -739,9 +748,8 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithData(D data, size_t &nodes, enum
 	if (traversal == PRINT_LEVEL) {
 			// Allocates enough memory to hold all nodes in
 		rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[1 << level];
-		nodePtr = (void **)nodeArray;
 			// Writes all the nodes into nodeArray
-		nodes = nodesSpecifiedLevelWithData(level, data);
+		nodes = nodesSpecifiedLevelWithData(nodeArray, level, data);
 			// Checks if resize is needed, if so, resize array to match nodes copied
 		if (nodes < ((size_t)1 << level))
 			return resize_helper(nodeArray, nodes);
@@ -749,18 +757,17 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithData(D data, size_t &nodes, enum
 		return nodeArray;
 	}
 		// Allocates enough memory to hold all nodes in
-	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[size];
-	nodePtr = (void **)nodeArray;
+	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[size], **nodePtr = nodeArray;
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPreWithData(root, data); break;
-		case IN_ORDER:			nodesInWithData(root, data); break;
-		case POST_ORDER:		nodesPostWithData(root, data); break;
-		case LEVEL_ORDER:		nodesLevelWithData(data); break;
+		case PRE_ORDER:			nodesPreWithData(root, data, nodePtr); break;
+		case IN_ORDER:			nodesInWithData(root, data, nodePtr); break;
+		case POST_ORDER:		nodesPostWithData(root, data, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevelWithData(data, nodePtr); break;
 		default:;
 	}
 		// Calculate the number of nodes put into the return array
-	nodes = (nodePtr - (void **)nodeArray);
+	nodes = (nodePtr - nodeArray);
 		// Checks if resize is needed, if so, resize array to match nodes copied
 	if (nodes < size)
 		return resize_helper(nodeArray, nodes);
@@ -774,30 +781,30 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithData(D data, size_t &nodes, enum
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes that have the given data (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithData(rbtNode<K,D> **nodeArray, D data, size_t &nodes, enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesWithData(rbtNode<K,D> **nodeArray, D data, size_t &nodes, enum rbtraversal traversal, size_t level) const {
 		// Returns NULL if invaild
 	if(!root || traversal == TEST_ORDER)
 		return NULL;
-		// Coverts the array into void pointer
-	nodePtr = (void **)nodeArray;
+		// Starts the pointer index at the front of the array
+	rbtNode<K,D> **nodePtr = nodeArray;
 		// Branches off if PRINT_LEVEL
 	if (traversal == PRINT_LEVEL) {
 			// Writes all the nodes into nodeArray
-		nodes = nodesSpecifiedLevelWithData(level, data);
+		nodes = nodesSpecifiedLevelWithData(nodeArray, level, data);
 			// Returns the nodeArray
 		return nodeArray;
 	}
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPreWithData(root, data); break;
-		case IN_ORDER:			nodesInWithData(root, data); break;
-		case POST_ORDER:		nodesPostWithData(root, data); break;
-		case LEVEL_ORDER:		nodesLevelWithData(data); break;
+		case PRE_ORDER:			nodesPreWithData(root, data, nodePtr); break;
+		case IN_ORDER:			nodesInWithData(root, data, nodePtr); break;
+		case POST_ORDER:		nodesPostWithData(root, data, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevelWithData(data, nodePtr); break;
 		default:;
 	}
 		// Calculate the number of nodes put into the return array
-	nodes = (nodePtr - (void **)nodeArray);
+	nodes = (nodePtr - nodeArray);
 		// Returns the nodeArray
 	return nodeArray;
 }
@@ -809,8 +816,8 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithData(rbtNode<K,D> **nodeArray, D
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes that have the given data (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(D data, K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesWithDataKey(D data, K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
 		// Returns NULL if invaild
 	if(traversal == TEST_ORDER)
 		return NULL;
@@ -818,9 +825,8 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(D data, K key, size_t &no
 	if (traversal == PRINT_LEVEL) {
 			// Allocates enough memory to hold all nodes in
 		rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[1 << level];
-		nodePtr = (void **)nodeArray;
 			// Writes all the nodes into nodeArray
-		nodes = nodesSpecifiedLevelWithDataKey(level, data, key);
+		nodes = nodesSpecifiedLevelWithDataKey(nodeArray, level, data, key);
 			// Checks if resize is needed, if so, resize array to match nodes copied
 		if (nodes < ((size_t)1 << level))
 			return resize_helper(nodeArray, nodes);
@@ -831,22 +837,19 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(D data, K key, size_t &no
 	rbtNode<K,D> *curr;
 	if(!(curr = rbt_searchKey(key)))
 		return NULL;
+		// Counts the nodes with the key and data (they are all in one in-order range), so the array is only as large as needed
+	auto range = rbt_equalRange(key, data);
+	for(nodes = 0; range.first != range.second; ++range.first) nodes++;
 		// Allocates enough memory to hold all nodes in
-	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[size];
-	nodePtr = (void **)nodeArray;
+	rbtNode<K,D> **nodeArray = new rbtNode<K,D>*[nodes], **nodePtr = nodeArray;
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPreWithDataKey(curr, data, key); break;
-		case IN_ORDER:			nodesInWithDataKey(curr, data, key); break;
-		case POST_ORDER:		nodesPostWithDataKey(curr, data, key); break;
-		case LEVEL_ORDER:		nodesLevelWithDataKey(data, key); break;
+		case PRE_ORDER:			nodesPreWithDataKey(curr, data, key, nodePtr); break;
+		case IN_ORDER:			nodesInWithDataKey(curr, data, key, nodePtr); break;
+		case POST_ORDER:		nodesPostWithDataKey(curr, data, key, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevelWithDataKey(data, key, nodePtr); break;
 		default:;
 	}
-		// Calculate the number of nodes put into the return array
-	nodes = (nodePtr - (void **)nodeArray);
-		// Checks if resize is needed, if so, resize array to match nodes copied
-	if (nodes < size)
-		return resize_helper(nodeArray, nodes);
 		// Returns the nodeArray
 	return nodeArray;
 }
@@ -857,17 +860,17 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(D data, K key, size_t &no
  * parameters: 			A pointer to a red-black tree
  * return value:		An array of rbtNodes that have the given data (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(rbtNode<K,D> **nodeArray, D data, K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
+template <typename K, typename D, typename C>
+rbtNode<K,D> **rbTree<K,D,C>::rbt_getAllNodesWithDataKey(rbtNode<K,D> **nodeArray, D data, K key, size_t &nodes, enum rbtraversal traversal, size_t level) const {
 		// Returns NULL if invaild
 	if(traversal == TEST_ORDER)
 		return NULL;
-		// Coverts the array into void pointer
-	nodePtr = (void **)nodeArray;
+		// Starts the pointer index at the front of the array
+	rbtNode<K,D> **nodePtr = nodeArray;
 		// Branches off if PRINT_LEVEL
 	if (traversal == PRINT_LEVEL) {
 			// Writes all the nodes into nodeArray
-		nodes = nodesSpecifiedLevelWithDataKey(level, data, key);
+		nodes = nodesSpecifiedLevelWithDataKey(nodeArray, level, data, key);
 			// Returns the nodeArray
 		return nodeArray;
 	}
@@ -877,14 +880,14 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(rbtNode<K,D> **nodeArray,
 		return NULL;
 		// Writes all the nodes into nodeArray, via an the given traversal
 	switch(traversal) {
-		case PRE_ORDER:			nodesPreWithDataKey(curr, data, key); break;
-		case IN_ORDER:			nodesInWithDataKey(curr, data, key); break;
-		case POST_ORDER:		nodesPostWithDataKey(curr, data, key); break;
-		case LEVEL_ORDER:		nodesLevelWithDataKey(data, key); break;
+		case PRE_ORDER:			nodesPreWithDataKey(curr, data, key, nodePtr); break;
+		case IN_ORDER:			nodesInWithDataKey(curr, data, key, nodePtr); break;
+		case POST_ORDER:		nodesPostWithDataKey(curr, data, key, nodePtr); break;
+		case LEVEL_ORDER:		nodesLevelWithDataKey(data, key, nodePtr); break;
 		default:;
 	}
 		// Calculate the number of nodes put into the return array
-	nodes = (nodePtr - (void **)nodeArray);
+	nodes = (nodePtr - nodeArray);
 		// Returns the nodeArray
 	return nodeArray;
 }
@@ -899,19 +902,17 @@ rbtNode<K,D> **rbTree<K,D>::rbt_getAllNodesWithDataKey(rbtNode<K,D> **nodeArray,
 	/*		KEYS	 */
 
 /*
- * function_identifier: Places all the keys in the red-black tree, into a global array, via an inorder traversal
- * parameters: 			A pointer to a node in the red-black tree
+ * function_identifier: Places all the keys in the red-black tree, into an array, via an inorder traversal
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
  * return value:		An array of data values in void pointer format (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-void rbTree<K,D>::getAllKeys(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::getAllKeys(rbtNode<K,D> *curr, K *&keysPtr) const {
 		// Performs inorder traversal
-	if(curr->left) getAllKeys(curr->left);
+	if(curr->left) getAllKeys(curr->left, keysPtr);
 		// Saves the key at the current index
-	*(K *)basePtr = curr->key;
-		// Increments the global pointer index
-	basePtr += sizeof(K);
-	if(curr->right) getAllKeys(curr->right);
+	*keysPtr++ = curr->key;
+	if(curr->right) getAllKeys(curr->right, keysPtr);
 }
 
 /*
@@ -919,8 +920,8 @@ void rbTree<K,D>::getAllKeys(rbtNode<K,D> *curr) const {
  * parameters: 			A keysArray (optional. If none provided, one is created)
  * return value:		An array of data values in void pointer format (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-K *rbTree<K,D>::rbt_getAllKeys(K *keysArray) const {
+template <typename K, typename D, typename C>
+K *rbTree<K,D,C>::rbt_getAllKeys(K *keysArray) const {
 		// Returns NULL if no nodes in tree
 	if(!size)
 		return NULL;
@@ -928,11 +929,11 @@ K *rbTree<K,D>::rbt_getAllKeys(K *keysArray) const {
 		// If no keysArray provided, allocates memory to a new key array
 	if (!keysArray)
 		keysArray = new K[size];
-		// Aligns the basePtr to the keysArray
-	basePtr = (std::byte *)keysArray;
+		// Starts the pointer index at the front of the keysArray
+	K *keysPtr = keysArray;
 
 		// Writes all keys into allocated memory
-	getAllKeys(root);
+	getAllKeys(root, keysPtr);
 
 		// Returns keys
 	return keysArray;
@@ -941,19 +942,17 @@ K *rbTree<K,D>::rbt_getAllKeys(K *keysArray) const {
 	/*		DATA	 */
 
 /*
- * function_identifier: Places all the keys in the red-black tree, into a global array, via an inorder traversal
- * parameters: 			A pointer to a node in the red-black tree
+ * function_identifier: Places all the keys in the red-black tree, into an array, via an inorder traversal
+ * parameters: 			A pointer to a node in the red-black tree and the array position to write to (return by reference)
  * return value:		An array of data values in void pointer format (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-void rbTree<K,D>::getAllData(rbtNode<K,D> *curr) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::getAllData(rbtNode<K,D> *curr, D *&dataPtr) const {
 		// Performs inorder traversal
-	if(curr->left) getAllData(curr->left);
+	if(curr->left) getAllData(curr->left, dataPtr);
 		// Saves the key at the current index
-	*(D *)basePtr = curr->data;
-		// Increments the global pointer index
-	basePtr += sizeof(D);
-	if(curr->right) getAllData(curr->right);
+	*dataPtr++ = curr->data;
+	if(curr->right) getAllData(curr->right, dataPtr);
 }
 
 /*
@@ -961,20 +960,20 @@ void rbTree<K,D>::getAllData(rbtNode<K,D> *curr) const {
  * parameters: 			N/A
  * return value:		An array of data values in void pointer format (caller's responsibility to clear it)
 */
-template <typename K, typename D>
-D *rbTree<K,D>::rbt_getAllData(D *dataArray) const {
+template <typename K, typename D, typename C>
+D *rbTree<K,D,C>::rbt_getAllData(D *dataArray) const {
 		// Returns NULL if no nodes in tree
 	if(!size)
 		return NULL;
 
 		// If no keysArray provided, allocates memory to a new key array
 	if (!dataArray)
-		dataArray = new K[size];
-		// Aligns the basePtr to the dataArray
-	basePtr = (std::byte *)dataArray;
+		dataArray = new D[size];
+		// Starts the pointer index at the front of the dataArray
+	D *dataPtr = dataArray;
 
 		// Writes all data into allocated memory
-	getAllData(root);
+	getAllData(root, dataPtr);
 
 		// Returns data
 	return dataArray;
@@ -988,34 +987,24 @@ D *rbTree<K,D>::rbt_getAllData(D *dataArray) const {
 /*	============================================================================  */
 
 /*
- * function_identifier: Counts all the nodes, in the red-black tree, that have the given key
- * parameters: 			A pointer the current considered node and the given key to check for
- * return value:		N/A
+ * function_identifier: Finds the in-order index of a bound (used by the count functions)
+ * parameters: 			An iterator from one of the bound functions
+ * return value:		The number of nodes before the bound (the tree size for the end iterator)
 */
-template <typename K, typename D>
-void rbTree<K,D>::countKey(rbtNode<K,D> *curr, K key) const {
-		// Performs inorder traversal
-	if(curr->left) countKey(curr->left, key);
-		// Checks if found node with requested key
-	if (curr->key == key)
-			// Increments the global pointer index
-		basePtr++;
-	if(curr->right) countKey(curr->right, key);
+template <typename K, typename D, typename C>
+inline size_t rbTree<K,D,C>::boundIdxBase(iterator bound) const {
+	return bound == end() ? size : findIdxBase(&*bound);
 }
 
 /*
  * function_identifier: Counts all the nodes, in the red-black tree, that have the given key
+ *						Nodes with equal keys are next to each other in order, so this is two O(log(N)) index lookups
  * parameters: 			The given key to check for
  * return value:		The count of all rbtNodes, in the red-black tree, that have the given key
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_countKey(K key) const {
-		// Resets the counter
-	basePtr = 0;
-		// Counts the number of nodes with the given key
-	countKey(root, key);
-		// Returns the result
-	return *((size_t*)(&basePtr));
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_countKey(K key) const {
+	return boundIdxBase(rbt_upperBound(key)) - boundIdxBase(rbt_lowerBound(key));
 }
 
 /*
@@ -1023,15 +1012,15 @@ size_t rbTree<K,D>::rbt_countKey(K key) const {
  * parameters: 			A pointer the current considered node and the given data to check for
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::countData(rbtNode<K,D> *curr, D data) const {
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::countData(rbtNode<K,D> *curr, D data, size_t &count) const {
 		// Performs inorder traversal
-	if(curr->left) countData(curr->left, data);
+	if(curr->left) countData(curr->left, data, count);
 		// Checks if found node with requested data
-	if (curr->data == data)
-			// Increments the global pointer index
-		basePtr++;
-	if(curr->right) countData(curr->right, data);
+	if (C::data(curr->data, data) == 0)
+			// Increments the counter
+		count++;
+	if(curr->right) countData(curr->right, data, count);
 }
 
 /*		
@@ -1039,45 +1028,62 @@ void rbTree<K,D>::countData(rbtNode<K,D> *curr, D data) const {
  * parameters: 			The given data to check for
  * return value:		The count of all rbtNodes, in the red-black tree, that have the given data
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_countData(D data) const {
-		// Resets the counter
-	basePtr = 0;
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_countData(D data) const {
+#ifdef RBT_DATA_INDEX
+		// Nodes with equal data are next to each other in the data index, so this is two O(log(N)) lookups
+	rbtNode<K,D> *node;
+	return dataRankBase(data, true, &node) - dataRankBase(data, false, &node);
+#else
+		// Initializes the counter
+	size_t count = 0;
 		// Counts the number of nodes with the given data
-	countData(root, data);
+	if (root)
+		countData(root, data, count);
 		// Returns the result
-	return *((size_t*)(&basePtr));
+	return count;
+#endif
 }
 
 /*
  * function_identifier: Counts all the nodes, in the red-black tree, that have the given key and data
- * parameters: 			A pointer the current considered node and the given key and data to check for
- * return value:		N/A
+ *						Nodes with equal keys and data are next to each other in order, so this is two O(log(N)) index lookups
+ * parameters: 			The given key and data to check for
+ * return value:		The count of all rbtNodes, in the red-black tree, that have the given key and data
 */
-template <typename K, typename D>
-void rbTree<K,D>::countKeyData(rbtNode<K,D> *curr, K key, D data) const {
-		// Performs inorder traversal
-	if(curr->left) countKeyData(curr->left, key, data);
-		// Checks if found node with requested key and data
-	if (curr->key == key && curr->data == data)
-			// Increments the global pointer index
-		basePtr++;
-	if(curr->right) countKeyData(curr->right, key, data);
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_countKeyData(K key, D data) const {
+	return boundIdxBase(rbt_upperBound(key, data)) - boundIdxBase(rbt_lowerBound(key, data));
 }
 
 /*
- * function_identifier: Counts all the nodes, in the red-black tree, that have the given key and data
- * parameters: 			The given key and data to check for
- * return value:		The count of all rbtNodes, in the red-black tree, that have the given key and data
+ * function_identifier: Counts all the nodes, in the red-black tree, with a key between the two keys provided (inclusive)
+ * parameters: 			The start and end keys of a range
+ * return value:		The count of all rbtNodes, in the red-black tree, in the range (0 if the range is empty)
 */
-template <typename K, typename D>
-size_t rbTree<K,D>::rbt_countKeyData(K key, D data) const {
-		// Resets the counter
-	basePtr = 0;
-		// Counts the number of nodes with the given key
-	countKeyData(root, key, data);
-		// Returns the result
-	return *((size_t*)(&basePtr));
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_countRange(K st, K ed) const {
+		// Ignores the trival case
+	if (C::key(st, ed) > 0)
+		return 0;
+
+	return boundIdxBase(rbt_upperBound(ed)) - boundIdxBase(rbt_lowerBound(st));
+}
+
+/*
+ * function_identifier: Counts all the nodes, in the red-black tree, between the two key and data pairs provided (inclusive,
+ *						ordered by key and then data)
+ * parameters: 			The start key and data, and the end key and data, of a range
+ * return value:		The count of all rbtNodes, in the red-black tree, in the range (0 if the range is empty)
+*/
+template <typename K, typename D, typename C>
+size_t rbTree<K,D,C>::rbt_countRange(K stK, D stD, K edK, D edD) const {
+		// Ignores the trival case
+	int cmp = C::key(stK, edK);
+	if (cmp > 0 || (!cmp && C::data(stD, edD) > 0))
+		return 0;
+
+	return boundIdxBase(rbt_upperBound(edK, edD)) - boundIdxBase(rbt_lowerBound(stK, stD));
 }
 
 #endif /* _rbt_TRAVERSAL */
\ No newline at end of file
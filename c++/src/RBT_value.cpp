@@ -3,16 +3,6 @@
 #include	"RBT_main.h"
 #include	"RBT_sort.h"
 
-	/*	 GLOBAL VARIABLES	*/
-namespace {
-		// External From 'RBT_sort.cpp'
-	template <typename K, typename D>
-	extern inline bool(*fooPtr)(rbtNode<K,D> *, rbtNode<K,D> *);
-
-		// External From 'def.h'
-	extern inline void *rbt__otherData__;
-}
-
 /*	============================================================================  */
 /* |                                                                            | */
 /* |                             HELPER FUNCTION                                | */
@@ -20,95 +10,104 @@ namespace {
 /*	============================================================================  */
 
 /*
- * function_identifier: A private function used to reposition a single node, into the right place, in a sorted node array
- * parameters: 			A node array, the start and end indexes of the array, and the node to reposition
+ * function_identifier: The base template for all single node set functions. The node keeps its place if it still
+ *						falls between the nodes before and after it, and is otherwise unlinked and inserted again
+ *						Either way the node itself is kept, so O(log(N)) with no allocation
+ * parameters: 			A node to alter and a function that changes the node
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::nodeReposition(rbtNode<K,D> **rbtNodes, rbtNode<K,D> **IdxS, rbtNode<K,D> **IdxE, rbtNode<K,D> *curr) {
-		// If there is a future node to consider and if that node is less than current node
-	if ((IdxE != IdxS + 1) && keyDataCompair(*(IdxS + 1), curr)) {
-			// If so, the current node is in the wrong place. Reposition it
-		while(++IdxS != IdxE && keyDataCompair(*IdxS, curr))
-			*(IdxS - 1) = *IdxS;
-		*(IdxS - 1) = curr;
-	}
-		// Else check if their is a past node to consider and if that node is greater than current node
-	else if ((IdxS != rbtNodes) && keyDataCompair(curr, *(IdxS - 1))) {
-			// If so, the current node is in the wrong place. Reposition it
-		while(--IdxS >= rbtNodes && keyDataCompair(curr, *IdxS))
-			*(IdxS + 1) = *IdxS;
-		*(IdxS + 1) = curr;
+template <typename K, typename D, typename C>
+template <typename F>
+void rbTree<K,D,C>::rbt_setBase(rbtNode<K,D> *curr, F foo) {
+		// If the node is not found in this red-black tree, just return
+	rbtNode<K,D> *top = curr;
+	while(top && top->parent)
+		top = top->parent;
+	if (!top || top != root)
+		return;
+
+		// Finds the nodes before and after the node
+	iterator prev(curr, root), next(curr, root);
+	--prev; ++next;
+
+		// Sets the node's relevant value(s), out of the data index
+	dataEraseBase(curr);
+	foo(curr);
+
+		// Keeps the node's place if it is still in order
+	if ((prev == end() || !keyDataCompair(curr, &*prev)) && (next == end() || !keyDataCompair(&*next, curr))) {
+		dataInsertBase(curr);
+		if (augmented)
+			for(; curr; curr = curr->parent)
+				augmentBase(curr);
+		return;
 	}
-		// The node is now in correct position
 
-		// Set current node array as the red-black tree and end clear it
-	treeifyShallow(0, size-1, rbtNodes, &root);
-	delete [] rbtNodes;
+		// Else, unlinks the node and inserts it again, as a leaf
+	unlinkBase(curr);
+	curr->left = curr->right = NULL;
+	curr->descendants = 0;
+	augmentBase(curr);
+	insertBase(curr);
 }
 
 /*
- * function_identifier: The base template for all single node set functions
- * parameters: 			A node to alter and a function that changes the node
+ * function_identifier: Recomputes what every node, in a branch, keeps about its subtree, children first
+ * parameters: 			The branch (or NULL)
  * return value:		N/A
 */
-template <typename K, typename D>
-template <typename F>
-void rbTree<K,D>::rbt_setBase(rbtNode<K,D> *curr, F foo) {
-		// Initializes values
-	rbtNode<K,D> **rbtNodes, **IdxS, **IdxE;
-
-		// Gets all nodes
-	IdxS = rbtNodes = rbt_getAllNodes(); IdxE = IdxS + size;
-
-		// Cycles through all nodes of this red-black tree
-	while(true) {
-			// If the node is not found in this red-black tree, just return
-		if (IdxS == IdxE) {
-			delete [] rbtNodes;
-			return;
-		}
-			// Else, if node is found in this red-black tree, begin repositioning
-		if (*IdxS == curr)
-			break;
-			// Otherwise, check another node
-		IdxS++;
-	}
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::augmentAllBase(rbtNode<K,D> *curr) {
+		// Ignores the trival case
+	if (!curr)
+		return;
 
-		// Sets the node's relevant value(s) and begins repositioning
-	foo(curr);
-	nodeReposition(rbtNodes, IdxS, IdxE, curr);
+	augmentAllBase(curr->left);
+	augmentAllBase(curr->right);
+	augmentBase(curr);
 }
 
 /*
- * function_identifier: The base template for all full-tree set functions
- * parameters: 			A function that changes all nodes
+ * function_identifier: The base template for all full-tree set functions. Changes the nodes in order, and checks
+ *						that each still goes after the one before it. If so, the tree's shape is kept, and only what
+ *						the nodes keep about their subtrees (and the data index, if data changed) is redone. Else,
+ *						the nodes are sorted and the tree is rebuilt
+ * parameters: 			A function that changes one node, and if it may change the node's data
  * return value:		N/A
 */
-template <typename K, typename D>
+template <typename K, typename D, typename C>
 template <typename F>
-inline void rbTree<K,D>::rbt_funcAllBase(F foo) {
+inline void rbTree<K,D,C>::rbt_funcAllBase(F foo, bool data) {
 		// Return if red-black tree is empty
 	if (!size)
 		return;
 
-		// Initializes values
-	rbtNode<K,D> **IdxS, **IdxE;
-
-		// Gets all nodes
-	IdxS = rbt_getAllNodes(); IdxE = IdxS + size;
+		// Reassigns all relevant values, in order
+	rbtNode<K,D> *prev = NULL;
+	bool ordered = true;
+	for(iterator it = begin(); it != end(); ++it) {
+		foo(&*it);
+		if (prev && keyDataCompair(&*it, prev))
+			ordered = false;
+		prev = &*it;
+	}
 
-		// Reassigns all relevant values
-	foo(IdxS, IdxE);
+		// If the order held, the tree only needs its subtree values (and data index) redone
+	if (ordered) {
+		if (augmented)
+			augmentAllBase(root);
+		if (data)
+			dataIndexBase();
+		return;
+	}
 
-		// Repositions all nodes
-	IdxS -= size;
-	fooPtr<K,D> = keyDataCompair;
-	mergeSortCallerBase(IdxS, 0, size - 1);
-	treeifyShallow(0, size - 1, IdxS, &root);
+		// Else, repositions all nodes
+	rbtNode<K,D> **rbtNodes = rbt_getAllNodes();
+	mergeSortCallerBase(rbtNodes, 0, size - 1, compair<KEYDATA>());
+	treeifyShallow(0, size - 1, rbtNodes, &root);
 
 		// Clears array of nodes
-	delete [] IdxS;
+	delete [] rbtNodes;
 }
 
 /*	============================================================================  */
@@ -124,17 +123,12 @@ inline void rbTree<K,D>::rbt_funcAllBase(F foo) {
  * parameters: 			A node from the current tree and new key and data values
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_set(rbtNode<K,D> *curr, K key, D data) {
-	rbt__otherData__ = new std::byte **[2];
-	((K **)rbt__otherData__)[0] = &key;
-	((D **)rbt__otherData__)[1] = &data;
-
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->key = *((K **)rbt__otherData__)[0];
-		curr->data = *((D **)rbt__otherData__)[1];
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_set(rbtNode<K,D> *curr, K key, D data) {
+	rbt_setBase(curr, [key, data] (rbtNode<K,D> *curr) -> void {
+		curr->key = key;
+		curr->data = data;
 	});
-	delete [] (std::byte **)rbt__otherData__;
 }
 
 /*
@@ -145,13 +139,10 @@ void rbTree<K,D>::rbt_set(rbtNode<K,D> *curr, K key, D data) {
  *						new key and data values by reference
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_func(rbtNode<K,D> *curr, void (*someFunc)(K &, D &)) {
-	typedef void (*funcType)(K &, D &);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		(*((funcType *)rbt__otherData__))(curr->key, curr->data);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_func(rbtNode<K,D> *curr, void (*someFunc)(K &, D &)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		someFunc(curr->key, curr->data);
 	});
 }
 
@@ -161,22 +152,13 @@ void rbTree<K,D>::rbt_func(rbtNode<K,D> *curr, void (*someFunc)(K &, D &)) {
  * parameters: 			A key value and a data value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_setAll(K key, D data) {
-	rbt__otherData__ = new std::byte **[2];
-	((K **)rbt__otherData__)[0] = &key;
-	((D **)rbt__otherData__)[1] = &data;
-
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the key and data of all values
-			(*IdxS)->key = *((K **)rbt__otherData__)[0];
-			(*IdxS)->data = *((D **)rbt__otherData__)[1];
-			IdxS++;
-		}
-	});
-	delete [] (std::byte **)rbt__otherData__;
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_setAll(K key, D data) {
+	rbt_funcAllBase([key, data] (rbtNode<K,D> *curr) -> void {
+			// Changes the key and data of each node
+		curr->key = key;
+		curr->data = data;
+	}, true);
 }
 
 /*
@@ -185,19 +167,12 @@ void rbTree<K,D>::rbt_setAll(K key, D data) {
  * parameters: 			A function that returns new key and data values by reference
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAll(void (*someFunc)(K &, D &)) {
-	typedef void (*funcType)(K &, D &);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the key and data of all values
-			(*((funcType *)rbt__otherData__))((*IdxS)->key, (*IdxS)->data);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAll(void (*someFunc)(K &, D &)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the key and data of each node
+		someFunc(curr->key, curr->data);
+	}, true);
 }
 
 /*	============================================================================  */
@@ -213,11 +188,10 @@ void rbTree<K,D>::rbt_funcAll(void (*someFunc)(K &, D &)) {
  * parameters: 			A node from the current tree, and a new key
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_setKey(rbtNode<K,D> *curr, K key) {
-	rbt__otherData__ = &key;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->key = *((K *)rbt__otherData__);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_setKey(rbtNode<K,D> *curr, K key) {
+	rbt_setBase(curr, [key] (rbtNode<K,D> *curr) -> void {
+		curr->key = key;
 	});
 }
 
@@ -228,13 +202,10 @@ void rbTree<K,D>::rbt_setKey(rbtNode<K,D> *curr, K key) {
  * parameters: 			A node from the current tree, and function that returns a key value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcKey(rbtNode<K,D> *curr, K (*someFunc)()) {
-	typedef K (*funcType)();
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->key = (*((funcType *)rbt__otherData__))();
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcKey(rbtNode<K,D> *curr, K (*someFunc)()) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->key = someFunc();
 	});
 }
 
@@ -245,13 +216,10 @@ void rbTree<K,D>::rbt_funcKey(rbtNode<K,D> *curr, K (*someFunc)()) {
  * parameters: 			A node from the current tree, and function that returns a key value (with key and data parameters)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcKey(rbtNode<K,D> *curr, K (*someFunc)(K, D)) {
-	typedef K (*funcType)(K, D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->key = (*((funcType *)rbt__otherData__))(curr->key, curr->data);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcKey(rbtNode<K,D> *curr, K (*someFunc)(K, D)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->key = someFunc(curr->key, curr->data);
 	});
 }
 
@@ -262,13 +230,10 @@ void rbTree<K,D>::rbt_funcKey(rbtNode<K,D> *curr, K (*someFunc)(K, D)) {
  * parameters: 			A node from the current tree, and function that returns a key value (with key parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcKeyK(rbtNode<K,D> *curr, K (*someFunc)(K)) {
-	typedef K (*funcType)(K);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->key = (*((funcType *)rbt__otherData__))(curr->key);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcKeyK(rbtNode<K,D> *curr, K (*someFunc)(K)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->key = someFunc(curr->key);
 	});
 }
 
@@ -279,13 +244,10 @@ void rbTree<K,D>::rbt_funcKeyK(rbtNode<K,D> *curr, K (*someFunc)(K)) {
  * parameters: 			A node from the current tree, and function that returns a key value (with data parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcKeyD(rbtNode<K,D> *curr, K (*someFunc)(D)) {
-	typedef K (*funcType)(D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->key = (*((funcType *)rbt__otherData__))(curr->data);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcKeyD(rbtNode<K,D> *curr, K (*someFunc)(D)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->key = someFunc(curr->data);
 	});
 }
 
@@ -295,15 +257,12 @@ void rbTree<K,D>::rbt_funcKeyD(rbtNode<K,D> *curr, K (*someFunc)(D)) {
  * parameters: 			A key value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_setAllKeys(K key) {
-	rbt__otherData__ = &key;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE)
-				// Changes the key of all values
-			(*IdxS++)->key = *((K *)rbt__otherData__);
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_setAllKeys(K key) {
+	rbt_funcAllBase([key] (rbtNode<K,D> *curr) -> void {
+			// Changes the key of each node
+		curr->key = key;
+	}, false);
 }
 
 /*
@@ -312,17 +271,12 @@ void rbTree<K,D>::rbt_setAllKeys(K key) {
  * parameters: 			A function that returns a key value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllKeys(K (*someFunc)()) {
-	typedef K (*funcType)();
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE)
-				// Changes the key of all values
-			(*IdxS++)->key = (*((funcType *)rbt__otherData__))();
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllKeys(K (*someFunc)()) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the key of each node
+		curr->key = someFunc();
+	}, false);
 }
 
 /*
@@ -331,19 +285,12 @@ void rbTree<K,D>::rbt_funcAllKeys(K (*someFunc)()) {
  * parameters: 			A function that returns a key value (with kay and data parameters)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllKeys(K (*someFunc)(K, D)) {
-	typedef K (*funcType)(K, D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the key of all values
-			(*IdxS)->key = (*((funcType *)rbt__otherData__))((*IdxS)->key, (*IdxS)->data);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllKeys(K (*someFunc)(K, D)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the key of each node
+		curr->key = someFunc(curr->key, curr->data);
+	}, false);
 }
 
 /*
@@ -352,19 +299,12 @@ void rbTree<K,D>::rbt_funcAllKeys(K (*someFunc)(K, D)) {
  * parameters: 			A function that returns a key value (with key parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllKeysK(K (*someFunc)(K)) {
-	typedef K (*funcType)(K);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the key of all values
-			(*IdxS)->key = (*((funcType *)rbt__otherData__))((*IdxS)->key);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllKeysK(K (*someFunc)(K)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the key of each node
+		curr->key = someFunc(curr->key);
+	}, false);
 }
 
 /*
@@ -373,19 +313,12 @@ void rbTree<K,D>::rbt_funcAllKeysK(K (*someFunc)(K)) {
  * parameters: 			A function that returns a key value (with data parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllKeysD(K (*someFunc)(D)) {
-	typedef K (*funcType)(D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the key of all values
-			(*IdxS)->key = (*((funcType *)rbt__otherData__))((*IdxS)->data);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllKeysD(K (*someFunc)(D)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the key of each node
+		curr->key = someFunc(curr->data);
+	}, false);
 }
 
 /*	============================================================================  */
@@ -401,11 +334,10 @@ void rbTree<K,D>::rbt_funcAllKeysD(K (*someFunc)(D)) {
  * parameters: 			A node from the current tree, and a new data
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_setData(rbtNode<K,D> *curr, D data) {
-	rbt__otherData__ = &data;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->data = (*((D *)rbt__otherData__));
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_setData(rbtNode<K,D> *curr, D data) {
+	rbt_setBase(curr, [data] (rbtNode<K,D> *curr) -> void {
+		curr->data = data;
 	});
 }
 
@@ -416,13 +348,10 @@ void rbTree<K,D>::rbt_setData(rbtNode<K,D> *curr, D data) {
  * parameters: 			A node from the current tree, and function that returns a data value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcData(rbtNode<K,D> *curr, D (*someFunc)()) {
-	typedef D (*funcType)();
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->data = (*((funcType *)rbt__otherData__))();
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcData(rbtNode<K,D> *curr, D (*someFunc)()) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->data = someFunc();
 	});
 }
 
@@ -433,13 +362,10 @@ void rbTree<K,D>::rbt_funcData(rbtNode<K,D> *curr, D (*someFunc)()) {
  * parameters: 			A node from the current tree, and function that returns a data value (with key and data parameters)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcData(rbtNode<K,D> *curr, D (*someFunc)(K, D)) {
-	typedef D (*funcType)(K, D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->data = (*((funcType *)rbt__otherData__))(curr->key, curr->data);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcData(rbtNode<K,D> *curr, D (*someFunc)(K, D)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->data = someFunc(curr->key, curr->data);
 	});
 }
 
@@ -450,13 +376,10 @@ void rbTree<K,D>::rbt_funcData(rbtNode<K,D> *curr, D (*someFunc)(K, D)) {
  * parameters: 			A node from the current tree, and function that returns a data value (with key parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcDataK(rbtNode<K,D> *curr, D (*someFunc)(K)) {
-	typedef D (*funcType)(K);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->data = (*((funcType *)rbt__otherData__))(curr->key);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcDataK(rbtNode<K,D> *curr, D (*someFunc)(K)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->data = someFunc(curr->key);
 	});
 }
 
@@ -467,13 +390,10 @@ void rbTree<K,D>::rbt_funcDataK(rbtNode<K,D> *curr, D (*someFunc)(K)) {
  * parameters: 			A node from the current tree, and function that returns a data value (with data parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcDataD(rbtNode<K,D> *curr, D (*someFunc)(D)) {
-	typedef D (*funcType)(D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_setBase(curr, [] (rbtNode<K,D> *curr) -> void {
-		curr->data = (*((funcType *)rbt__otherData__))(curr->data);
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcDataD(rbtNode<K,D> *curr, D (*someFunc)(D)) {
+	rbt_setBase(curr, [someFunc] (rbtNode<K,D> *curr) -> void {
+		curr->data = someFunc(curr->data);
 	});
 }
 
@@ -483,15 +403,12 @@ void rbTree<K,D>::rbt_funcDataD(rbtNode<K,D> *curr, D (*someFunc)(D)) {
  * parameters: 			A data value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_setAllData(D data) {
-	rbt__otherData__ = &data;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE)
-				// Changes the data of all values
-			(*IdxS++)->data = (*((D *)rbt__otherData__));
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_setAllData(D data) {
+	rbt_funcAllBase([data] (rbtNode<K,D> *curr) -> void {
+			// Changes the data of each node
+		curr->data = data;
+	}, true);
 }
 
 /*
@@ -500,17 +417,12 @@ void rbTree<K,D>::rbt_setAllData(D data) {
  * parameters: 			A function that returns a data value
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllData(D (*someFunc)()) {
-	typedef D (*funcType)();
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE)
-				// Changes the data of all values
-			(*IdxS++)->data = (*((funcType *)rbt__otherData__))();
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllData(D (*someFunc)()) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the data of each node
+		curr->data = someFunc();
+	}, true);
 }
 
 /*
@@ -519,19 +431,12 @@ void rbTree<K,D>::rbt_funcAllData(D (*someFunc)()) {
  * parameters: 			A function that returns a data value (with key and data parameters)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllData(D (*someFunc)(K, D)) {
-	typedef D (*funcType)(K, D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the data of all values
-			(*IdxS)->data = (*((funcType *)rbt__otherData__))((*IdxS)->key, (*IdxS)->data);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllData(D (*someFunc)(K, D)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the data of each node
+		curr->data = someFunc(curr->key, curr->data);
+	}, true);
 }
 
 /*
@@ -540,19 +445,12 @@ void rbTree<K,D>::rbt_funcAllData(D (*someFunc)(K, D)) {
  * parameters: 			A function that returns a data value (with key parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllDataK(D (*someFunc)(K)) {
-	typedef D (*funcType)(K);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the data of all values
-			(*IdxS)->data = (*((funcType *)rbt__otherData__))((*IdxS)->key);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllDataK(D (*someFunc)(K)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the data of each node
+		curr->data = someFunc(curr->key);
+	}, true);
 }
 
 /*
@@ -561,19 +459,12 @@ void rbTree<K,D>::rbt_funcAllDataK(D (*someFunc)(K)) {
  * parameters: 			A function that returns a data value (with data parameter)
  * return value:		N/A
 */
-template <typename K, typename D>
-void rbTree<K,D>::rbt_funcAllDataD(D (*someFunc)(D)) {
-	typedef D (*funcType)(D);
-
-	rbt__otherData__ = &someFunc;
-	rbt_funcAllBase([] (rbtNode<K,D> **&IdxS, rbtNode<K,D> **IdxE) -> void {
-			// Cycles through all nodes of this red-black tree
-		while(IdxS != IdxE) {
-				// Changes the data of all values
-			(*IdxS)->data = (*((funcType *)rbt__otherData__))((*IdxS)->data);
-			IdxS++;
-		}
-	});
+template <typename K, typename D, typename C>
+void rbTree<K,D,C>::rbt_funcAllDataD(D (*someFunc)(D)) {
+	rbt_funcAllBase([someFunc] (rbtNode<K,D> *curr) -> void {
+			// Changes the data of each node
+		curr->data = someFunc(curr->data);
+	}, true);
 }
 
 #endif /* _rbt_VALUE */
\ No newline at end of file